@@ -42,12 +42,16 @@ AMPLProblem::AMPLProblem(char* stub)
   // Read from nl
   fg_read(nl, 0);
 
+  // Allocate point buffer
+  x_buffer_ = new double[n_var];
+
 } // end AMPLProblem
 
 // Destructor
 AMPLProblem::~AMPLProblem()
 {
-  delete[] stub_;
+  free(stub_);
+  delete[] x_buffer_;
 }
 
 // Number of variables
@@ -83,18 +87,48 @@ bool AMPLProblem::evaluateObjective(int n,
                                     double& f)
 {
 
-  // Copy x
-  double* x_non_const = new double[n];
-  for (int i = 0; i < n; i++) {
-    x_non_const[i] = x[i];
+  // Set point
+  setPoint(n, x);
+
+  // Evaluate objective
+  int nerror = 0;
+  f = objval(0, x_buffer_, &nerror);
+
+  // Determine evaluation success
+  bool evaluation_success = true;
+  if (nerror > 0) {
+    evaluation_success = false;
   }
 
+  // Return
+  return evaluation_success;
+
+} // end evaluateObjective
+
+// Objective and gradient values
+bool AMPLProblem::evaluateObjectiveAndGradient(int n,
+                                               const double* x,
+                                               double& f,
+                                               double* g)
+{
+
+  // Set point
+  setPoint(n, x);
+
+  // Declare point known (so gradient reuses objective evaluation)
+  xknown(x_buffer_);
+
   // Evaluate objective
   int nerror = 0;
-  f = objval(0, x_non_const, &nerror);
+  f = objval(0, x_buffer_, &nerror);
+
+  // Evaluate gradient
+  if (nerror <= 0) {
+    objgrd(0, x_buffer_, g, &nerror);
+  }
 
-  // Delete x
-  delete[] x_non_const;
+  // Declare point unknown (so subsequent calls check for changes)
+  xunknown();
 
   // Determine evaluation success
   bool evaluation_success = true;
@@ -105,7 +139,7 @@ bool AMPLProblem::evaluateObjective(int n,
   // Return
   return evaluation_success;
 
-} // end evaluateObjective
+} // end evaluateObjectiveAndGradient
 
 // Gradient value
 bool AMPLProblem::evaluateGradient(int n,
@@ -113,18 +147,12 @@ bool AMPLProblem::evaluateGradient(int n,
                                    double* g)
 {
 
-  // Copy x
-  double* x_non_const = new double[n];
-  for (int i = 0; i < n; i++) {
-    x_non_const[i] = x[i];
-  }
+  // Set point
+  setPoint(n, x);
 
   // Evaluate gradient
   int nerror = 0;
-  objgrd(0, x_non_const, g, &nerror);
-
-  // Delete x
-  delete[] x_non_const;
+  objgrd(0, x_buffer_, g, &nerror);
 
   // Determine evaluation success
   bool evaluation_success = true;
@@ -137,6 +165,16 @@ bool AMPLProblem::evaluateGradient(int n,
 
 } // end evaluateGradient
 
+// Set point
+void AMPLProblem::setPoint(int n,
+                           const double* x)
+{
+
+  // Copy x
+  memcpy(x_buffer_, x, n * sizeof(double));
+
+} // end setPoint
+
 // Finalize solution
 bool AMPLProblem::finalizeSolution(int n,
                                    const double* x,
@@ -70,6 +70,19 @@ public:
   bool evaluateObjective(int n,
                          const double* x,
                          double& f);
+  /**
+   * Evaluates objective and gradient
+   * (Point is declared known to ASL so that objective and gradient share one evaluation.)
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[out] f is the objective value at "x", a double (return value)
+   * \param[out] g is the gradient value at "x", a double array (return value)
+   * \return indicator of success (true) or failure (false)
+   */
+  bool evaluateObjectiveAndGradient(int n,
+                                    const double* x,
+                                    double& f,
+                                    double* g);
   /**
    * Evaluates gradient
    * \param[in] n is the number of variables, the size of "x", a constant integer
@@ -117,9 +130,21 @@ private:
   void operator=(const AMPLProblem&);
   //@}
 
+  /** @name Private methods */
+  //@{
+  /**
+   * Copy point into (non-constant) buffer passed to ASL
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   */
+  void setPoint(int n,
+                const double* x);
+  //@}
+
   /** @name Private members */
   //@{
-  char* stub_; /**< Stub, i.e., name of problem */
+  char* stub_;       /**< Stub, i.e., name of problem */
+  double* x_buffer_; /**< Point buffer (ASL takes non-constant arrays), allocated once */
   //@}
 
 }; // end AMPLProblem
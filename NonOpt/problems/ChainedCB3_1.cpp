@@ -42,6 +42,22 @@ bool ChainedCB3_1::initialPoint(int n,
 
 } // end initialPoint
 
+// Element decomposition
+bool ChainedCB3_1::elementDecomposition(int n,
+                                        std::vector<std::vector<int>>& elements)
+{
+
+  // Set index sets of consecutive pairs
+  elements.clear();
+  for (int i = 0; i < n - 1; i++) {
+    elements.push_back({i, i + 1});
+  }
+
+  // Return
+  return true;
+
+} // end elementDecomposition
+
 // Objective value
 bool ChainedCB3_1::evaluateObjective(int n,
                                      const double* x,
@@ -59,6 +59,14 @@ public:
    */
   bool initialPoint(int n,
                     double* x);
+  /**
+   * Element decomposition
+   * \param[in] n is the number of variables, a constant integer
+   * \param[out] elements is the index sets, i.e., {i,i+1} for i = 0..n-2 (return value)
+   * \return indicator of success (true) or failure (false)
+   */
+  bool elementDecomposition(int n,
+                            std::vector<std::vector<int>>& elements);
   //@}
 
   /** @name Evaluate methods */
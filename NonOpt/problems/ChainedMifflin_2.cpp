@@ -42,6 +42,22 @@ bool ChainedMifflin_2::initialPoint(int n,
 
 } // end initialPoint
 
+// Element decomposition
+bool ChainedMifflin_2::elementDecomposition(int n,
+                                            std::vector<std::vector<int>>& elements)
+{
+
+  // Set index sets of consecutive pairs
+  elements.clear();
+  for (int i = 0; i < n - 1; i++) {
+    elements.push_back({i, i + 1});
+  }
+
+  // Return
+  return true;
+
+} // end elementDecomposition
+
 // Objective value
 bool ChainedMifflin_2::evaluateObjective(int n,
                                          const double* x,
@@ -4,6 +4,7 @@
 //
 // Author(s) : Frank E. Curtis
 
+#include <algorithm>
 #include <cmath>
 
 #include "MaxQ.hpp"
@@ -119,6 +120,51 @@ bool MaxQ::evaluateGradient(int n,
 
 } // end evaluateGradient
 
+// Values and gradients of epsilon-active pieces
+bool MaxQ::evaluateEpsilonActiveGradients(int n,
+                                          const double* x,
+                                          double epsilon,
+                                          int m_maximum,
+                                          int& m,
+                                          std::vector<double>& F,
+                                          std::vector<double>& G)
+{
+
+  // Evaluate maximum of squares
+  double f = 0.0;
+  for (int i = 0; i < n; i++) {
+    f = fmax(f, pow(x[i], 2.0));
+  }
+
+  // Determine pieces with values within epsilon of maximum
+  std::vector<int> active;
+  for (int i = 0; i < n; i++) {
+    if (pow(x[i], 2.0) >= f - epsilon) {
+      active.push_back(i);
+    }
+  } // end for
+
+  // Keep pieces with largest values, if more than maximum (in increasing order of index)
+  if ((int)active.size() > m_maximum) {
+    std::nth_element(active.begin(), active.begin() + m_maximum, active.end(), [x](int i, int j) { return fabs(x[i]) > fabs(x[j]); });
+    active.resize(m_maximum);
+    std::sort(active.begin(), active.end());
+  } // end if
+
+  // Set values and gradients of pieces
+  m = (int)active.size();
+  F.resize(m);
+  G.assign((size_t)m * n, 0.0);
+  for (int j = 0; j < m; j++) {
+    F[j] = pow(x[active[j]], 2.0);
+    G[(size_t)j * n + active[j]] = 2 * x[active[j]];
+  } // end for
+
+  // Return
+  return !isnan(f);
+
+} // end evaluateEpsilonActiveGradients
+
 // Finalize solution
 bool MaxQ::finalizeSolution(int n,
                             const double* x,
@@ -4,31 +4,18 @@
 //
 // Author(s) : Frank E. Curtis
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "MxHilb.hpp"
 
 // Constructor
 MxHilb::MxHilb(int n)
-  : number_of_variables_(n)
-{
-
-  // Declare array for sums
-  sum_ = new double[n];
-
-} // end constructor
+  : number_of_variables_(n) {}
 
 // Destructor
-MxHilb::~MxHilb()
-{
-
-  // Delete array
-  if (sum_ != nullptr) {
-    delete[] sum_;
-    sum_ = nullptr;
-  } // end if
-
-} // end destructor
+MxHilb::~MxHilb() {}
 
 // Number of variables
 bool MxHilb::numberOfVariables(int& n)
@@ -86,16 +73,17 @@ bool MxHilb::evaluateObjectiveAndGradient(int n,
                                           double* g)
 {
 
-  // Evaluate sums
+  // Evaluate sums (in local array, so that evaluations may run concurrently)
+  std::vector<double> sum(n);
   f = 0.0;
   int index = 0;
   for (int i = 0; i < n; i++) {
-    sum_[i] = 0.0;
+    sum[i] = 0.0;
     for (int j = 0; j < n; j++) {
-      sum_[i] = sum_[i] + x[j] / ((double)i + (double)j + 1.0);
+      sum[i] = sum[i] + x[j] / ((double)i + (double)j + 1.0);
     }
-    if (fabs(sum_[i]) > f) {
-      f = fabs(sum_[i]);
+    if (fabs(sum[i]) > f) {
+      f = fabs(sum[i]);
       index = i;
     } // end if
   }   // end for
@@ -104,7 +92,7 @@ bool MxHilb::evaluateObjectiveAndGradient(int n,
   bool success = !std::isnan(f);
 
   // Evaluate gradient
-  if (sum_[index] >= 0.0) {
+  if (sum[index] >= 0.0) {
     for (int j = 0; j < n; j++) {
       g[j] = 1.0 / ((double)index + (double)j + 1.0);
       if (std::isnan(g[j])) {
@@ -132,16 +120,17 @@ bool MxHilb::evaluateGradient(int n,
                               double* g)
 {
 
-  // Evaluate sums
+  // Evaluate sums (in local array, so that evaluations may run concurrently)
+  std::vector<double> sum(n);
   double f = 0.0;
   int index = 0;
   for (int i = 0; i < n; i++) {
-    sum_[i] = 0.0;
+    sum[i] = 0.0;
     for (int j = 0; j < n; j++) {
-      sum_[i] = sum_[i] + x[j] / ((double)i + (double)j + 1.0);
+      sum[i] = sum[i] + x[j] / ((double)i + (double)j + 1.0);
     }
-    if (fabs(sum_[i]) > f) {
-      f = fabs(sum_[i]);
+    if (fabs(sum[i]) > f) {
+      f = fabs(sum[i]);
       index = i;
     } // end if
   }   // end for
@@ -150,7 +139,7 @@ bool MxHilb::evaluateGradient(int n,
   bool success = true;
 
   // Evaluate gradient
-  if (sum_[index] >= 0.0) {
+  if (sum[index] >= 0.0) {
     for (int j = 0; j < n; j++) {
       g[j] = 1.0 / ((double)index + (double)j + 1.0);
       if (std::isnan(g[j])) {
@@ -172,6 +161,63 @@ bool MxHilb::evaluateGradient(int n,
 
 } // end evaluateGradient
 
+// Values and gradients of epsilon-active pieces
+bool MxHilb::evaluateEpsilonActiveGradients(int n,
+                                            const double* x,
+                                            double epsilon,
+                                            int m_maximum,
+                                            int& m,
+                                            std::vector<double>& F,
+                                            std::vector<double>& G)
+{
+
+  // Evaluate sums (in local array, so that evaluations may run concurrently)
+  std::vector<double> sum(n);
+  double f = 0.0;
+  for (int i = 0; i < n; i++) {
+    sum[i] = 0.0;
+    for (int j = 0; j < n; j++) {
+      sum[i] = sum[i] + x[j] / ((double)i + (double)j + 1.0);
+    }
+    f = fmax(f, fabs(sum[i]));
+  } // end for
+
+  // Declare success
+  bool success = !std::isnan(f);
+
+  // Determine pieces with values within epsilon of maximum
+  std::vector<int> active;
+  for (int i = 0; i < n; i++) {
+    if (fabs(sum[i]) >= f - epsilon) {
+      active.push_back(i);
+    }
+  } // end for
+
+  // Keep pieces with largest values, if more than maximum (in increasing order of index)
+  if ((int)active.size() > m_maximum) {
+    std::nth_element(active.begin(), active.begin() + m_maximum, active.end(), [&sum](int i, int j) { return fabs(sum[i]) > fabs(sum[j]); });
+    active.resize(m_maximum);
+    std::sort(active.begin(), active.end());
+  } // end if
+
+  // Set values and gradients of pieces
+  m = (int)active.size();
+  F.resize(m);
+  G.resize((size_t)m * n);
+  for (int k = 0; k < m; k++) {
+    int i = active[k];
+    F[k] = fabs(sum[i]);
+    double sign = (sum[i] >= 0.0) ? 1.0 : -1.0;
+    for (int j = 0; j < n; j++) {
+      G[(size_t)k * n + j] = sign / ((double)i + (double)j + 1.0);
+    }
+  } // end for
+
+  // Return
+  return success;
+
+} // end evaluateEpsilonActiveGradients
+
 // Finalize solution
 bool MxHilb::finalizeSolution(int n,
                               const double* x,
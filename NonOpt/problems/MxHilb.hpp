@@ -94,6 +94,24 @@ public:
   bool evaluateGradient(int n,
                         const double* x,
                         double* g);
+  /**
+   * Evaluates values and gradients of epsilon-active pieces
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[in] epsilon is the activity tolerance, a constant double
+   * \param[in] m_maximum is the maximum number of pieces to return (those with largest values), a constant integer
+   * \param[out] m is the number of epsilon-active pieces returned, an integer (return value)
+   * \param[out] F is the values of the epsilon-active pieces at "x", a double vector (return value)
+   * \param[out] G is the gradients of the epsilon-active pieces at "x", a double vector (column-major, n*m) (return value)
+   * \return indicator of success (true) or failure (false)
+   */
+  bool evaluateEpsilonActiveGradients(int n,
+                                      const double* x,
+                                      double epsilon,
+                                      int m_maximum,
+                                      int& m,
+                                      std::vector<double>& F,
+                                      std::vector<double>& G);
   //@}
 
   /** @name Finalize methods */
@@ -130,7 +148,6 @@ private:
   /** @name Private members */
   //@{
   int number_of_variables_; /**< Number of variables */
-  double* sum_;             /**< Array for sums      */
   //@}
 
 }; // end MxHilb
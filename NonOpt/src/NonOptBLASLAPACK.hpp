@@ -13,14 +13,26 @@ extern "C"
   // Subroutines
   void daxpy_(int* n, double* a, double* x, int* incx, double* y, int* incy);
   void dcopy_(int* n, double* x, int* incx, double* y, int* incy);
+  void dgemm_(char* ta, char* tb, int* m, int* n, int* k, double* a, double* A, int* lda, double* B, int* ldb, double* b, double* C, int* ldc);
+  void dgemv_(char* t, int* m, int* n, double* a, double* A, int* lda, double* x, int* incx, double* b, double* y, int* incy);
+  void drot_(int* n, double* x, int* incx, double* y, int* incy, double* c, double* s);
   void dscal_(int* n, double* a, double* x, int* incx);
+  void dspmv_(char* u, int* n, double* a, double* A, double* x, int* incx, double* b, double* y, int* incy);
+  void dspr_(char* u, int* n, double* a, double* x, int* incx, double* A);
+  void dspr2_(char* u, int* n, double* a, double* x, int* incx, double* y, int* incy, double* A);
+  void dsymm_(char* s, char* u, int* m, int* n, double* a, double* A, int* lda, double* B, int* ldb, double* b, double* C, int* ldc);
   void dsymv_(char* u, int* n, double* a, double* A, int* m, double* x, int* incx, double* b, double* y, int* incy);
   void dsyr_(char* u, int* n, double* a, double* x, int* incx, double* A, int* m);
   void dsyr2_(char* u, int* n, double* a, double* x, int* incx, double* y, int* incy, double* A, int* m);
+  void dsyrk_(char* u, char* t, int* n, int* k, double* a, double* A, int* lda, double* b, double* C, int* ldc);
   void dsytrf_(char* u, int* n, double* a, int* m, int* o, double* w, int* l, int* f);
   void dsytrs_(char* u, int* n, int* r, double* a, int* m, int* o, double* b, int* d, int* f);
+  void dtpsv_(char* u, char* t, char* d, int* n, double* A, double* x, int* incx);
+  void dtrsm_(char* s, char* u, char* t, char* d, int* m, int* n, double* a, double* A, int* lda, double* B, int* ldb);
   void dtrsv_(char* u, char* t, char* d, int* n, double* A, int* m, double* x, int* incx);
-  void dpotf2_(char* u, int* n, double* A, int* m, int* o);
+  void dpotrf_(char* u, int* n, double* A, int* m, int* o);
+  void dpptrf_(char* u, int* n, double* A, int* o);
+  void dpptrs_(char* u, int* n, int* r, double* A, double* b, int* d, int* f);
 
   // Scalar functions
   double dasum_(int* n, double* x, int* incx);
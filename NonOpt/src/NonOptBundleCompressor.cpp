@@ -0,0 +1,166 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <cmath>
+
+#include "NonOptBundleCompressor.hpp"
+
+namespace NonOpt
+{
+
+// Constructor
+BundleCompressor::BundleCompressor()
+  : enabled_(false),
+    tolerance_(0.0),
+    merge_counter_(0) {}
+
+// Destructor
+BundleCompressor::~BundleCompressor() {}
+
+// Clear
+void BundleCompressor::clear()
+{
+
+  // Clear recorded entries
+  vector_list_.clear();
+  vector_.clear();
+  index_.clear();
+
+} // end clear
+
+// Set parameters
+void BundleCompressor::setParameters(bool enabled,
+                                     double tolerance)
+{
+
+  // Set parameters
+  enabled_ = enabled;
+  tolerance_ = (tolerance > 0.0) ? tolerance : 0.0;
+
+  // Clear
+  clear();
+
+} // end setParameters
+
+// Compress
+int BundleCompressor::compress(std::vector<std::shared_ptr<Vector>>& vector_list,
+                               std::vector<double>& vector)
+{
+
+  // Check for disabled compressor
+  if (!enabled_) {
+    return 0;
+  }
+
+  // Set number of entries recorded by previous calls
+  int recorded_length = (int)vector_list_.size();
+
+  // Declare compressed data
+  std::vector<std::shared_ptr<Vector>> vector_list_compressed;
+  std::vector<double> vector_compressed;
+
+  // Initialize removal counter
+  int removed = 0;
+
+  // Loop through entries
+  for (int i = 0; i < (int)vector_list.size(); i++) {
+
+    // Evaluate key and find recorded entry
+    double vector_key = key(*vector_list[i]);
+    int index = find(*vector_list[i], vector_key);
+
+    // Check for entry in same list, recorded entry with at least as large "b", or neither
+    if (index >= recorded_length) {
+      vector_[index] = fmax(vector_[index], vector[i]);
+      vector_compressed[index - recorded_length] = vector_[index];
+      removed++;
+    }
+    else if (index >= 0 && vector_[index] >= vector[i]) {
+      removed++;
+    }
+    else {
+      index_[vector_key].push_back((int)vector_list_.size());
+      vector_list_.push_back(vector_list[i]);
+      vector_.push_back(vector[i]);
+      vector_list_compressed.push_back(vector_list[i]);
+      vector_compressed.push_back(vector[i]);
+    }
+
+  } // end for
+
+  // Set compressed data
+  if (removed > 0) {
+    vector_list = vector_list_compressed;
+    vector = vector_compressed;
+  }
+
+  // Increment merge counter
+  merge_counter_ += removed;
+
+  // Return number removed
+  return removed;
+
+} // end compress
+
+// Key
+double BundleCompressor::key(const Vector& vector) const
+{
+
+  // Evaluate sum of elements
+  double sum = 0.0;
+  for (int i = 0; i < vector.length(); i++) {
+    sum += vector.values()[i];
+  }
+
+  // Return key
+  return (tolerance_ > 0.0) ? floor(sum / (vector.length() * tolerance_)) : sum;
+
+} // end key
+
+// Find
+int BundleCompressor::find(const Vector& vector,
+                           double key) const
+{
+
+  // Loop through equal and (if tolerance positive) adjacent keys
+  for (int offset = (tolerance_ > 0.0) ? -1 : 0; offset <= ((tolerance_ > 0.0) ? 1 : 0); offset++) {
+
+    // Find bucket
+    auto bucket = index_.find(key + offset);
+    if (bucket == index_.end()) {
+      continue;
+    }
+
+    // Loop through candidates
+    for (int index : bucket->second) {
+
+      // Set candidate
+      const Vector& candidate = *vector_list_[index];
+
+      // Check length
+      if (candidate.length() != vector.length()) {
+        continue;
+      }
+
+      // Check infinity-norm distance
+      int j = 0;
+      while (j < vector.length() && fabs(candidate.values()[j] - vector.values()[j]) <= tolerance_) {
+        j++;
+      }
+      if (j == vector.length()) {
+        return index;
+      }
+
+    } // end for
+
+  } // end for
+
+  // Return not found
+  return -1;
+
+} // end find
+
+} // namespace NonOpt
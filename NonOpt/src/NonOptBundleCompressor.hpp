@@ -0,0 +1,152 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTBUNDLECOMPRESSOR_HPP__
+#define __NONOPTBUNDLECOMPRESSOR_HPP__
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "NonOptVector.hpp"
+
+namespace NonOpt
+{
+
+/**
+ * BundleCompressor class
+ * (Record of the QP "G" and "b" data passed to a QP solver since the last clear, used to
+ *  merge gradients whose infinity-norm distance is within a tolerance before they are
+ *  passed.  Candidates are found by hashing the sum of vector elements onto a grid with
+ *  spacing "n*tolerance", so only entries with equal or adjacent keys are compared.)
+ */
+class BundleCompressor
+{
+
+public:
+  /** @name Constructors */
+  //@{
+  /**
+   * Declare BundleCompressor (disabled)
+   */
+  BundleCompressor();
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Delete data
+   */
+  ~BundleCompressor();
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Enabled indicator
+   * \return indicator of whether merging is performed
+   */
+  inline bool const enabled() const { return enabled_; };
+  /**
+   * Merge counter
+   * \return number of entries merged since counter was reset
+   */
+  inline int const mergeCounter() const { return merge_counter_; };
+  /**
+   * Size
+   * \return number of entries currently recorded
+   */
+  inline int const size() const { return (int)vector_list_.size(); };
+  /**
+   * Tolerance
+   * \return infinity-norm distance within which vectors are merged
+   */
+  inline double const tolerance() const { return tolerance_; };
+  //@}
+
+  /** @name Set methods */
+  //@{
+  /**
+   * Clear recorded entries (e.g., before QP data are set rather than added)
+   */
+  void clear();
+  /**
+   * Reset merge counter
+   */
+  void resetCounter() { merge_counter_ = 0; };
+  /**
+   * Set enabled indicator and tolerance (and clear recorded entries)
+   * \param[in] enabled indicates whether merging is performed
+   * \param[in] tolerance is infinity-norm distance within which vectors are merged
+   */
+  void setParameters(bool enabled,
+                     double tolerance);
+  //@}
+
+  /** @name Compress method */
+  //@{
+  /**
+   * Compress QP data, in place, and record remaining entries
+   * (An entry within tolerance of one in the same list is merged into the earlier one,
+   *  which keeps the larger "b" value.  An entry within tolerance of one recorded by a
+   *  previous call, i.e., already passed to the QP solver, is removed if its "b" value is
+   *  not larger, since the QP solver's data cannot be modified.)
+   * \param[in,out] vector_list is vector of pointers to Vectors to be passed as QP "G" data
+   * \param[in,out] vector is vector of double values to be passed as QP "b" data
+   * \return number of entries removed
+   */
+  int compress(std::vector<std::shared_ptr<Vector>>& vector_list,
+               std::vector<double>& vector);
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  BundleCompressor(const BundleCompressor&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const BundleCompressor&);
+  //@}
+
+  /** @name Private methods */
+  //@{
+  /**
+   * Evaluate key of vector
+   * \param[in] vector is Vector to be hashed
+   * \return sum of elements of "vector" divided by "n*tolerance" and rounded down (sum if tolerance is zero)
+   */
+  double key(const Vector& vector) const;
+  /**
+   * Find recorded entry within tolerance of vector
+   * \param[in] vector is Vector to be found
+   * \param[in] key is key of "vector"
+   * \return index of recorded entry, or -1 if not found
+   */
+  int find(const Vector& vector,
+           double key) const;
+  //@}
+
+  /** @name Private members */
+  //@{
+  bool enabled_;
+  double tolerance_;
+  int merge_counter_;
+  std::vector<std::shared_ptr<Vector>> vector_list_;
+  std::vector<double> vector_;
+  std::unordered_map<double, std::vector<int>> index_;
+  //@}
+
+}; // end BundleCompressor
+
+} // namespace NonOpt
+
+#endif /* __NONOPTBUNDLECOMPRESSOR_HPP__ */
@@ -21,6 +21,7 @@ DECLARE_EXCEPTION(NONOPT_SUCCESS_EXCEPTION);
 DECLARE_EXCEPTION(NONOPT_OBJECTIVE_SIMILARITY_EXCEPTION);
 DECLARE_EXCEPTION(NONOPT_OBJECTIVE_TOLERANCE_EXCEPTION);
 DECLARE_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION);
+DECLARE_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION);
 DECLARE_EXCEPTION(NONOPT_ITERATE_NORM_LIMIT_EXCEPTION);
 DECLARE_EXCEPTION(NONOPT_ITERATION_LIMIT_EXCEPTION);
 DECLARE_EXCEPTION(NONOPT_FUNCTION_EVALUATION_LIMIT_EXCEPTION);
@@ -55,6 +56,7 @@ DECLARE_EXCEPTION(DE_FAILURE_EXCEPTION);
  */
 DECLARE_EXCEPTION(DC_SUCCESS_EXCEPTION);
 DECLARE_EXCEPTION(DC_CPU_TIME_LIMIT_EXCEPTION);
+DECLARE_EXCEPTION(DC_WALL_TIME_LIMIT_EXCEPTION);
 DECLARE_EXCEPTION(DC_EVALUATION_FAILURE_EXCEPTION);
 DECLARE_EXCEPTION(DC_ITERATION_LIMIT_EXCEPTION);
 DECLARE_EXCEPTION(DC_QP_FAILURE_EXCEPTION);
@@ -76,6 +78,7 @@ DECLARE_EXCEPTION(PS_FAILURE_EXCEPTION);
  */
 DECLARE_EXCEPTION(QP_SUCCESS_EXCEPTION);
 DECLARE_EXCEPTION(QP_CPU_TIME_LIMIT_EXCEPTION);
+DECLARE_EXCEPTION(QP_WALL_TIME_LIMIT_EXCEPTION);
 DECLARE_EXCEPTION(QP_FACTORIZATION_ERROR_EXCEPTION);
 DECLARE_EXCEPTION(QP_INPUT_ERROR_EXCEPTION);
 DECLARE_EXCEPTION(QP_ITERATION_LIMIT_EXCEPTION);
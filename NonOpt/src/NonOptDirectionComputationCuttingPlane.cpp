@@ -49,6 +49,13 @@ void DirectionComputationCuttingPlane::addOptions(Options* options)
                          "              solver does not terminate after considering full QP step.\n"
                          "              Shortened stepsize set by DCCP_shortened_stepsize parameter.\n"
                          "Default     : true.");
+  options->addBoolOption("DCCP_use_active_gradients",
+                         false,
+                         "Determines whether to add gradients of epsilon-active pieces,\n"
+                         "              if provided by the problem, to the subproblem.  The\n"
+                         "              tolerance is the stationarity radius times the norm\n"
+                         "              of the current gradient.\n"
+                         "Default     : false.");
 
   // Add double options
   options->addDoubleOption("DCCP_aggregation_size_threshold",
@@ -94,6 +101,15 @@ void DirectionComputationCuttingPlane::addOptions(Options* options)
                            "Default     : 1e-08.");
 
   // Add integer options
+  options->addIntegerOption("DCCP_active_gradients_maximum",
+                            100,
+                            1,
+                            NONOPT_INT_INFINITY,
+                            "Maximum number of gradients of epsilon-active pieces added to\n"
+                            "              the subproblem if DCCP_use_active_gradients == true.  If\n"
+                            "              more pieces are epsilon-active, then those with the\n"
+                            "              largest values are added.\n"
+                            "Default     : 100.");
   options->addIntegerOption("DCCP_inner_iteration_limit",
                             20,
                             0,
@@ -114,6 +130,7 @@ void DirectionComputationCuttingPlane::setOptions(Options* options)
   options->valueAsBool("DCCP_try_aggregation", try_aggregation_);
   options->valueAsBool("DCCP_try_gradient_step", try_gradient_step_);
   options->valueAsBool("DCCP_try_shortened_step", try_shortened_step_);
+  options->valueAsBool("DCCP_use_active_gradients", use_active_gradients_);
 
   // Read double options
   options->valueAsDouble("DCCP_aggregation_size_threshold", aggregation_size_threshold_);
@@ -123,6 +140,7 @@ void DirectionComputationCuttingPlane::setOptions(Options* options)
   options->valueAsDouble("DCCP_step_acceptance_tolerance", step_acceptance_tolerance_);
 
   // Read integer options
+  options->valueAsInteger("DCCP_active_gradients_maximum", active_gradients_maximum_);
   options->valueAsInteger("DCCP_inner_iteration_limit", inner_iteration_limit_);
 
 } // end setOptions
@@ -158,6 +176,7 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
   quantities->resetQPIterationCounter();
   quantities->setTrialIterateToCurrentIterate();
   clock_t start_time = clock();
+  double start_wall_time = quantities->currentWallTime();
 
   // try direction computation, terminate on any exception
   try {
@@ -246,42 +265,88 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
 
     } // end if (try gradient step)
 
-    // Loop through point set
-    for (int point_count = 0; point_count < (int)quantities->pointSet()->size(); point_count++) {
+    // Declare points in stationarity radius and distances to current iterate
+    std::vector<std::shared_ptr<Point>> points_in_radius;
+    std::vector<double> distances_in_radius;
 
-      // Create difference vector
-      std::shared_ptr<Vector> difference = quantities->currentIterate()->vector()->makeNewLinearCombination(1.0, -1.0, *(*quantities->pointSet())[point_count]->vector());
+    // Find points within stationarity radius of current iterate
+    std::vector<int> indices_in_radius;
+    quantities->pointSet()->findPointsInRadius(*quantities->currentIterate()->vector(), quantities->stationarityRadius(), indices_in_radius, distances_in_radius);
 
-      // Check distance between point and current iterate
-      if (difference->normInf() <= quantities->stationarityRadius()) {
+    // Loop through points in stationarity radius
+    for (int point_count = 0; point_count < (int)indices_in_radius.size(); point_count++) {
+      points_in_radius.push_back((*quantities->pointSet())[indices_in_radius[point_count]]);
+    }
 
-        // Evaluate objective and gradient
-        if (quantities->evaluateFunctionWithGradient()) {
-          evaluation_success = (*quantities->pointSet())[point_count]->evaluateObjectiveAndGradient(*quantities);
-        }
-        else {
-          evaluation_success = ((*quantities->pointSet())[point_count]->evaluateObjective(*quantities) && (*quantities->pointSet())[point_count]->evaluateGradient(*quantities));
-        }
+    // Declare evaluation success indicators
+    std::vector<bool> evaluation_success_batch;
 
-        // Check for successful evaluation
-        if (evaluation_success) {
+    // Evaluate objectives and gradients (as a batch)
+    if (quantities->evaluateFunctionWithGradient()) {
+      Point::evaluateObjectiveAndGradientBatch(points_in_radius, *quantities, evaluation_success_batch);
+    }
+    else {
+      std::vector<bool> objective_success_batch;
+      Point::evaluateGradientBatch(points_in_radius, *quantities, evaluation_success_batch);
+      Point::evaluateObjectiveBatch(points_in_radius, *quantities, objective_success_batch);
+      for (int point_count = 0; point_count < (int)points_in_radius.size(); point_count++) {
+        evaluation_success_batch[point_count] = (evaluation_success_batch[point_count] && objective_success_batch[point_count]);
+      }
+    } // end else
 
-          // Add pointer to gradient in point set to list
-          QP_gradient_list.push_back((*quantities->pointSet())[point_count]->gradient());
+    // Loop through points in stationarity radius
+    for (int point_count = 0; point_count < (int)points_in_radius.size(); point_count++) {
 
-          // Evaluate linearization and downshifting values
-          double linearization_value = (*quantities->pointSet())[point_count]->objective() + (*quantities->pointSet())[point_count]->gradient()->innerProduct(*quantities->currentIterate()->vector()) - (*quantities->pointSet())[point_count]->gradient()->innerProduct(*((*quantities->pointSet())[point_count])->vector());
-          double downshifting_value = quantities->currentIterate()->objective() - downshift_constant_ * pow(difference->norm2(), 2.0);
+      // Check for successful evaluation
+      if (evaluation_success_batch[point_count]) {
 
-          // Add linear term value based on cutting plane
-          QP_vector.push_back(fmin(linearization_value, downshifting_value));
+        // Add pointer to gradient in point set to list
+        QP_gradient_list.push_back(points_in_radius[point_count]->gradient());
 
-        } // end if
+        // Evaluate linearization and downshifting values
+        double linearization_value = points_in_radius[point_count]->objective() + points_in_radius[point_count]->gradient()->innerProduct(*quantities->currentIterate()->vector()) - points_in_radius[point_count]->gradient()->innerProduct(*points_in_radius[point_count]->vector());
+        double downshifting_value = quantities->currentIterate()->objective() - downshift_constant_ * pow(distances_in_radius[point_count], 2.0);
+
+        // Add linear term value based on cutting plane
+        QP_vector.push_back(fmin(linearization_value, downshifting_value));
 
       } // end if
 
     } // end for
 
+    // Check whether to add gradients of epsilon-active pieces
+    if (use_active_gradients_) {
+
+      // Declare piece values and gradients
+      std::vector<double> active_objectives;
+      std::vector<std::shared_ptr<Vector>> active_gradients;
+
+      // Evaluate epsilon-active pieces
+      if (quantities->currentIterate()->evaluateEpsilonActiveGradients(*quantities,
+                                                                      quantities->stationarityRadius() * quantities->currentIterate()->gradient()->norm2(),
+                                                                      active_gradients_maximum_,
+                                                                      active_objectives,
+                                                                      active_gradients)) {
+
+        // Loop through pieces
+        for (int piece_count = 0; piece_count < (int)active_gradients.size(); piece_count++) {
+
+          // Add pointer to piece gradient to list
+          QP_gradient_list.push_back(active_gradients[piece_count]);
+
+          // Add linear term value (piece value at current iterate)
+          QP_vector.push_back(active_objectives[piece_count]);
+
+        } // end for
+
+      } // end if
+
+    } // end if
+
+    // Merge duplicate gradients (recording entries set as QP data)
+    quantities->bundleCompressor()->clear();
+    quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
+
     // Set QP data
     strategies->qpSolver()->setVectorList(QP_gradient_list);
     strategies->qpSolver()->setVector(QP_vector);
@@ -310,6 +375,10 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
       // Add linear term value
       QP_vector.push_back(quantities->currentIterate()->objective());
 
+      // Merge duplicate gradients (recording entries set as QP data)
+      quantities->bundleCompressor()->clear();
+      quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
+
       // Set QP data
       strategies->qpSolver()->setVectorList(QP_gradient_list);
       strategies->qpSolver()->setVector(QP_vector);
@@ -366,9 +435,17 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
       // Check for CPU time limit
       if ((clock() - quantities->startTime()) / (double)CLOCKS_PER_SEC >= quantities->cpuTimeLimit()) {
         quantities->incrementDirectionComputationTime(clock() - start_time);
+        quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
         THROW_EXCEPTION(DC_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
       }
 
+      // Check for wall time limit
+      if (quantities->currentWallTime() - quantities->startWallTime() >= quantities->wallTimeLimit()) {
+        quantities->incrementDirectionComputationTime(clock() - start_time);
+        quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
+        THROW_EXCEPTION(DC_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+      }
+
       // Set aggregated data
       if (try_aggregation_ && !switched_to_full) {
 
@@ -558,12 +635,15 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
         strategies->qpSolver()->solveQP(options, reporter, quantities);
       } // end if
       else if (try_aggregation_ && !switched_to_full) {
+        quantities->bundleCompressor()->clear();
+        quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
         strategies->qpSolver()->setVectorList(QP_gradient_list);
         strategies->qpSolver()->setVector(QP_vector);
         strategies->qpSolver()->solveQP(options, reporter, quantities);
         switched_to_full = true;
       } // end else if
       else {
+        quantities->bundleCompressor()->compress(QP_gradient_list_new, QP_vector_new);
         strategies->qpSolver()->addData(QP_gradient_list_new, QP_vector_new);
         strategies->qpSolver()->solveQPHot(options, reporter, quantities);
       } // end else
@@ -589,6 +669,10 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
         // Add linear term value
         QP_vector.push_back(quantities->currentIterate()->objective());
 
+        // Merge duplicate gradients (recording entries set as QP data)
+        quantities->bundleCompressor()->clear();
+        quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
+
         // Set QP data
         strategies->qpSolver()->setVectorList(QP_gradient_list);
         strategies->qpSolver()->setVector(QP_vector);
@@ -615,6 +699,9 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
   } catch (DC_CPU_TIME_LIMIT_EXCEPTION& exec) {
     setStatus(DC_CPU_TIME_LIMIT);
     THROW_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+  } catch (DC_WALL_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(DC_WALL_TIME_LIMIT);
+    THROW_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
   } catch (DC_EVALUATION_FAILURE_EXCEPTION& exec) {
     setStatus(DC_EVALUATION_FAILURE);
   } catch (DC_ITERATION_LIMIT_EXCEPTION& exec) {
@@ -634,6 +721,7 @@ void DirectionComputationCuttingPlane::computeDirection(const Options* options,
 
   // Increment direction computation time
   quantities->incrementDirectionComputationTime(clock() - start_time);
+  quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
 
 } // end computeDirection
 
@@ -118,11 +118,13 @@ private:
   bool try_aggregation_;
   bool try_gradient_step_;
   bool try_shortened_step_;
+  bool use_active_gradients_;
   double aggregation_size_threshold_;
   double downshift_constant_;
   double gradient_stepsize_;
   double shortened_stepsize_;
   double step_acceptance_tolerance_;
+  int active_gradients_maximum_;
   int inner_iteration_limit_;
   //@}
 
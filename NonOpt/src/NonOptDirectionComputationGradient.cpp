@@ -66,6 +66,7 @@ void DirectionComputationGradient::computeDirection(const Options* options,
   quantities->resetQPIterationCounter();
   quantities->setTrialIterateToCurrentIterate();
   clock_t start_time = clock();
+  double start_wall_time = quantities->currentWallTime();
 
   // try direction computation, terminate on any exception
   try {
@@ -156,6 +157,7 @@ void DirectionComputationGradient::computeDirection(const Options* options,
 
   // Increment direction computation time
   quantities->incrementDirectionComputationTime(clock() - start_time);
+  quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
 
 } // end computeDirection
 
@@ -4,8 +4,11 @@
 //
 // Author(s) : Frank E. Curtis
 
+#include <algorithm>
 #include <cmath>
 #include <ctime>
+#include <exception>
+#include <thread>
 #include <vector>
 
 #include "NonOptDeclarations.hpp"
@@ -49,6 +52,13 @@ void DirectionComputationGradientCombination::addOptions(Options* options)
                          "              solver does not terminate after considering full QP step.\n"
                          "              Shortened stepsize set by DCGC_shortened_stepsize parameter.\n"
                          "Default     : true.");
+  options->addBoolOption("DCGC_use_active_gradients",
+                         false,
+                         "Determines whether to add gradients of epsilon-active pieces,\n"
+                         "              if provided by the problem, to the subproblem.  The\n"
+                         "              tolerance is the stationarity radius times the norm\n"
+                         "              of the current gradient.\n"
+                         "Default     : false.");
 
   // Add double options
   options->addDoubleOption("DCGC_aggregation_size_threshold",
@@ -102,12 +112,31 @@ void DirectionComputationGradientCombination::addOptions(Options* options)
                            "Default     : 1e-08.");
 
   // Add integer options
+  options->addIntegerOption("DCGC_active_gradients_maximum",
+                            100,
+                            1,
+                            NONOPT_INT_INFINITY,
+                            "Maximum number of gradients of epsilon-active pieces added to\n"
+                            "              the subproblem if DCGC_use_active_gradients == true.  If\n"
+                            "              more pieces are epsilon-active, then those with the\n"
+                            "              largest values are added.\n"
+                            "Default     : 100.");
   options->addIntegerOption("DCGC_inner_iteration_limit",
                             2,
                             0,
                             NONOPT_INT_INFINITY,
                             "Limit on the number of inner iterations that will be performed.\n"
                             "Default     : 2.");
+  options->addIntegerOption("DCGC_number_of_threads",
+                            1,
+                            1,
+                            NONOPT_INT_INFINITY,
+                            "Number of worker threads used to sample and evaluate random points.\n"
+                            "              If > 1, then the problem evaluation methods are called\n"
+                            "              concurrently, so they must be thread-safe.  Each thread uses\n"
+                            "              its own random number stream and sampled points are merged\n"
+                            "              in a deterministic order.\n"
+                            "Default     : 1.");
 
 } // end addOptions
 
@@ -122,6 +151,7 @@ void DirectionComputationGradientCombination::setOptions(Options* options)
   options->valueAsBool("DCGC_try_aggregation", try_aggregation_);
   options->valueAsBool("DCGC_try_gradient_step", try_gradient_step_);
   options->valueAsBool("DCGC_try_shortened_step", try_shortened_step_);
+  options->valueAsBool("DCGC_use_active_gradients", use_active_gradients_);
 
   // Read double options
   options->valueAsDouble("DCGC_aggregation_size_threshold", aggregation_size_threshold_);
@@ -132,7 +162,9 @@ void DirectionComputationGradientCombination::setOptions(Options* options)
   options->valueAsDouble("DCGC_step_acceptance_tolerance", step_acceptance_tolerance_);
 
   // Read integer options
+  options->valueAsInteger("DCGC_active_gradients_maximum", active_gradients_maximum_);
   options->valueAsInteger("DCGC_inner_iteration_limit", inner_iteration_limit_);
+  options->valueAsInteger("DCGC_number_of_threads", number_of_threads_);
 
 } // end setOptions
 
@@ -141,7 +173,19 @@ void DirectionComputationGradientCombination::initialize(const Options* options,
                                                          Quantities* quantities,
                                                          const Reporter* reporter)
 {
+
+  // Reset random number generator
   random_number_generator_.resetSeed();
+
+  // Set random number generators for worker threads
+  random_number_generators_thread_.clear();
+  if (number_of_threads_ > 1) {
+    for (int thread_count = 0; thread_count < number_of_threads_; thread_count++) {
+      random_number_generators_thread_.push_back(std::make_shared<RandomNumberGenerator>());
+      random_number_generators_thread_[thread_count]->resetSeed(thread_count + 1);
+    }
+  } // end if
+
 } // end initialize
 
 // Iteration header
@@ -170,6 +214,7 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
   quantities->resetQPIterationCounter();
   quantities->setTrialIterateToCurrentIterate();
   clock_t start_time = clock();
+  double start_wall_time = quantities->currentWallTime();
 
   // try direction computation, terminate on any exception
   try {
@@ -258,36 +303,83 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
 
     } // end if (try gradient step)
 
-    // Loop through point set
-    for (int point_count = 0; point_count < (int)quantities->pointSet()->size(); point_count++) {
+    // Declare points in stationarity radius and distances to current iterate
+    std::vector<std::shared_ptr<Point>> points_in_radius;
+    std::vector<double> distances_in_radius;
 
-      // Create difference vector
-      std::shared_ptr<Vector> difference = quantities->currentIterate()->vector()->makeNewLinearCombination(1.0, -1.0, *(*quantities->pointSet())[point_count]->vector());
+    // Find points within stationarity radius of current iterate
+    std::vector<int> indices_in_radius;
+    quantities->pointSet()->findPointsInRadius(*quantities->currentIterate()->vector(), quantities->stationarityRadius(), indices_in_radius, distances_in_radius);
 
-      // Check distance between point and current iterate
-      if (difference->normInf() <= quantities->stationarityRadius()) {
+    // Loop through points in stationarity radius
+    for (int point_count = 0; point_count < (int)indices_in_radius.size(); point_count++) {
+      points_in_radius.push_back((*quantities->pointSet())[indices_in_radius[point_count]]);
+    }
 
-        // Evaluate gradient
-        evaluation_success = (*quantities->pointSet())[point_count]->evaluateGradient(*quantities);
+    // Declare evaluation success indicators
+    std::vector<bool> evaluation_success_batch;
 
-        // Check for successful evaluation
-        if (evaluation_success) {
+    // Evaluate gradients (as a batch)
+    Point::evaluateGradientBatch(points_in_radius, *quantities, evaluation_success_batch);
 
-          // Add pointer to gradient in point set to list
-          QP_gradient_list.push_back((*quantities->pointSet())[point_count]->gradient());
+    // Loop through points in stationarity radius
+    for (int point_count = 0; point_count < (int)points_in_radius.size(); point_count++) {
 
-          // Evaluate downshifting value
-          double downshifting_value = quantities->currentIterate()->objective() - downshift_constant_ * pow(difference->norm2(), 2.0);
+      // Check for successful evaluation
+      if (evaluation_success_batch[point_count]) {
 
-          // Add linear term value
-          QP_vector.push_back(downshifting_value);
+        // Add pointer to gradient in point set to list
+        QP_gradient_list.push_back(points_in_radius[point_count]->gradient());
 
-        } // end if
+        // Evaluate downshifting value
+        double downshifting_value = quantities->currentIterate()->objective() - downshift_constant_ * pow(distances_in_radius[point_count], 2.0);
+
+        // Add linear term value
+        QP_vector.push_back(downshifting_value);
 
       } // end if
 
     } // end for
 
+    // Declare number of epsilon-active piece gradients added
+    int active_gradient_count = 0;
+
+    // Check whether to add gradients of epsilon-active pieces
+    if (use_active_gradients_) {
+
+      // Declare piece values and gradients
+      std::vector<double> active_objectives;
+      std::vector<std::shared_ptr<Vector>> active_gradients;
+
+      // Evaluate epsilon-active pieces
+      if (quantities->currentIterate()->evaluateEpsilonActiveGradients(*quantities,
+                                                                      quantities->stationarityRadius() * quantities->currentIterate()->gradient()->norm2(),
+                                                                      active_gradients_maximum_,
+                                                                      active_objectives,
+                                                                      active_gradients)) {
+
+        // Loop through pieces
+        for (int piece_count = 0; piece_count < (int)active_gradients.size(); piece_count++) {
+
+          // Add pointer to piece gradient to list
+          QP_gradient_list.push_back(active_gradients[piece_count]);
+
+          // Add linear term value (piece value at current iterate)
+          QP_vector.push_back(active_objectives[piece_count]);
+
+        } // end for
+
+        // Set number of piece gradients added
+        active_gradient_count = (int)active_gradients.size();
+
+      } // end if
+
+    } // end if
+
+    // Merge duplicate gradients (recording entries set as QP data)
+    quantities->bundleCompressor()->clear();
+    quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
+
     // Set QP data
     strategies->qpSolver()->setVectorList(QP_gradient_list);
     strategies->qpSolver()->setVector(QP_vector);
@@ -316,6 +408,10 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
       // Add linear term value
       QP_vector.push_back(quantities->currentIterate()->objective());
 
+      // Merge duplicate gradients (recording entries set as QP data)
+      quantities->bundleCompressor()->clear();
+      quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
+
       // Set QP data
       strategies->qpSolver()->setVectorList(QP_gradient_list);
       strategies->qpSolver()->setVector(QP_vector);
@@ -372,9 +468,17 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
       // Check for CPU time limit
       if ((clock() - quantities->startTime()) / (double)CLOCKS_PER_SEC >= quantities->cpuTimeLimit()) {
         quantities->incrementDirectionComputationTime(clock() - start_time);
+        quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
         THROW_EXCEPTION(DC_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
       }
 
+      // Check for wall time limit
+      if (quantities->currentWallTime() - quantities->startWallTime() >= quantities->wallTimeLimit()) {
+        quantities->incrementDirectionComputationTime(clock() - start_time);
+        quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
+        THROW_EXCEPTION(DC_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+      }
+
       // Set aggregated data
       if (try_aggregation_ && !switched_to_full) {
 
@@ -529,22 +633,49 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
         points_to_sample = (int)(random_sample_factor_ * (double)quantities->numberOfVariables());
       }
 
-      // Loop over number of points to sample
-      for (int point_count = 0; point_count < std::max(1, points_to_sample); point_count++) {
+      // Sample single point if gradients of epsilon-active pieces are in the subproblem
+      if (active_gradient_count > 0) {
+        points_to_sample = 1;
+      }
+
+      // Declare random points
+      std::vector<std::shared_ptr<Point>> random_points;
 
-        // Randomly generate new point
-        std::shared_ptr<Point> random_point = quantities->currentIterate()->makeNewRandom(quantities->stationarityRadius(), &random_number_generator_);
+      // Declare evaluation success indicators
+      std::vector<bool> evaluation_success_batch;
 
-        // Evaluate gradient at random point
+      // Check number of threads
+      if (number_of_threads_ > 1) {
+
+        // Sample and evaluate random points with worker threads
+        sampleRandomPointsParallel(std::max(1, points_to_sample), quantities, random_points, evaluation_success_batch);
+
+      } // end if
+      else {
+
+        // Loop over number of points to sample
+        for (int point_count = 0; point_count < std::max(1, points_to_sample); point_count++) {
+          random_points.push_back(quantities->currentIterate()->makeNewRandom(quantities->stationarityRadius(), &random_number_generator_));
+        }
+
+        // Evaluate gradients at random points (as a batch)
         if (quantities->evaluateFunctionWithGradient()) {
-          evaluation_success = random_point->evaluateObjectiveAndGradient(*quantities);
+          Point::evaluateObjectiveAndGradientBatch(random_points, *quantities, evaluation_success_batch);
         }
         else {
-          evaluation_success = random_point->evaluateGradient(*quantities);
+          Point::evaluateGradientBatch(random_points, *quantities, evaluation_success_batch);
         }
 
+      } // end else
+
+      // Loop over sampled points
+      for (int point_count = 0; point_count < (int)random_points.size(); point_count++) {
+
+        // Set random point
+        std::shared_ptr<Point> random_point = random_points[point_count];
+
         // Check for gradient successful evaluation
-        if (evaluation_success) {
+        if (evaluation_success_batch[point_count]) {
 
           // Add random point to point set
           quantities->pointSet()->push_back(random_point);
@@ -605,12 +736,15 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
         strategies->qpSolver()->solveQP(options, reporter, quantities);
       } // end if
       else if (try_aggregation_ && !switched_to_full) {
+        quantities->bundleCompressor()->clear();
+        quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
         strategies->qpSolver()->setVectorList(QP_gradient_list);
         strategies->qpSolver()->setVector(QP_vector);
         strategies->qpSolver()->solveQP(options, reporter, quantities);
         switched_to_full = true;
       } // end else if
       else {
+        quantities->bundleCompressor()->compress(QP_gradient_list_new, QP_vector_new);
         strategies->qpSolver()->addData(QP_gradient_list_new, QP_vector_new);
         strategies->qpSolver()->solveQPHot(options, reporter, quantities);
       } // end else
@@ -636,6 +770,10 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
         // Add linear term value
         QP_vector.push_back(quantities->currentIterate()->objective());
 
+        // Merge duplicate gradients (recording entries set as QP data)
+        quantities->bundleCompressor()->clear();
+        quantities->bundleCompressor()->compress(QP_gradient_list, QP_vector);
+
         // Set QP data
         strategies->qpSolver()->setVectorList(QP_gradient_list);
         strategies->qpSolver()->setVector(QP_vector);
@@ -662,6 +800,9 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
   } catch (DC_CPU_TIME_LIMIT_EXCEPTION& exec) {
     setStatus(DC_CPU_TIME_LIMIT);
     THROW_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+  } catch (DC_WALL_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(DC_WALL_TIME_LIMIT);
+    THROW_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
   } catch (DC_EVALUATION_FAILURE_EXCEPTION& exec) {
     setStatus(DC_EVALUATION_FAILURE);
   } catch (DC_ITERATION_LIMIT_EXCEPTION& exec) {
@@ -681,6 +822,7 @@ void DirectionComputationGradientCombination::computeDirection(const Options* op
 
   // Increment direction computation time
   quantities->incrementDirectionComputationTime(clock() - start_time);
+  quantities->incrementDirectionComputationWallTime(quantities->currentWallTime() - start_wall_time);
 
 } // end computeDirection
 
@@ -703,4 +845,77 @@ void DirectionComputationGradientCombination::convertQPSolutionToStep(Quantities
 
 } // end convertQPSolutionToStep
 
+// Sample and evaluate random points with worker threads
+void DirectionComputationGradientCombination::sampleRandomPointsParallel(int number_of_points,
+                                                                         Quantities* quantities,
+                                                                         std::vector<std::shared_ptr<Point>>& random_points,
+                                                                         std::vector<bool>& evaluation_success)
+{
+
+  // Set number of threads actually used
+  int number_of_threads = std::min(number_of_threads_, number_of_points);
+
+  // Initialize outputs
+  random_points.assign(number_of_points, nullptr);
+  evaluation_success.assign(number_of_points, false);
+
+  // Declare per-thread results (merged after join, so no shared writes)
+  std::vector<std::vector<bool>> evaluation_success_thread(number_of_threads);
+  std::vector<std::exception_ptr> exception_thread(number_of_threads);
+
+  // Declare worker threads
+  std::vector<std::thread> threads;
+
+  // Launch worker threads
+  for (int thread_count = 0; thread_count < number_of_threads; thread_count++) {
+    threads.push_back(std::thread([this, thread_count, number_of_threads, number_of_points, quantities, &random_points, &evaluation_success_thread, &exception_thread]() {
+
+      // try sampling and evaluation, store any exception for main thread
+      try {
+
+        // Declare points handled by this thread (indices thread_count, thread_count + number_of_threads, ...)
+        std::vector<std::shared_ptr<Point>> points_thread;
+
+        // Sample points using this thread's random number stream
+        for (int point_count = thread_count; point_count < number_of_points; point_count += number_of_threads) {
+          random_points[point_count] = quantities->currentIterate()->makeNewRandom(quantities->stationarityRadius(), random_number_generators_thread_[thread_count].get());
+          points_thread.push_back(random_points[point_count]);
+        } // end for
+
+        // Evaluate gradients at sampled points (as a batch)
+        if (quantities->evaluateFunctionWithGradient()) {
+          Point::evaluateObjectiveAndGradientBatch(points_thread, *quantities, evaluation_success_thread[thread_count]);
+        }
+        else {
+          Point::evaluateGradientBatch(points_thread, *quantities, evaluation_success_thread[thread_count]);
+        }
+
+      } // end try
+
+      // catch exceptions
+      catch (...) {
+        exception_thread[thread_count] = std::current_exception();
+      }
+    }));
+  } // end for
+
+  // Join worker threads
+  for (int thread_count = 0; thread_count < number_of_threads; thread_count++) {
+    threads[thread_count].join();
+  }
+
+  // Rethrow first exception (e.g., evaluation limit reached)
+  for (int thread_count = 0; thread_count < number_of_threads; thread_count++) {
+    if (exception_thread[thread_count]) {
+      std::rethrow_exception(exception_thread[thread_count]);
+    }
+  } // end for
+
+  // Merge evaluation success indicators in sample order
+  for (int point_count = 0; point_count < number_of_points; point_count++) {
+    evaluation_success[point_count] = evaluation_success_thread[point_count % number_of_threads][point_count / number_of_threads];
+  }
+
+} // end sampleRandomPointsParallel
+
 } // namespace NonOpt
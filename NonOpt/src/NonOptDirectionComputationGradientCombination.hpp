@@ -124,14 +124,18 @@ private:
   bool try_aggregation_;
   bool try_gradient_step_;
   bool try_shortened_step_;
+  bool use_active_gradients_;
   double aggregation_size_threshold_;
   double downshift_constant_;
   double gradient_stepsize_;
   double random_sample_factor_;
   double shortened_stepsize_;
   double step_acceptance_tolerance_;
+  int active_gradients_maximum_;
   int inner_iteration_limit_;
+  int number_of_threads_;
   RandomNumberGenerator random_number_generator_;
+  std::vector<std::shared_ptr<RandomNumberGenerator>> random_number_generators_thread_;
   //@}
 
   /** @name Private methods */
@@ -143,6 +147,17 @@ private:
    */
   void convertQPSolutionToStep(Quantities* quantities,
                                Strategies* strategies);
+  /**
+   * Samples random points around current iterate and evaluates them with worker threads
+   * \param[in] number_of_points is number of points to sample
+   * \param[in,out] quantities is pointer to Quantities object from NonOpt
+   * \param[out] random_points is vector of pointers to sampled Points, in sample order
+   * \param[out] evaluation_success is vector of evaluation success indicators, in sample order
+   */
+  void sampleRandomPointsParallel(int number_of_points,
+                                  Quantities* quantities,
+                                  std::vector<std::shared_ptr<Point>>& random_points,
+                                  std::vector<bool>& evaluation_success);
   //@}
 
 }; // end DirectionComputationGradientCombination
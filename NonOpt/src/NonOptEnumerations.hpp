@@ -38,7 +38,8 @@ enum NonOpt_Status
   NONOPT_PROBLEM_DATA_FAILURE,
   NONOPT_SYMMETRIC_MATRIX_ASSERT_FAILURE,
   NONOPT_TERMINATION_FAILURE,
-  NONOPT_VECTOR_ASSERT_FAILURE
+  NONOPT_VECTOR_ASSERT_FAILURE,
+  NONOPT_WALL_TIME_LIMIT
 };
 /**
  * Approximate Hessian update enumerations
@@ -70,7 +71,8 @@ enum DC_Status
   DC_CPU_TIME_LIMIT,
   DC_ITERATION_LIMIT,
   DC_EVALUATION_FAILURE,
-  DC_QP_FAILURE
+  DC_QP_FAILURE,
+  DC_WALL_TIME_LIMIT
 };
 /**
  * Line search enumerations
@@ -104,7 +106,8 @@ enum QP_Status
   QP_ITERATION_LIMIT,
   QP_FACTORIZATION_ERROR,
   QP_INPUT_ERROR,
-  QP_NAN_ERROR
+  QP_NAN_ERROR,
+  QP_WALL_TIME_LIMIT
 };
 /**
  * Report type enumerations
@@ -0,0 +1,324 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <cstring>
+
+#include "NonOptEvaluationCache.hpp"
+
+namespace NonOpt
+{
+
+// Constructor
+EvaluationCache::EvaluationCache()
+  : capacity_(0),
+    hit_counter_(0),
+    lookup_counter_(0) {}
+
+// Destructor
+EvaluationCache::~EvaluationCache() {}
+
+// Clear
+void EvaluationCache::clear()
+{
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Clear stored values and counters
+  entries_.clear();
+  index_.clear();
+  hit_counter_ = 0;
+  lookup_counter_ = 0;
+
+} // end clear
+
+// Set capacity
+void EvaluationCache::setCapacity(int capacity)
+{
+
+  // Set capacity
+  capacity_ = (capacity > 0) ? capacity : 0;
+
+  // Clear
+  clear();
+
+} // end setCapacity
+
+// Find objective
+bool EvaluationCache::findObjective(int n,
+                                    const double* x,
+                                    double& f)
+{
+
+  // Check for disabled cache
+  if (capacity_ == 0) {
+    return false;
+  }
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Increment lookup counter
+  lookup_counter_++;
+
+  // Find entry
+  Entry* entry = findEntry(n, x, hash(n, x));
+
+  // Check whether value is stored
+  if (entry == nullptr || !entry->objective_stored) {
+    return false;
+  }
+
+  // Set value
+  f = entry->objective;
+
+  // Increment hit counter
+  hit_counter_++;
+
+  // Return
+  return true;
+
+} // end findObjective
+
+// Find objective and gradient
+bool EvaluationCache::findObjectiveAndGradient(int n,
+                                               const double* x,
+                                               double& f,
+                                               double* g,
+                                               int& number_of_nonzeros,
+                                               int* indices)
+{
+
+  // Check for disabled cache
+  if (capacity_ == 0) {
+    return false;
+  }
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Increment lookup counter
+  lookup_counter_++;
+
+  // Find entry
+  Entry* entry = findEntry(n, x, hash(n, x));
+
+  // Check whether values are stored
+  if (entry == nullptr || !entry->objective_stored || !entry->gradient_stored) {
+    return false;
+  }
+
+  // Set values
+  f = entry->objective;
+  memcpy(g, entry->gradient.data(), n * sizeof(double));
+  setNonzeros(*entry, number_of_nonzeros, indices);
+
+  // Increment hit counter
+  hit_counter_++;
+
+  // Return
+  return true;
+
+} // end findObjectiveAndGradient
+
+// Find gradient
+bool EvaluationCache::findGradient(int n,
+                                   const double* x,
+                                   double* g,
+                                   int& number_of_nonzeros,
+                                   int* indices)
+{
+
+  // Check for disabled cache
+  if (capacity_ == 0) {
+    return false;
+  }
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Increment lookup counter
+  lookup_counter_++;
+
+  // Find entry
+  Entry* entry = findEntry(n, x, hash(n, x));
+
+  // Check whether value is stored
+  if (entry == nullptr || !entry->gradient_stored) {
+    return false;
+  }
+
+  // Set value
+  memcpy(g, entry->gradient.data(), n * sizeof(double));
+  setNonzeros(*entry, number_of_nonzeros, indices);
+
+  // Increment hit counter
+  hit_counter_++;
+
+  // Return
+  return true;
+
+} // end findGradient
+
+// Store objective
+void EvaluationCache::storeObjective(int n,
+                                     const double* x,
+                                     double f)
+{
+
+  // Check for disabled cache
+  if (capacity_ == 0) {
+    return;
+  }
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Store value
+  Entry& entry = storeEntry(n, x);
+  entry.objective = f;
+  entry.objective_stored = true;
+
+} // end storeObjective
+
+// Store gradient
+void EvaluationCache::storeGradient(int n,
+                                    const double* x,
+                                    const double* g,
+                                    int number_of_nonzeros,
+                                    const int* indices)
+{
+
+  // Check for disabled cache
+  if (capacity_ == 0) {
+    return;
+  }
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Store value
+  Entry& entry = storeEntry(n, x);
+  entry.gradient.assign(g, g + n);
+  entry.gradient_stored = true;
+  entry.gradient_nonzeros = number_of_nonzeros;
+  if (number_of_nonzeros >= 0) {
+    entry.indices.assign(indices, indices + number_of_nonzeros);
+  }
+  else {
+    entry.indices.clear();
+  }
+
+} // end storeGradient
+
+// Hash
+uint64_t EvaluationCache::hash(int n,
+                               const double* x)
+{
+
+  // Initialize hash (FNV-1a offset basis)
+  uint64_t value = 14695981039346656037ULL;
+
+  // Loop through bytes
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(x);
+  for (size_t i = 0; i < n * sizeof(double); i++) {
+    value ^= bytes[i];
+    value *= 1099511628211ULL;
+  } // end for
+
+  // Return
+  return value;
+
+} // end hash
+
+// Find entry
+EvaluationCache::Entry* EvaluationCache::findEntry(int n,
+                                                   const double* x,
+                                                   uint64_t key)
+{
+
+  // Find key
+  std::unordered_map<uint64_t, std::list<Entry>::iterator>::iterator position = index_.find(key);
+
+  // Check for key not found
+  if (position == index_.end()) {
+    return nullptr;
+  }
+
+  // Check for hash collision (point bytes must match exactly)
+  std::list<Entry>::iterator entry = position->second;
+  if ((int)entry->point.size() != n || memcmp(entry->point.data(), x, n * sizeof(double)) != 0) {
+    return nullptr;
+  }
+
+  // Move entry to front (most recently used)
+  entries_.splice(entries_.begin(), entries_, entry);
+
+  // Return
+  return &(*entry);
+
+} // end findEntry
+
+// Store entry
+EvaluationCache::Entry& EvaluationCache::storeEntry(int n,
+                                                    const double* x)
+{
+
+  // Determine key
+  uint64_t key = hash(n, x);
+
+  // Check for existing entry
+  Entry* existing = findEntry(n, x, key);
+  if (existing != nullptr) {
+    return *existing;
+  }
+
+  // Check for hash collision, in which case the colliding entry is replaced
+  std::unordered_map<uint64_t, std::list<Entry>::iterator>::iterator position = index_.find(key);
+  if (position != index_.end()) {
+    entries_.erase(position->second);
+    index_.erase(position);
+  }
+
+  // Evict least recently used entry if full
+  if ((int)entries_.size() >= capacity_) {
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+
+  // Create entry at front
+  entries_.push_front(Entry());
+  Entry& entry = entries_.front();
+  entry.key = key;
+  entry.point.assign(x, x + n);
+  entry.objective_stored = false;
+  entry.objective = 0.0;
+  entry.gradient_stored = false;
+  entry.gradient_nonzeros = -1;
+  index_[key] = entries_.begin();
+
+  // Return
+  return entry;
+
+} // end storeEntry
+
+// Set nonzeros
+void EvaluationCache::setNonzeros(const Entry& entry,
+                                  int& number_of_nonzeros,
+                                  int* indices)
+{
+
+  // Set number of nonzeros (unknown if indices not needed)
+  number_of_nonzeros = (indices != nullptr) ? entry.gradient_nonzeros : -1;
+
+  // Set indices
+  if (number_of_nonzeros > 0) {
+    memcpy(indices, entry.indices.data(), number_of_nonzeros * sizeof(int));
+  }
+
+} // end setNonzeros
+
+} // namespace NonOpt
@@ -0,0 +1,243 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTEVALUATIONCACHE_HPP__
+#define __NONOPTEVALUATIONCACHE_HPP__
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NonOpt
+{
+
+/**
+ * EvaluationCache class
+ * (Bounded least-recently-used store of unscaled objective and gradient values,
+ *  with gradient nonzero indices when known, keyed by the exact bytes of the
+ *  point at which they were evaluated.)
+ */
+class EvaluationCache
+{
+
+public:
+  /** @name Constructors */
+  //@{
+  /**
+   * Declare EvaluationCache (disabled, i.e., with zero capacity)
+   */
+  EvaluationCache();
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Delete data
+   */
+  ~EvaluationCache();
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Capacity
+   * \return maximum number of points stored (zero means caching is disabled)
+   */
+  inline int const capacity() const { return capacity_; };
+  /**
+   * Hit counter
+   * \return number of lookups that returned stored values
+   */
+  inline int const hitCounter() const { return hit_counter_; };
+  /**
+   * Hit rate
+   * \return fraction of lookups that returned stored values
+   */
+  inline double const hitRate() const { return (lookup_counter_ > 0) ? hit_counter_ / (double)lookup_counter_ : 0.0; };
+  /**
+   * Lookup counter
+   * \return number of lookups performed
+   */
+  inline int const lookupCounter() const { return lookup_counter_; };
+  /**
+   * Size
+   * \return number of points currently stored
+   */
+  inline int const size() const { return (int)entries_.size(); };
+  //@}
+
+  /** @name Set methods */
+  //@{
+  /**
+   * Clear stored values and counters
+   */
+  void clear();
+  /**
+   * Set capacity (and clear stored values and counters)
+   * \param[in] capacity is maximum number of points to store
+   */
+  void setCapacity(int capacity);
+  //@}
+
+  /** @name Find methods */
+  //@{
+  /**
+   * Find objective value
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[out] f is the stored objective value at "x", a double (return value)
+   * \return indicator of whether value was found
+   */
+  bool findObjective(int n,
+                     const double* x,
+                     double& f);
+  /**
+   * Find objective and gradient values
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[out] f is the stored objective value at "x", a double (return value)
+   * \param[out] g is the stored gradient value at "x", a double array (return value)
+   * \param[out] number_of_nonzeros is the stored number of gradient nonzeros at "x", or -1 if none stored, an integer (return value)
+   * \param[out] indices is the stored gradient nonzero indices at "x", an integer array with space for n entries, or nullptr if not needed (return value)
+   * \return indicator of whether both values were found
+   */
+  bool findObjectiveAndGradient(int n,
+                                const double* x,
+                                double& f,
+                                double* g,
+                                int& number_of_nonzeros,
+                                int* indices);
+  /**
+   * Find gradient value
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[out] g is the stored gradient value at "x", a double array (return value)
+   * \param[out] number_of_nonzeros is the stored number of gradient nonzeros at "x", or -1 if none stored, an integer (return value)
+   * \param[out] indices is the stored gradient nonzero indices at "x", an integer array with space for n entries, or nullptr if not needed (return value)
+   * \return indicator of whether value was found
+   */
+  bool findGradient(int n,
+                    const double* x,
+                    double* g,
+                    int& number_of_nonzeros,
+                    int* indices);
+  //@}
+
+  /** @name Store methods */
+  //@{
+  /**
+   * Store objective value
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[in] f is the objective value at "x", a constant double
+   */
+  void storeObjective(int n,
+                      const double* x,
+                      double f);
+  /**
+   * Store gradient value
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[in] g is the gradient value at "x", a constant double array
+   * \param[in] number_of_nonzeros is the number of gradient nonzeros at "x" (as given by the problem's sparse gradient method), or -1 if not known, a constant integer
+   * \param[in] indices is the gradient nonzero indices at "x", a constant integer array (ignored if "number_of_nonzeros" is -1)
+   */
+  void storeGradient(int n,
+                     const double* x,
+                     const double* g,
+                     int number_of_nonzeros,
+                     const int* indices);
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  EvaluationCache(const EvaluationCache&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const EvaluationCache&);
+  //@}
+
+  /** @name Private types */
+  //@{
+  /**
+   * Stored values at a point
+   */
+  struct Entry
+  {
+    uint64_t key;                 /**< Hash of point bytes */
+    std::vector<double> point;    /**< Point */
+    bool objective_stored;        /**< Indicator of whether objective is stored */
+    double objective;             /**< Objective value (unscaled) */
+    bool gradient_stored;         /**< Indicator of whether gradient is stored */
+    std::vector<double> gradient; /**< Gradient value (unscaled) */
+    int gradient_nonzeros;        /**< Number of gradient nonzeros (-1 if not known) */
+    std::vector<int> indices;     /**< Gradient nonzero indices (increasing) */
+  };
+  //@}
+
+  /** @name Private methods */
+  //@{
+  /**
+   * Hash bytes of point
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \return 64-bit FNV-1a hash of the bytes of "x"
+   */
+  static uint64_t hash(int n,
+                       const double* x);
+  /**
+   * Find entry for point, moving it to the front of the recency list
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[in] key is hash of "x"
+   * \return pointer to entry, or nullptr if not found
+   */
+  Entry* findEntry(int n,
+                   const double* x,
+                   uint64_t key);
+  /**
+   * Find or create entry for point, evicting least recently used entry if full
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \return reference to entry
+   */
+  Entry& storeEntry(int n,
+                    const double* x);
+  /**
+   * Set gradient nonzeros from entry
+   * \param[in] entry is entry with stored gradient
+   * \param[out] number_of_nonzeros is the stored number of gradient nonzeros, or -1 if none stored or "indices" is nullptr, an integer (return value)
+   * \param[out] indices is the stored gradient nonzero indices, an integer array, or nullptr if not needed (return value)
+   */
+  static void setNonzeros(const Entry& entry,
+                          int& number_of_nonzeros,
+                          int* indices);
+  //@}
+
+  /** @name Private members */
+  //@{
+  int capacity_;
+  int hit_counter_;
+  int lookup_counter_;
+  std::list<Entry> entries_;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+  std::mutex mutex_;
+  //@}
+
+}; // end EvaluationCache
+
+} // namespace NonOpt
+
+#endif /* __NONOPTEVALUATIONCACHE_HPP__ */
@@ -138,6 +138,7 @@ void LineSearchWeakWolfe::runLineSearch(const Options* options,
   setStatus(LS_UNSET);
   quantities->setTrialIterateToCurrentIterate();
   clock_t start_time = clock();
+  double start_wall_time = quantities->currentWallTime();
 
   // try line search, terminate on any exception
   try {
@@ -311,6 +312,7 @@ void LineSearchWeakWolfe::runLineSearch(const Options* options,
 
   // Increment line search time
   quantities->incrementLineSearchTime(clock() - start_time);
+  quantities->incrementLineSearchWallTime(quantities->currentWallTime() - start_wall_time);
 
 } // end runLineSearch
 
@@ -0,0 +1,92 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <new>
+
+#include "NonOptMemoryPool.hpp"
+
+namespace NonOpt
+{
+
+// Constructor
+MemoryPool::MemoryPool(int capacity)
+  : capacity_((capacity > 0) ? capacity : 0),
+    allocation_counter_(0),
+    reuse_counter_(0) {}
+
+// Destructor
+MemoryPool::~MemoryPool()
+{
+
+  // Release free blocks
+  for (std::unordered_map<size_t, std::vector<void*>>::iterator it = free_blocks_.begin(); it != free_blocks_.end(); it++) {
+    for (int i = 0; i < (int)it->second.size(); i++) {
+      ::operator delete(it->second[i]);
+    }
+  } // end for
+
+} // end destructor
+
+// Reset counters
+void MemoryPool::resetCounters()
+{
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Reset counters
+  allocation_counter_ = 0;
+  reuse_counter_ = 0;
+
+} // end resetCounters
+
+// Allocate block
+void* MemoryPool::allocate(size_t bytes)
+{
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Check for free block of given size
+  std::vector<void*>& free_blocks = free_blocks_[bytes];
+  if (!free_blocks.empty()) {
+    void* block = free_blocks.back();
+    free_blocks.pop_back();
+    reuse_counter_++;
+    return block;
+  } // end if
+
+  // Allocate new block
+  allocation_counter_++;
+  return ::operator new(bytes);
+
+} // end allocate
+
+// Deallocate block
+void MemoryPool::deallocate(void* block,
+                            size_t bytes)
+{
+
+  // Check for null
+  if (block == nullptr) {
+    return;
+  }
+
+  // Lock
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Retain block if capacity allows, else release it
+  std::vector<void*>& free_blocks = free_blocks_[bytes];
+  if ((int)free_blocks.size() < capacity_) {
+    free_blocks.push_back(block);
+  }
+  else {
+    ::operator delete(block);
+  }
+
+} // end deallocate
+
+} // namespace NonOpt
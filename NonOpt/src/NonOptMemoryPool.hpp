@@ -0,0 +1,216 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTMEMORYPOOL_HPP__
+#define __NONOPTMEMORYPOOL_HPP__
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NonOpt
+{
+
+/**
+ * MemoryPool class
+ * (Recycles fixed-size blocks, e.g., Vector value arrays and Point objects,
+ *  instead of returning them to the system allocator.)
+ */
+class MemoryPool
+{
+
+public:
+  /** @name Constructors */
+  //@{
+  /**
+   * Declare MemoryPool
+   * \param[in] capacity is maximum number of free blocks retained per block size
+   */
+  MemoryPool(int capacity);
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Delete data (free blocks are released to the system)
+   */
+  ~MemoryPool();
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Allocation counter
+   * \return number of blocks obtained from the system allocator
+   */
+  inline int const allocationCounter() const { return allocation_counter_; };
+  /**
+   * Capacity
+   * \return maximum number of free blocks retained per block size
+   */
+  inline int const capacity() const { return capacity_; };
+  /**
+   * Reuse counter
+   * \return number of blocks served from free blocks
+   */
+  inline int const reuseCounter() const { return reuse_counter_; };
+  //@}
+
+  /** @name Set methods */
+  //@{
+  /**
+   * Reset counters
+   */
+  void resetCounters();
+  //@}
+
+  /** @name Allocate methods */
+  //@{
+  /**
+   * Allocate block
+   * \param[in] bytes is size of block
+   * \return pointer to block
+   */
+  void* allocate(size_t bytes);
+  /**
+   * Deallocate block (retained for reuse if capacity allows)
+   * \param[in] block is pointer to block obtained from allocate
+   * \param[in] bytes is size of block
+   */
+  void deallocate(void* block,
+                  size_t bytes);
+  /**
+   * Allocate array of doubles
+   * \param[in] length is length of array
+   * \return pointer to array
+   */
+  inline double* allocateValues(int length) { return static_cast<double*>(allocate(length * sizeof(double))); };
+  /**
+   * Deallocate array of doubles
+   * \param[in] values is pointer to array obtained from allocateValues
+   * \param[in] length is length of array
+   */
+  inline void deallocateValues(double* values,
+                               int length) { deallocate(values, length * sizeof(double)); };
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  MemoryPool(const MemoryPool&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const MemoryPool&);
+  //@}
+
+  /** @name Private members */
+  //@{
+  int capacity_;
+  int allocation_counter_;
+  int reuse_counter_;
+  std::unordered_map<size_t, std::vector<void*>> free_blocks_;
+  std::mutex mutex_;
+  //@}
+
+}; // end MemoryPool
+
+/**
+ * PoolAllocator class
+ * (Standard allocator drawing from a MemoryPool, for use with std::allocate_shared,
+ *  so that an object and its shared_ptr control block are recycled together.)
+ */
+template <class T>
+class PoolAllocator
+{
+
+public:
+  /**
+   * Value type
+   */
+  typedef T value_type;
+
+  /** @name Constructors */
+  //@{
+  /**
+   * Declare PoolAllocator
+   * \param[in] pool is pointer to MemoryPool
+   */
+  PoolAllocator(std::shared_ptr<MemoryPool> pool)
+    : pool_(pool){};
+  /**
+   * Declare PoolAllocator from allocator for another type
+   * \param[in] other is allocator for another type
+   */
+  template <class U>
+  PoolAllocator(const PoolAllocator<U>& other)
+    : pool_(other.pool()){};
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Get pointer to MemoryPool
+   * \return pointer to MemoryPool
+   */
+  inline std::shared_ptr<MemoryPool> pool() const { return pool_; };
+  //@}
+
+  /** @name Allocate methods */
+  //@{
+  /**
+   * Allocate objects
+   * \param[in] number is number of objects
+   * \return pointer to (uninitialized) objects
+   */
+  inline T* allocate(size_t number) { return static_cast<T*>(pool_->allocate(number * sizeof(T))); };
+  /**
+   * Deallocate objects
+   * \param[in] objects is pointer to objects
+   * \param[in] number is number of objects
+   */
+  inline void deallocate(T* objects,
+                         size_t number) { pool_->deallocate(objects, number * sizeof(T)); };
+  //@}
+
+private:
+  /** @name Private members */
+  //@{
+  std::shared_ptr<MemoryPool> pool_;
+  //@}
+
+}; // end PoolAllocator
+
+/**
+ * Equality of PoolAllocators (same MemoryPool)
+ */
+template <class T, class U>
+inline bool operator==(const PoolAllocator<T>& a,
+                       const PoolAllocator<U>& b)
+{
+  return a.pool() == b.pool();
+}
+
+/**
+ * Inequality of PoolAllocators
+ */
+template <class T, class U>
+inline bool operator!=(const PoolAllocator<T>& a,
+                       const PoolAllocator<U>& b)
+{
+  return a.pool() != b.pool();
+}
+
+} // namespace NonOpt
+
+#endif /* __NONOPTMEMORYPOOL_HPP__ */
@@ -4,8 +4,10 @@
 //
 // Author(s) : Frank E. Curtis
 
+#include <algorithm>
 #include <cmath>
 
+#include "NonOptBLASLAPACK.hpp"
 #include "NonOptPoint.hpp"
 
 namespace NonOpt
@@ -21,14 +23,8 @@ Point::Point(std::shared_ptr<Problem> problem,
     problem_(problem)
 {
 
-  // Declare new vector
-  std::shared_ptr<Vector> new_vector(new Vector(vector->length()));
-
-  // Set point's vector
-  vector_ = new_vector;
-
-  // Copy values to point's vector
-  vector_->copy(*vector);
+  // Set point's vector as copy (drawn from same pool, if any)
+  vector_ = vector->makeNewCopy();
 
   // Set gradient pointer to null
   gradient_.reset();
@@ -51,11 +47,8 @@ std::shared_ptr<Point> Point::makeNewLinearCombination(double scalar1,
   // Create new Vector
   std::shared_ptr<Vector> new_vector = vector_->makeNewLinearCombination(scalar1, scalar2, other_vector);
 
-  // Create new Point
-  std::shared_ptr<Point> new_point(new Point(problem_, new_vector, scale_));
-
-  // Return
-  return new_point;
+  // Return new Point
+  return makeNewWithVector(new_vector);
 
 } // end makeNewLinearCombination
 
@@ -64,37 +57,42 @@ std::shared_ptr<Point> Point::makeNewRandom(double epsilon,
                                             RandomNumberGenerator* random_number_generator) const
 {
 
-  // Create new array and Vector
-  double* random_direction_array = new double[vector_->length()];
-  Vector random_direction(vector_->length());
+  // Create new Vector (drawn from same pool, if any)
+  std::shared_ptr<Vector> random_direction = vector_->makeNewOfSameLength();
 
   // Loop through elements
+  double* random_direction_values = random_direction->valuesModifiable();
   for (int i = 0; i < vector_->length(); i++) {
-    random_direction_array[i] = random_number_generator->generateStandardNormal();
+    random_direction_values[i] = random_number_generator->generateStandardNormal();
   }
 
-  // Copy array
-  random_direction.copyArray(random_direction_array);
-
-  // Delete array
-  if (random_direction_array != nullptr) {
-    delete[] random_direction_array;
-    random_direction_array = nullptr;
-  } // end if
-
   // Compute scalar
-  double scalar = epsilon * pow(rand() / double(RAND_MAX), 1.0 / ((double)vector_->length())) * (1.0 / random_direction.norm2());
+  double scalar = epsilon * pow(random_number_generator->generateUniform(), 1.0 / ((double)vector_->length())) * (1.0 / random_direction->norm2());
 
   // Create new Vector
-  std::shared_ptr<Vector> new_vector = vector_->makeNewLinearCombination(1.0, scalar, random_direction);
+  std::shared_ptr<Vector> new_vector = vector_->makeNewLinearCombination(1.0, scalar, *random_direction);
+
+  // Return new Point
+  return makeNewWithVector(new_vector);
+
+} // end makeNewRandom
+
+// Make new Point with given Vector
+std::shared_ptr<Point> Point::makeNewWithVector(std::shared_ptr<Vector> vector) const
+{
+
+  // Check for pool
+  if (vector->pool()) {
+    return std::allocate_shared<Point>(PoolAllocator<Point>(vector->pool()), problem_, vector, scale_);
+  }
 
   // Create new Point
-  std::shared_ptr<Point> new_point(new Point(problem_, new_vector, scale_));
+  std::shared_ptr<Point> new_point(new Point(problem_, vector, scale_));
 
   // Return
   return new_point;
 
-} // end makeNewRandom
+} // end makeNewWithVector
 
 // Determine scale
 void Point::determineScale(Quantities& quantities)
@@ -117,14 +115,35 @@ bool Point::evaluateObjective(Quantities& quantities)
   // Check if objective has been evaluated already
   if (!objective_evaluated_) {
 
+    // Check evaluation cache
+    if (quantities.evaluationCache()->findObjective(vector_->length(), vector_->values(), objective_)) {
+
+      // Set indicator
+      objective_evaluated_ = true;
+
+      // Scale
+      objective_ = scale_ * objective_;
+
+      // Return
+      return objective_evaluated_;
+
+    } // end if
+
     // Set evaluation start time as current time
     clock_t start_time = clock();
+    double start_wall_time = quantities.currentWallTime();
 
     // Evaluate objective value for problem
     objective_evaluated_ = problem_->evaluateObjective(vector_->length(), vector_->values(), objective_);
 
     // Increment evaluation time
     quantities.incrementEvaluationTime(clock() - start_time);
+    quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+    // Store in evaluation cache
+    if (objective_evaluated_) {
+      quantities.evaluationCache()->storeObjective(vector_->length(), vector_->values(), objective_);
+    }
 
     // Scale
     objective_ = scale_ * objective_;
@@ -152,20 +171,63 @@ bool Point::evaluateObjectiveAndGradient(Quantities& quantities)
   if (!objective_evaluated_ || !gradient_evaluated_) {
 
     // Declare gradient vector
-    std::shared_ptr<Vector> gradient(new Vector(vector_->length()));
+    std::shared_ptr<Vector> gradient = vector_->makeNewOfSameLength();
 
     // Set gradient vector
     gradient_ = gradient;
 
+    // Declare gradient nonzeros (indices only needed if gradients are treated as sparse)
+    int n = vector_->length();
+    int nnz = -1;
+    int* indices = (quantities.gradientSparsityThreshold() > 0.0) ? quantities.sparseGradientIndices(n) : nullptr;
+
+    // Check evaluation cache
+    if (quantities.evaluationCache()->findObjectiveAndGradient(n, vector_->values(), objective_, gradient_->valuesModifiable(), nnz, indices)) {
+
+      // Set indicators
+      objective_evaluated_ = true;
+      gradient_evaluated_ = true;
+
+      // Scale
+      objective_ = scale_ * objective_;
+      gradient_->scale(scale_);
+
+      // Determine sparsity
+      determineGradientSparsity(quantities, nnz, indices);
+
+      // Return
+      return (objective_evaluated_ && gradient_evaluated_);
+
+    } // end if
+
     // Set evaluation start time as current time
     clock_t start_time = clock();
-
-    // Evaluate objective value for problem
-    objective_evaluated_ = problem_->evaluateObjectiveAndGradient(vector_->length(), vector_->values(), objective_, gradient_->valuesModifiable());
+    double start_wall_time = quantities.currentWallTime();
+
+    // Evaluate objective value for problem (with gradient in sparse form if gradients are treated as sparse)
+    if (indices != nullptr) {
+      objective_evaluated_ = problem_->evaluateObjectiveAndGradientSparse(n, vector_->values(), objective_, nnz, indices, gradient_->valuesModifiable());
+      if (objective_evaluated_) {
+        expandNonzeros(n, nnz, indices, gradient_->valuesModifiable());
+      }
+      else {
+        nnz = -1;
+      }
+    } // end if
+    else {
+      objective_evaluated_ = problem_->evaluateObjectiveAndGradient(n, vector_->values(), objective_, gradient_->valuesModifiable());
+    }
     gradient_evaluated_ = objective_evaluated_;
 
     // Increment evaluation time
     quantities.incrementEvaluationTime(clock() - start_time);
+    quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+    // Store in evaluation cache
+    if (objective_evaluated_) {
+      quantities.evaluationCache()->storeObjective(n, vector_->values(), objective_);
+      quantities.evaluationCache()->storeGradient(n, vector_->values(), gradient_->values(), nnz, indices);
+    }
 
     // Scale
     objective_ = scale_ * objective_;
@@ -173,6 +235,9 @@ bool Point::evaluateObjectiveAndGradient(Quantities& quantities)
     // Scale
     gradient_->scale(scale_);
 
+    // Determine sparsity
+    determineGradientSparsity(quantities, nnz, indices);
+
     // Increment function evaluation counter
     quantities.incrementFunctionCounter();
 
@@ -204,23 +269,66 @@ bool Point::evaluateGradient(Quantities& quantities)
   if (!gradient_evaluated_) {
 
     // Declare gradient vector
-    std::shared_ptr<Vector> gradient(new Vector(vector_->length()));
+    std::shared_ptr<Vector> gradient = vector_->makeNewOfSameLength();
 
     // Set gradient vector
     gradient_ = gradient;
 
+    // Declare gradient nonzeros (indices only needed if gradients are treated as sparse)
+    int n = vector_->length();
+    int nnz = -1;
+    int* indices = (quantities.gradientSparsityThreshold() > 0.0) ? quantities.sparseGradientIndices(n) : nullptr;
+
+    // Check evaluation cache
+    if (quantities.evaluationCache()->findGradient(n, vector_->values(), gradient_->valuesModifiable(), nnz, indices)) {
+
+      // Set indicator
+      gradient_evaluated_ = true;
+
+      // Scale
+      gradient_->scale(scale_);
+
+      // Determine sparsity
+      determineGradientSparsity(quantities, nnz, indices);
+
+      // Return
+      return gradient_evaluated_;
+
+    } // end if
+
     // Set evaluation start time as current time
     clock_t start_time = clock();
-
-    // Evaluate gradient value
-    gradient_evaluated_ = problem_->evaluateGradient(vector_->length(), vector_->values(), gradient_->valuesModifiable());
+    double start_wall_time = quantities.currentWallTime();
+
+    // Evaluate gradient value (in sparse form if gradients are treated as sparse)
+    if (indices != nullptr) {
+      gradient_evaluated_ = problem_->evaluateGradientSparse(n, vector_->values(), nnz, indices, gradient_->valuesModifiable());
+      if (gradient_evaluated_) {
+        expandNonzeros(n, nnz, indices, gradient_->valuesModifiable());
+      }
+      else {
+        nnz = -1;
+      }
+    } // end if
+    else {
+      gradient_evaluated_ = problem_->evaluateGradient(n, vector_->values(), gradient_->valuesModifiable());
+    }
 
     // Increment evaluation time
     quantities.incrementEvaluationTime(clock() - start_time);
+    quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+    // Store in evaluation cache
+    if (gradient_evaluated_) {
+      quantities.evaluationCache()->storeGradient(n, vector_->values(), gradient_->values(), nnz, indices);
+    }
 
     // Scale
     gradient_->scale(scale_);
 
+    // Determine sparsity
+    determineGradientSparsity(quantities, nnz, indices);
+
     // Increment gradient evaluation counter
     quantities.incrementGradientCounter();
 
@@ -236,4 +344,467 @@ bool Point::evaluateGradient(Quantities& quantities)
 
 } // end evaluateGradient
 
+// Expand nonzeros
+void Point::expandNonzeros(int n,
+                           int nnz,
+                           const int* indices,
+                           double* values)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(nnz >= 0 && nnz <= n, NONOPT_GRADIENT_EVALUATION_ASSERT_FAILURE_EXCEPTION, "Number of gradient nonzeros is invalid.");
+
+  // Expand nonzeros in place, from last to first (so, since indices are increasing, none is overwritten before it is moved)
+  int end = n;
+  for (int k = nnz - 1; k >= 0; k--) {
+    ASSERT_EXCEPTION(indices[k] >= k && indices[k] < end, NONOPT_GRADIENT_EVALUATION_ASSERT_FAILURE_EXCEPTION, "Gradient nonzero indices are not increasing.");
+    double value = values[k];
+    std::fill(&values[indices[k] + 1], &values[end], 0.0);
+    values[indices[k]] = value;
+    end = indices[k];
+  } // end for
+  std::fill(values, &values[end], 0.0);
+
+} // end expandNonzeros
+
+// Determine gradient sparsity
+void Point::determineGradientSparsity(Quantities& quantities,
+                                      int nnz,
+                                      const int* indices)
+{
+
+  // Check whether gradients are treated as sparse
+  if (quantities.gradientSparsityThreshold() <= 0.0) {
+    return;
+  }
+
+  // Keep given nonzero indices if sufficiently sparse, otherwise scan values
+  if (nnz >= 0) {
+    if ((double)nnz <= quantities.gradientSparsityThreshold() * (double)gradient_->length()) {
+      gradient_->setNonzeroIndices(nnz, indices);
+    }
+  } // end if
+  else {
+    gradient_->determineNonzeroIndices(quantities.gradientSparsityThreshold());
+  }
+
+} // end determineGradientSparsity
+
+// Evaluate values and gradients of epsilon-active pieces
+bool Point::evaluateEpsilonActiveGradients(Quantities& quantities,
+                                           double epsilon,
+                                           int maximum,
+                                           std::vector<double>& objectives,
+                                           std::vector<std::shared_ptr<Vector>>& gradients)
+{
+
+  // Clear outputs
+  objectives.clear();
+  gradients.clear();
+
+  // Declare piece arrays
+  int n = vector_->length();
+  int m = 0;
+  std::vector<double> F;
+  std::vector<double> G;
+
+  // Set evaluation start time as current time
+  clock_t start_time = clock();
+  double start_wall_time = quantities.currentWallTime();
+
+  // Evaluate pieces (with unscaled tolerance)
+  bool evaluation_success = problem_->evaluateEpsilonActiveGradients(n, vector_->values(), epsilon / scale_, maximum, m, F, G);
+
+  // Increment evaluation time
+  quantities.incrementEvaluationTime(clock() - start_time);
+  quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+  // Check for unsupported or failed evaluation
+  if (!evaluation_success || m <= 0 || m > maximum || (int)F.size() < m || G.size() < (size_t)n * m) {
+    return false;
+  }
+
+  // Increment gradient evaluation counter
+  quantities.incrementGradientCounter();
+
+  // Set (scaled) values and gradients
+  for (int j = 0; j < m; j++) {
+    objectives.push_back(scale_ * F[j]);
+    std::shared_ptr<Vector> gradient = vector_->makeNewOfSameLength();
+    gradient->copyArray(&G[(size_t)j * n]);
+    gradient->scale(scale_);
+    if (quantities.gradientSparsityThreshold() > 0.0) {
+      gradient->determineNonzeroIndices(quantities.gradientSparsityThreshold());
+    }
+    gradients.push_back(gradient);
+  } // end for
+
+  // Check for gradient evaluation limit
+  if (quantities.gradientCounter() >= quantities.gradientEvaluationLimit()) {
+    THROW_EXCEPTION(NONOPT_GRADIENT_EVALUATION_LIMIT_EXCEPTION, "Gradient evaluation limit reached.");
+  }
+
+  // Return
+  return true;
+
+} // end evaluateEpsilonActiveGradients
+
+// Evaluate objectives for a batch of points
+bool Point::evaluateObjectiveBatch(const std::vector<std::shared_ptr<Point>>& points,
+                                   Quantities& quantities,
+                                   std::vector<bool>& success)
+{
+
+  // Initialize success indicators
+  success.assign(points.size(), true);
+
+  // Collect indices of points that need evaluation (setting values found in evaluation cache)
+  std::vector<int> pending;
+  for (int j = 0; j < (int)points.size(); j++) {
+    Point* point = points[j].get();
+    if (!point->objective_evaluated_) {
+      if (quantities.evaluationCache()->findObjective(point->vector_->length(), point->vector_->values(), point->objective_)) {
+        point->objective_evaluated_ = true;
+        point->objective_ = point->scale_ * point->objective_;
+      }
+      else {
+        pending.push_back(j);
+      }
+    } // end if
+  }   // end for
+
+  // Check for nothing to evaluate
+  if (pending.size() == 0) {
+    return true;
+  }
+
+  // Set sizes
+  int n = points[pending[0]]->vector_->length();
+  int m = (int)pending.size();
+
+  // Declare batch arrays
+  double* X = new double[n * m];
+  double* F = new double[m];
+  bool* batch_success = new bool[m];
+
+  // Set inputs for BLASLAPACK
+  int increment = 1;
+
+  // Gather points
+  for (int k = 0; k < m; k++) {
+    dcopy_(&n, points[pending[k]]->vector_->values(), &increment, &X[k * n], &increment);
+  }
+
+  // Set evaluation start time as current time
+  clock_t start_time = clock();
+  double start_wall_time = quantities.currentWallTime();
+
+  // Evaluate objectives for problem
+  points[pending[0]]->problem_->evaluateObjectiveBatch(n, m, X, F, batch_success);
+
+  // Increment evaluation time
+  quantities.incrementEvaluationTime(clock() - start_time);
+  quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+  // Scatter values
+  for (int k = 0; k < m; k++) {
+
+    // Set point
+    Point* point = points[pending[k]].get();
+
+    // Copy value
+    point->objective_ = point->scale_ * F[k];
+    point->objective_evaluated_ = batch_success[k];
+
+    // Store in evaluation cache
+    if (batch_success[k]) {
+      quantities.evaluationCache()->storeObjective(n, &X[k * n], F[k]);
+    }
+
+    // Set success indicator
+    success[pending[k]] = batch_success[k];
+
+    // Increment function evaluation counter
+    quantities.incrementFunctionCounter();
+
+  } // end for
+
+  // Delete arrays
+  delete[] X;
+  delete[] F;
+  delete[] batch_success;
+
+  // Check for function evaluation limit
+  if (quantities.functionCounter() >= quantities.functionEvaluationLimit()) {
+    THROW_EXCEPTION(NONOPT_FUNCTION_EVALUATION_LIMIT_EXCEPTION, "Function evaluation limit reached.");
+  }
+
+  // Return
+  return (std::find(success.begin(), success.end(), false) == success.end());
+
+} // end evaluateObjectiveBatch
+
+// Evaluate objectives and gradients for a batch of points
+bool Point::evaluateObjectiveAndGradientBatch(const std::vector<std::shared_ptr<Point>>& points,
+                                              Quantities& quantities,
+                                              std::vector<bool>& success)
+{
+
+  // Initialize success indicators
+  success.assign(points.size(), true);
+
+  // Collect indices of points that need evaluation (setting values found in evaluation cache)
+  std::vector<int> pending;
+  for (int j = 0; j < (int)points.size(); j++) {
+    Point* point = points[j].get();
+    if (!point->objective_evaluated_ || !point->gradient_evaluated_) {
+      point->gradient_ = point->vector_->makeNewOfSameLength();
+      int nnz = -1;
+      int* indices = (quantities.gradientSparsityThreshold() > 0.0) ? quantities.sparseGradientIndices(point->vector_->length()) : nullptr;
+      if (quantities.evaluationCache()->findObjectiveAndGradient(point->vector_->length(), point->vector_->values(), point->objective_, point->gradient_->valuesModifiable(), nnz, indices)) {
+        point->objective_evaluated_ = true;
+        point->gradient_evaluated_ = true;
+        point->objective_ = point->scale_ * point->objective_;
+        point->gradient_->scale(point->scale_);
+        point->determineGradientSparsity(quantities, nnz, indices);
+      }
+      else {
+        pending.push_back(j);
+      }
+    } // end if
+  }   // end for
+
+  // Check for nothing to evaluate
+  if (pending.size() == 0) {
+    return true;
+  }
+
+  // Set sizes
+  int n = points[pending[0]]->vector_->length();
+  int m = (int)pending.size();
+
+  // Declare batch arrays
+  double* X = new double[n * m];
+  double* F = new double[m];
+  double* G = new double[n * m];
+  bool* batch_success = new bool[m];
+
+  // Declare gradient nonzeros (indices only needed if gradients are treated as sparse)
+  int* nnz = new int[m];
+  int* indices = (quantities.gradientSparsityThreshold() > 0.0) ? new int[n * m] : nullptr;
+  std::fill(nnz, nnz + m, -1);
+
+  // Set inputs for BLASLAPACK
+  int increment = 1;
+
+  // Gather points
+  for (int k = 0; k < m; k++) {
+    dcopy_(&n, points[pending[k]]->vector_->values(), &increment, &X[k * n], &increment);
+  }
+
+  // Set evaluation start time as current time
+  clock_t start_time = clock();
+  double start_wall_time = quantities.currentWallTime();
+
+  // Evaluate objectives and gradients for problem (point by point in sparse form if gradients are treated as sparse)
+  if (indices != nullptr) {
+    for (int k = 0; k < m; k++) {
+      batch_success[k] = points[pending[0]]->problem_->evaluateObjectiveAndGradientSparse(n, &X[k * n], F[k], nnz[k], &indices[k * n], &G[k * n]);
+      if (batch_success[k]) {
+        expandNonzeros(n, nnz[k], &indices[k * n], &G[k * n]);
+      }
+      else {
+        nnz[k] = -1;
+      }
+    } // end for
+  }   // end if
+  else {
+    points[pending[0]]->problem_->evaluateObjectiveAndGradientBatch(n, m, X, F, G, batch_success);
+  }
+
+  // Increment evaluation time
+  quantities.incrementEvaluationTime(clock() - start_time);
+  quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+  // Scatter values
+  for (int k = 0; k < m; k++) {
+
+    // Set point
+    Point* point = points[pending[k]].get();
+
+    // Copy values (into gradient vector set above)
+    point->objective_ = point->scale_ * F[k];
+    point->gradient_->copyArray(&G[k * n]);
+    point->objective_evaluated_ = batch_success[k];
+    point->gradient_evaluated_ = batch_success[k];
+
+    // Store in evaluation cache
+    if (batch_success[k]) {
+      quantities.evaluationCache()->storeObjective(n, &X[k * n], F[k]);
+      quantities.evaluationCache()->storeGradient(n, &X[k * n], &G[k * n], nnz[k], (indices != nullptr) ? &indices[k * n] : nullptr);
+    }
+
+    // Scale
+    point->gradient_->scale(point->scale_);
+
+    // Determine sparsity
+    point->determineGradientSparsity(quantities, nnz[k], (indices != nullptr) ? &indices[k * n] : nullptr);
+
+    // Set success indicator
+    success[pending[k]] = batch_success[k];
+
+    // Increment function and gradient evaluation counters
+    quantities.incrementFunctionCounter();
+    quantities.incrementGradientCounter();
+
+  } // end for
+
+  // Delete arrays
+  delete[] X;
+  delete[] F;
+  delete[] G;
+  delete[] batch_success;
+  delete[] nnz;
+  delete[] indices;
+
+  // Check for function evaluation limit
+  if (quantities.functionCounter() >= quantities.functionEvaluationLimit()) {
+    THROW_EXCEPTION(NONOPT_FUNCTION_EVALUATION_LIMIT_EXCEPTION, "Function evaluation limit reached.");
+  }
+
+  // Check for gradient evaluation limit
+  if (quantities.gradientCounter() >= quantities.gradientEvaluationLimit()) {
+    THROW_EXCEPTION(NONOPT_GRADIENT_EVALUATION_LIMIT_EXCEPTION, "Gradient evaluation limit reached.");
+  }
+
+  // Return
+  return (std::find(success.begin(), success.end(), false) == success.end());
+
+} // end evaluateObjectiveAndGradientBatch
+
+// Evaluate gradients for a batch of points
+bool Point::evaluateGradientBatch(const std::vector<std::shared_ptr<Point>>& points,
+                                  Quantities& quantities,
+                                  std::vector<bool>& success)
+{
+
+  // Initialize success indicators
+  success.assign(points.size(), true);
+
+  // Collect indices of points that need evaluation (setting values found in evaluation cache)
+  std::vector<int> pending;
+  for (int j = 0; j < (int)points.size(); j++) {
+    Point* point = points[j].get();
+    if (!point->gradient_evaluated_) {
+      point->gradient_ = point->vector_->makeNewOfSameLength();
+      int nnz = -1;
+      int* indices = (quantities.gradientSparsityThreshold() > 0.0) ? quantities.sparseGradientIndices(point->vector_->length()) : nullptr;
+      if (quantities.evaluationCache()->findGradient(point->vector_->length(), point->vector_->values(), point->gradient_->valuesModifiable(), nnz, indices)) {
+        point->gradient_evaluated_ = true;
+        point->gradient_->scale(point->scale_);
+        point->determineGradientSparsity(quantities, nnz, indices);
+      }
+      else {
+        pending.push_back(j);
+      }
+    } // end if
+  }   // end for
+
+  // Check for nothing to evaluate
+  if (pending.size() == 0) {
+    return true;
+  }
+
+  // Set sizes
+  int n = points[pending[0]]->vector_->length();
+  int m = (int)pending.size();
+
+  // Declare batch arrays
+  double* X = new double[n * m];
+  double* G = new double[n * m];
+  bool* batch_success = new bool[m];
+
+  // Declare gradient nonzeros (indices only needed if gradients are treated as sparse)
+  int* nnz = new int[m];
+  int* indices = (quantities.gradientSparsityThreshold() > 0.0) ? new int[n * m] : nullptr;
+  std::fill(nnz, nnz + m, -1);
+
+  // Set inputs for BLASLAPACK
+  int increment = 1;
+
+  // Gather points
+  for (int k = 0; k < m; k++) {
+    dcopy_(&n, points[pending[k]]->vector_->values(), &increment, &X[k * n], &increment);
+  }
+
+  // Set evaluation start time as current time
+  clock_t start_time = clock();
+  double start_wall_time = quantities.currentWallTime();
+
+  // Evaluate gradients for problem (point by point in sparse form if gradients are treated as sparse)
+  if (indices != nullptr) {
+    for (int k = 0; k < m; k++) {
+      batch_success[k] = points[pending[0]]->problem_->evaluateGradientSparse(n, &X[k * n], nnz[k], &indices[k * n], &G[k * n]);
+      if (batch_success[k]) {
+        expandNonzeros(n, nnz[k], &indices[k * n], &G[k * n]);
+      }
+      else {
+        nnz[k] = -1;
+      }
+    } // end for
+  }   // end if
+  else {
+    points[pending[0]]->problem_->evaluateGradientBatch(n, m, X, G, batch_success);
+  }
+
+  // Increment evaluation time
+  quantities.incrementEvaluationTime(clock() - start_time);
+  quantities.incrementEvaluationWallTime(quantities.currentWallTime() - start_wall_time);
+
+  // Scatter values
+  for (int k = 0; k < m; k++) {
+
+    // Set point
+    Point* point = points[pending[k]].get();
+
+    // Copy values (into gradient vector set above)
+    point->gradient_->copyArray(&G[k * n]);
+    point->gradient_evaluated_ = batch_success[k];
+
+    // Store in evaluation cache
+    if (batch_success[k]) {
+      quantities.evaluationCache()->storeGradient(n, &X[k * n], &G[k * n], nnz[k], (indices != nullptr) ? &indices[k * n] : nullptr);
+    }
+
+    // Scale
+    point->gradient_->scale(point->scale_);
+
+    // Determine sparsity
+    point->determineGradientSparsity(quantities, nnz[k], (indices != nullptr) ? &indices[k * n] : nullptr);
+
+    // Set success indicator
+    success[pending[k]] = batch_success[k];
+
+    // Increment gradient evaluation counter
+    quantities.incrementGradientCounter();
+
+  } // end for
+
+  // Delete arrays
+  delete[] X;
+  delete[] G;
+  delete[] batch_success;
+  delete[] nnz;
+  delete[] indices;
+
+  // Check for gradient evaluation limit
+  if (quantities.gradientCounter() >= quantities.gradientEvaluationLimit()) {
+    THROW_EXCEPTION(NONOPT_GRADIENT_EVALUATION_LIMIT_EXCEPTION, "Gradient evaluation limit reached.");
+  }
+
+  // Return
+  return (std::find(success.begin(), success.end(), false) == success.end());
+
+} // end evaluateGradientBatch
+
 } // namespace NonOpt
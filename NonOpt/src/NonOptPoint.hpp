@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "NonOptDeclarations.hpp"
 #include "NonOptProblem.hpp"
@@ -116,6 +117,56 @@ public:
    * \return boolean indicating success
    */
   bool evaluateGradient(Quantities& quantities);
+  /**
+   * Evaluate objectives for a batch of Points with a single call to the Problem
+   * (Points in the batch that have already been evaluated are skipped.)
+   * \param[in,out] points is vector of pointers to Points to evaluate, all with the same Problem
+   * \param[in,out] quantities is reference to Quantities object from NonOpt
+   * \param[out] success is vector of indicators of evaluation success for each Point (return value)
+   * \return boolean indicating success for all Points
+   */
+  static bool evaluateObjectiveBatch(const std::vector<std::shared_ptr<Point>>& points,
+                                     Quantities& quantities,
+                                     std::vector<bool>& success);
+  /**
+   * Evaluate objectives and gradients for a batch of Points with a single call to the Problem
+   * (Points in the batch that have already been evaluated are skipped.  If gradients are treated
+   *  as sparse, then Points are instead evaluated one at a time through the Problem's sparse methods.)
+   * \param[in,out] points is vector of pointers to Points to evaluate, all with the same Problem
+   * \param[in,out] quantities is reference to Quantities object from NonOpt
+   * \param[out] success is vector of indicators of evaluation success for each Point (return value)
+   * \return boolean indicating success for all Points
+   */
+  static bool evaluateObjectiveAndGradientBatch(const std::vector<std::shared_ptr<Point>>& points,
+                                                Quantities& quantities,
+                                                std::vector<bool>& success);
+  /**
+   * Evaluate gradients for a batch of Points with a single call to the Problem
+   * (Points in the batch that have already been evaluated are skipped.  If gradients are treated
+   *  as sparse, then Points are instead evaluated one at a time through the Problem's sparse methods.)
+   * \param[in,out] points is vector of pointers to Points to evaluate, all with the same Problem
+   * \param[in,out] quantities is reference to Quantities object from NonOpt
+   * \param[out] success is vector of indicators of evaluation success for each Point (return value)
+   * \return boolean indicating success for all Points
+   */
+  static bool evaluateGradientBatch(const std::vector<std::shared_ptr<Point>>& points,
+                                    Quantities& quantities,
+                                    std::vector<bool>& success);
+  /**
+   * Evaluate values and gradients of epsilon-active pieces at Point (for max-type objectives)
+   * (Values and gradients are scaled; if Problem does not provide pieces, return is false and outputs are empty.)
+   * \param[in,out] quantities is reference to Quantities object from NonOpt
+   * \param[in] epsilon is (scaled) activity tolerance, a constant double
+   * \param[in] maximum is maximum number of pieces, a constant integer (those with largest values are kept)
+   * \param[out] objectives is vector of values of epsilon-active pieces (return value)
+   * \param[out] gradients is vector of pointers to gradients of epsilon-active pieces (return value)
+   * \return boolean indicating success
+   */
+  bool evaluateEpsilonActiveGradients(Quantities& quantities,
+                                      double epsilon,
+                                      int maximum,
+                                      std::vector<double>& objectives,
+                                      std::vector<std::shared_ptr<Vector>>& gradients);
   /**
    * Scale objective
    */
@@ -195,6 +246,38 @@ private:
   void operator=(const Point&);
   //@}
 
+  /** @name Private methods */
+  //@{
+  /**
+   * Expand nonzeros given by Problem's sparse gradient methods
+   * (Nonzero values at the front of the array are moved in place to their indices, and other entries are zeroed.)
+   * \param[in] n is length of "values"
+   * \param[in] nnz is number of nonzeros
+   * \param[in] indices is integer array of nonzero indices in increasing order
+   * \param[in,out] values is double array with nonzero values at the front
+   */
+  static void expandNonzeros(int n,
+                             int nnz,
+                             const int* indices,
+                             double* values);
+  /**
+   * Determine sparsity of gradient (if gradients are treated as sparse)
+   * (Given nonzero indices are kept if sufficiently sparse; if none are given, values are scanned.)
+   * \param[in,out] quantities is reference to Quantities object from NonOpt
+   * \param[in] nnz is number of nonzeros, or -1 if not known
+   * \param[in] indices is integer array of nonzero indices in increasing order (ignored if "nnz" is -1)
+   */
+  void determineGradientSparsity(Quantities& quantities,
+                                 int nnz,
+                                 const int* indices);
+  /**
+   * Make new Point with given Vector, drawn from Vector's MemoryPool (if any)
+   * \param[in] vector is pointer to Vector defining new Point
+   * \return pointer to new Point
+   */
+  std::shared_ptr<Point> makeNewWithVector(std::shared_ptr<Vector> vector) const;
+  //@}
+
   /** @name Private members */
   //@{
   bool objective_evaluated_;
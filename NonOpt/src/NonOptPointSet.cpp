@@ -0,0 +1,421 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "NonOptBLASLAPACK.hpp"
+#include "NonOptDeclarations.hpp"
+#include "NonOptDefinitions.hpp"
+#include "NonOptPoint.hpp"
+#include "NonOptPointSet.hpp"
+
+namespace NonOpt
+{
+
+// Constructor
+PointSet::PointSet()
+  : number_of_variables_(0),
+    capacity_(0),
+    size_(0),
+    start_(0),
+    exact_distance_counter_(0),
+    reference_set_(false),
+    reference_norm2_(0.0) {}
+
+// Destructor
+PointSet::~PointSet()
+{
+
+  // Release Points (detaching vectors of those still in use)
+  clear();
+
+} // end destructor
+
+// Clear
+void PointSet::clear()
+{
+
+  // Release Points
+  for (int i = 0; i < size_; i++) {
+    releaseSlot(slot(i));
+  }
+
+  // Reset ring buffer
+  size_ = 0;
+  start_ = 0;
+
+} // end clear
+
+// Add Point
+void PointSet::push_back(const std::shared_ptr<Point> point)
+{
+
+  // Check for change in number of variables (e.g., new problem)
+  if (point->vector()->length() != number_of_variables_) {
+    clear();
+    number_of_variables_ = point->vector()->length();
+    capacity_ = 0;
+    points_.clear();
+    values_.clear();
+    norms2_.clear();
+    squared_distances_.clear();
+    error_bounds_.clear();
+    step_products_.clear();
+    reference_set_ = false;
+  } // end if
+
+  // Increase capacity if full
+  if (size_ == capacity_) {
+    reserve(std::max(8, 2 * capacity_));
+  }
+
+  // Store Point and copy values into slot
+  int new_slot = slot(size_);
+  points_[new_slot] = point;
+  memcpy(&values_[(size_t)new_slot * number_of_variables_], point->vector()->values(), number_of_variables_ * sizeof(double));
+  norms2_[new_slot] = point->vector()->norm2();
+
+  // Set Point's vector as view of slot (unless already a view, e.g., of another slot)
+  if (!point->vector()->isView()) {
+    point->vector()->setView(&values_[(size_t)new_slot * number_of_variables_]);
+  }
+
+  // Increment size
+  size_++;
+
+  // Set tracked squared distance to reference
+  if (reference_set_) {
+    double distance2, distanceInf;
+    computeDistanceToReference(new_slot, NONOPT_DOUBLE_INFINITY, distance2, distanceInf);
+  }
+  else {
+    squared_distances_[new_slot] = 0.0;
+    error_bounds_[new_slot] = NONOPT_DOUBLE_INFINITY;
+  }
+
+} // end push_back
+
+// Remove oldest Points
+void PointSet::removeOldest(int number)
+{
+
+  // Loop through oldest Points
+  for (int i = 0; i < std::min(number, size_); i++) {
+    releaseSlot(start_);
+    start_ = (start_ + 1) % capacity_;
+  } // end for
+
+  // Update size
+  size_ -= std::min(number, size_);
+
+} // end removeOldest
+
+// Remove marked Points
+void PointSet::removeMarked(const std::vector<bool>& remove)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION((int)remove.size() == size_, NONOPT_VECTOR_ASSERT_EXCEPTION, "Point set assert failed.  Number of indicators is incorrect.");
+
+  // Release removed Points (before their slots are overwritten)
+  for (int i = 0; i < size_; i++) {
+    if (remove[i]) {
+      releaseSlot(slot(i));
+    }
+  } // end for
+
+  // Move kept Points forward (maintaining order)
+  int kept = 0;
+  for (int i = 0; i < size_; i++) {
+    if (!remove[i]) {
+      if (kept != i) {
+        copySlot(slot(i), slot(kept));
+      }
+      kept++;
+    } // end if
+  }   // end for
+
+  // Clear vacated slots (Points in them have been released or moved)
+  for (int i = kept; i < size_; i++) {
+    points_[slot(i)].reset();
+  }
+
+  // Update size
+  size_ = kept;
+
+} // end removeMarked
+
+// Remove Points far from vector
+void PointSet::removeFarPoints(const Vector& vector,
+                               double radius)
+{
+
+  // Set reference
+  setReference(vector);
+
+  // Loop through Points
+  double radius_squared = radius * radius;
+  std::vector<bool> remove(size_, false);
+  for (int i = 0; i < size_; i++) {
+
+    // Check tracked squared distance
+    int point_slot = slot(i);
+    if (squared_distances_[point_slot] - error_bounds_[point_slot] > radius_squared) {
+      remove[i] = true;
+    }
+    else if (squared_distances_[point_slot] + error_bounds_[point_slot] > radius_squared) {
+
+      // Compute exact distance
+      double distance2, distanceInf;
+      computeDistanceToReference(point_slot, NONOPT_DOUBLE_INFINITY, distance2, distanceInf);
+      remove[i] = (distance2 > radius);
+
+    } // end else if
+
+  } // end for
+
+  // Remove marked Points
+  removeMarked(remove);
+
+} // end removeFarPoints
+
+// Compute distances
+void PointSet::computeDistances(const Vector& vector,
+                                std::vector<double>& distances2,
+                                std::vector<double>& distancesInf) const
+{
+
+  // Resize outputs
+  distances2.resize(size_);
+  distancesInf.resize(size_);
+
+  // Loop through Points (columns of contiguous block)
+  const double* x = vector.values();
+  for (int i = 0; i < size_; i++) {
+    const double* column = &values_[(size_t)slot(i) * number_of_variables_];
+    double sum = 0.0;
+    double maximum = 0.0;
+    for (int j = 0; j < number_of_variables_; j++) {
+      double difference = fabs(x[j] - column[j]);
+      sum += difference * difference;
+      maximum = fmax(maximum, difference);
+    } // end for
+    distances2[i] = sqrt(sum);
+    distancesInf[i] = maximum;
+  } // end for
+
+} // end computeDistances
+
+// Find Points in radius
+void PointSet::findPointsInRadius(const Vector& vector,
+                                  double radius,
+                                  std::vector<int>& indices,
+                                  std::vector<double>& distances2)
+{
+
+  // Clear outputs
+  indices.clear();
+  distances2.clear();
+
+  // Set reference
+  setReference(vector);
+
+  // Loop through Points
+  double prefilter_squared = (double)number_of_variables_ * radius * radius;
+  for (int i = 0; i < size_; i++) {
+
+    // Check tracked squared distance (inf-norm within radius implies squared 2-norm within n*radius^2)
+    int point_slot = slot(i);
+    if (squared_distances_[point_slot] - error_bounds_[point_slot] > prefilter_squared) {
+      continue;
+    }
+
+    // Compute exact distance
+    double distance2, distanceInf;
+    if (computeDistanceToReference(point_slot, radius, distance2, distanceInf)) {
+      indices.push_back(i);
+      distances2.push_back(distance2);
+    }
+
+  } // end for
+
+} // end findPointsInRadius
+
+// Compute distance to reference
+bool PointSet::computeDistanceToReference(int point_slot,
+                                          double bound,
+                                          double& distance2,
+                                          double& distanceInf)
+{
+
+  // Increment counter
+  exact_distance_counter_++;
+
+  // Loop through elements
+  const double* column = &values_[(size_t)point_slot * number_of_variables_];
+  double sum = 0.0;
+  double maximum = 0.0;
+  for (int j = 0; j < number_of_variables_; j++) {
+    double difference = fabs(reference_[j] - column[j]);
+    sum += difference * difference;
+    maximum = fmax(maximum, difference);
+    if (maximum > bound) {
+      return false;
+    }
+  } // end for
+
+  // Set distances
+  distance2 = sqrt(sum);
+  distanceInf = maximum;
+
+  // Reset tracked squared distance
+  squared_distances_[point_slot] = sum;
+  error_bounds_[point_slot] = 2.0 * (number_of_variables_ + 2) * DBL_EPSILON * sum;
+
+  // Return
+  return true;
+
+} // end computeDistanceToReference
+
+// Copy slot
+void PointSet::copySlot(int from_slot,
+                        int to_slot)
+{
+
+  // Copy Point and values
+  points_[to_slot] = points_[from_slot];
+  memcpy(&values_[(size_t)to_slot * number_of_variables_], &values_[(size_t)from_slot * number_of_variables_], number_of_variables_ * sizeof(double));
+
+  // Move view of Point's vector
+  if (points_[to_slot]->vector()->values() == &values_[(size_t)from_slot * number_of_variables_]) {
+    points_[to_slot]->vector()->setView(&values_[(size_t)to_slot * number_of_variables_]);
+  }
+
+  // Copy tracked quantities
+  norms2_[to_slot] = norms2_[from_slot];
+  squared_distances_[to_slot] = squared_distances_[from_slot];
+  error_bounds_[to_slot] = error_bounds_[from_slot];
+
+} // end copySlot
+
+// Release slot
+void PointSet::releaseSlot(int point_slot)
+{
+
+  // Detach Point's vector from slot if Point or vector remains in use (beyond this set and the local copy)
+  std::shared_ptr<Vector> vector = points_[point_slot]->vector();
+  if (vector->values() == &values_[(size_t)point_slot * number_of_variables_] &&
+      (points_[point_slot].use_count() > 1 || vector.use_count() > 2)) {
+    vector->detach();
+  }
+
+  // Release Point
+  points_[point_slot].reset();
+
+} // end releaseSlot
+
+// Increase capacity
+void PointSet::reserve(int capacity)
+{
+
+  // Declare new storage
+  std::vector<std::shared_ptr<Point>> points(capacity);
+  std::vector<double> values((size_t)capacity * number_of_variables_);
+  std::vector<double> norms2(capacity);
+  std::vector<double> squared_distances(capacity);
+  std::vector<double> error_bounds(capacity);
+
+  // Copy Points in order (moving views of their vectors)
+  for (int i = 0; i < size_; i++) {
+    points[i] = points_[slot(i)];
+    memcpy(&values[(size_t)i * number_of_variables_], &values_[(size_t)slot(i) * number_of_variables_], number_of_variables_ * sizeof(double));
+    if (points[i]->vector()->values() == &values_[(size_t)slot(i) * number_of_variables_]) {
+      points[i]->vector()->setView(&values[(size_t)i * number_of_variables_]);
+    }
+    norms2[i] = norms2_[slot(i)];
+    squared_distances[i] = squared_distances_[slot(i)];
+    error_bounds[i] = error_bounds_[slot(i)];
+  } // end for
+
+  // Set new storage
+  points_.swap(points);
+  values_.swap(values);
+  norms2_.swap(norms2);
+  squared_distances_.swap(squared_distances);
+  error_bounds_.swap(error_bounds);
+  step_products_.resize(capacity);
+  capacity_ = capacity;
+  start_ = 0;
+
+} // end reserve
+
+// Set reference
+void PointSet::setReference(const Vector& vector)
+{
+
+  // Check for first reference
+  if (!reference_set_ || (int)reference_.size() != vector.length()) {
+    int n = vector.length();
+    int increment = 1;
+    reference_.assign(vector.values(), vector.values() + n);
+    reference_norm2_ = sqrt(ddot_(&n, reference_.data(), &increment, reference_.data(), &increment));
+    reference_set_ = true;
+    for (int i = 0; i < size_; i++) {
+      error_bounds_[slot(i)] = NONOPT_DOUBLE_INFINITY;
+    }
+    return;
+  } // end if
+
+  // Check for unchanged reference
+  if (memcmp(reference_.data(), vector.values(), vector.length() * sizeof(double)) == 0) {
+    return;
+  }
+
+  // Compute step from previous reference
+  int n = vector.length();
+  step_.resize(n);
+  for (int j = 0; j < n; j++) {
+    step_[j] = vector.values()[j] - reference_[j];
+  }
+
+  // Compute inner products of step with itself and previous reference
+  int increment = 1;
+  double step_squared = ddot_(&n, step_.data(), &increment, step_.data(), &increment);
+  double step_reference = ddot_(&n, step_.data(), &increment, reference_.data(), &increment);
+  double step_norm2 = sqrt(step_squared);
+
+  // Compute inner products of step with Points (one matrix-vector product per contiguous segment of ring)
+  char transpose = 'T';
+  double one = 1.0;
+  double zero = 0.0;
+  int first_count = std::min(size_, capacity_ - start_);
+  int second_count = size_ - first_count;
+  if (first_count > 0) {
+    dgemv_(&transpose, &n, &first_count, &one, &values_[(size_t)start_ * n], &n, step_.data(), &increment, &zero, &step_products_[start_], &increment);
+  }
+  if (second_count > 0) {
+    dgemv_(&transpose, &n, &second_count, &one, &values_[0], &n, step_.data(), &increment, &zero, &step_products_[0], &increment);
+  }
+
+  // Update tracked squared distances, i.e., ||x + s - y||^2 = ||x - y||^2 + 2 s^T x - 2 s^T y + ||s||^2, with error bounds
+  double factor = 8.0 * (n + 2) * DBL_EPSILON;
+  for (int i = 0; i < size_; i++) {
+    int point_slot = slot(i);
+    double squared_distance = squared_distances_[point_slot];
+    squared_distances_[point_slot] = squared_distance + 2.0 * (step_reference - step_products_[point_slot]) + step_squared;
+    error_bounds_[point_slot] += factor * (fabs(squared_distance) + step_squared + 2.0 * step_norm2 * (reference_norm2_ + norms2_[point_slot] + sqrt(fabs(squared_distance))));
+  } // end for
+
+  // Set reference
+  memcpy(reference_.data(), vector.values(), n * sizeof(double));
+  reference_norm2_ = sqrt(ddot_(&n, reference_.data(), &increment, reference_.data(), &increment));
+
+} // end setReference
+
+} // namespace NonOpt
@@ -0,0 +1,223 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTPOINTSET_HPP__
+#define __NONOPTPOINTSET_HPP__
+
+#include <memory>
+#include <vector>
+
+#include "NonOptVector.hpp"
+
+namespace NonOpt
+{
+
+/**
+ * Forward declarations
+ */
+class Point;
+
+/**
+ * PointSet class
+ * (Ordered set of Points, oldest first.  Point vectors are kept as columns of one
+ *  contiguous n-by-capacity block, stored as a ring buffer so that removal of the
+ *  oldest Points is O(1) and distances to all Points are computed in one sweep.
+ *  Each added Point's vector is set as a view of its column, releasing its own array;
+ *  a vector is detached, i.e., given its own copy, when its Point is removed but
+ *  remains in use elsewhere.  Point vectors must not be modified while in the set.
+ *  Squared distances to a reference vector, e.g., the current iterate, are tracked
+ *  with rounding error bounds and updated with one matrix-vector product whenever
+ *  the reference changes, so that exact distances need only be computed for Points
+ *  whose tracked distances do not decide a distance check.)
+ */
+class PointSet
+{
+
+public:
+  /** @name Constructors */
+  //@{
+  /**
+   * Declare PointSet (empty)
+   */
+  PointSet();
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Delete data
+   */
+  ~PointSet();
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Capacity
+   * \return number of Points that can be stored without reallocation
+   */
+  inline int const capacity() const { return capacity_; };
+  /**
+   * Exact distance counter
+   * \return number of exact distance computations for individual Points
+   */
+  inline int const exactDistanceCounter() const { return exact_distance_counter_; };
+  /**
+   * Size
+   * \return number of Points in set
+   */
+  inline int const size() const { return size_; };
+  /**
+   * Point access
+   * \param[in] index is position of Point in set (0 is oldest)
+   * \return pointer to Point
+   */
+  inline std::shared_ptr<Point> operator[](int index) const { return points_[slot(index)]; };
+  /**
+   * Values access
+   * \param[in] index is position of Point in set (0 is oldest)
+   * \return pointer to (contiguous) values of Point's vector
+   */
+  inline const double* values(int index) const { return &values_[(size_t)slot(index) * number_of_variables_]; };
+  //@}
+
+  /** @name Modify methods */
+  //@{
+  /**
+   * Clear set
+   */
+  void clear();
+  /**
+   * Add Point as newest member (increasing capacity geometrically if full)
+   * \param[in] point is pointer to Point to add
+   */
+  void push_back(const std::shared_ptr<Point> point);
+  /**
+   * Remove oldest Points
+   * \param[in] number is number of Points to remove
+   */
+  void removeOldest(int number);
+  /**
+   * Remove marked Points (order of remaining Points is maintained)
+   * \param[in] remove is vector of indicators, one per Point in set, of whether to remove Point
+   */
+  void removeMarked(const std::vector<bool>& remove);
+  /**
+   * Remove Points farther than radius (in 2-norm) from given vector (order of remaining Points is maintained)
+   * \param[in] vector is reference to Vector from which to compute distances
+   * \param[in] radius is radius
+   */
+  void removeFarPoints(const Vector& vector,
+                       double radius);
+  //@}
+
+  /** @name Compute methods */
+  //@{
+  /**
+   * Compute distances from given vector to all Points in set (in one sweep over stored values)
+   * \param[in] vector is reference to Vector from which to compute distances
+   * \param[out] distances2 is vector of 2-norm distances, one per Point in set (return value)
+   * \param[out] distancesInf is vector of inf-norm distances, one per Point in set (return value)
+   */
+  void computeDistances(const Vector& vector,
+                        std::vector<double>& distances2,
+                        std::vector<double>& distancesInf) const;
+  /**
+   * Find Points within radius (in inf-norm) of given vector
+   * \param[in] vector is reference to Vector from which to compute distances
+   * \param[in] radius is radius
+   * \param[out] indices is vector of positions of Points within radius, in order (return value)
+   * \param[out] distances2 is vector of 2-norm distances to Points within radius (return value)
+   */
+  void findPointsInRadius(const Vector& vector,
+                          double radius,
+                          std::vector<int>& indices,
+                          std::vector<double>& distances2);
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  PointSet(const PointSet&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const PointSet&);
+  //@}
+
+  /** @name Private methods */
+  //@{
+  /**
+   * Ring buffer slot
+   * \param[in] index is position of Point in set (0 is oldest)
+   * \return slot in which Point is stored
+   */
+  inline int slot(int index) const { return (start_ + index) % capacity_; };
+  /**
+   * Compute distance from reference vector to Point in slot, and reset tracked squared distance
+   * \param[in] point_slot is slot of Point
+   * \param[in] bound is bound on inf-norm distance, beyond which computation stops
+   * \param[out] distance2 is 2-norm distance, if computation did not stop (return value)
+   * \param[out] distanceInf is inf-norm distance, if computation did not stop (return value)
+   * \return indicator of whether computation did not stop, i.e., inf-norm distance is within bound
+   */
+  bool computeDistanceToReference(int point_slot,
+                                  double bound,
+                                  double& distance2,
+                                  double& distanceInf);
+  /**
+   * Copy values and tracked quantities of Point from one slot to another
+   * \param[in] from_slot is slot from which to copy
+   * \param[in] to_slot is slot to which to copy
+   */
+  void copySlot(int from_slot,
+                int to_slot);
+  /**
+   * Release Point in slot, detaching its vector from slot if it remains in use
+   * \param[in] point_slot is slot of Point
+   */
+  void releaseSlot(int point_slot);
+  /**
+   * Set reference vector, updating tracked squared distances
+   * \param[in] vector is reference to Vector to set as reference
+   */
+  void setReference(const Vector& vector);
+  /**
+   * Increase capacity (values are reordered so that oldest Point is in first slot)
+   * \param[in] capacity is new capacity
+   */
+  void reserve(int capacity);
+  //@}
+
+  /** @name Private members */
+  //@{
+  int number_of_variables_;
+  int capacity_;
+  int size_;
+  int start_;
+  int exact_distance_counter_;
+  bool reference_set_;
+  double reference_norm2_;
+  std::vector<std::shared_ptr<Point>> points_;
+  std::vector<double> values_;
+  std::vector<double> norms2_;
+  std::vector<double> squared_distances_;
+  std::vector<double> error_bounds_;
+  std::vector<double> reference_;
+  std::vector<double> step_;
+  std::vector<double> step_products_;
+  //@}
+
+}; // end PointSet
+
+} // namespace NonOpt
+
+#endif /* __NONOPTPOINTSET_HPP__ */
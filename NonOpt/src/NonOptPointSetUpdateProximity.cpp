@@ -4,6 +4,8 @@
 //
 // Author(s) : Frank E. Curtis
 
+#include <cmath>
+
 #include "NonOptPointSetUpdateProximity.hpp"
 #include "NonOptDefinitions.hpp"
 
@@ -78,29 +80,16 @@ void PointSetUpdateProximity::updatePointSet(const Options* options,
   // Initialize status
   setStatus(PS_UNSET);
 
+  // Determine size limit
+  double size_limit = fmin(size_factor_ * (double)quantities->numberOfVariables(), (double)size_maximum_);
+
   // Remove old points
-  while ((double)quantities->pointSet()->size() > size_factor_ * (double)quantities->numberOfVariables() || (int)quantities->pointSet()->size() > size_maximum_) {
-    quantities->pointSet()->erase(quantities->pointSet()->begin());
+  if ((double)quantities->pointSet()->size() > size_limit) {
+    quantities->pointSet()->removeOldest(quantities->pointSet()->size() - (int)floor(size_limit));
   }
 
-  // Loop through points
-  for (int i = 0; i < (int)quantities->pointSet()->size(); i++) {
-
-    // Create difference vector
-    std::shared_ptr<Vector> difference = quantities->currentIterate()->vector()->makeNewLinearCombination(1.0, -1.0, *(*quantities->pointSet())[i]->vector());
-
-    // Check distance between point and current iterate
-    if (difference->norm2() > envelope_factor_ * quantities->stationarityRadius()) {
-
-      // Erase element
-      quantities->pointSet()->erase(quantities->pointSet()->begin() + i);
-
-      // Decrement iterator
-      i--;
-
-    } // end if
-
-  } // end for
+  // Remove points far from current iterate
+  quantities->pointSet()->removeFarPoints(*quantities->currentIterate()->vector(), envelope_factor_ * quantities->stationarityRadius());
 
   // Update status
   setStatus(PS_SUCCESS);
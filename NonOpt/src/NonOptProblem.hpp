@@ -8,6 +8,7 @@
 #define __NONOPTPROBLEM_HPP__
 
 #include <iostream>
+#include <vector>
 
 namespace NonOpt
 {
@@ -48,6 +49,28 @@ public:
    */
   virtual bool initialPoint(int n,
                             double* x) = 0;
+  /**
+   * Returns element decomposition, i.e., index sets such that the objective (or each function
+   * in a max of such sums) is a sum of terms, each depending only on the variables in one set
+   * (Default indicates that a decomposition is not available.  Used by the Partitioned
+   *  symmetric matrix strategy, for which coupling outside of the sets is ignored.)
+   * \param[in] n is the number of variables, a constant integer
+   * \param[out] elements is the index sets, a vector of integer vectors with indices in 0..n-1 (return value)
+   * \return indicator of whether decomposition is available
+   */
+  virtual bool elementDecomposition(int n,
+                                    std::vector<std::vector<int>>& elements)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Indicate no decomposition available
+    elements.clear();
+
+    // Return
+    return false;
+  }
   //@}
 
   /** @name Evaluate methods */
@@ -95,6 +118,203 @@ public:
   virtual bool evaluateGradient(int n,
                                 const double* x,
                                 double* g) = 0;
+  /**
+   * Evaluates gradient in sparse form
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[out] nnz is the number of nonzeros in the gradient value at "x", an integer (return value)
+   * \param[out] indices is the indices of the nonzeros in increasing order, an integer array with space for n entries (return value)
+   * \param[out] values is the nonzero values, a double array with space for n entries (return value)
+   */
+  virtual bool evaluateGradientSparse(int n,
+                                      const double* x,
+                                      int& nnz,
+                                      int* indices,
+                                      double* values)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Evaluate gradient (densely, into values)
+    bool evaluation_success = evaluateGradient(n, x, values);
+
+    // Compress nonzeros (in place, since nnz <= i)
+    nnz = 0;
+    for (int i = 0; i < n; i++) {
+      if (values[i] != 0.0) {
+        indices[nnz] = i;
+        values[nnz] = values[i];
+        nnz++;
+      }
+    } // end for
+
+    // Return
+    return evaluation_success;
+  }
+  /**
+   * Evaluates objective and gradient, the latter in sparse form
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[out] f is the objective value at "x", a double (return value)
+   * \param[out] nnz is the number of nonzeros in the gradient value at "x", an integer (return value)
+   * \param[out] indices is the indices of the nonzeros in increasing order, an integer array with space for n entries (return value)
+   * \param[out] values is the nonzero values, a double array with space for n entries (return value)
+   */
+  virtual bool evaluateObjectiveAndGradientSparse(int n,
+                                                  const double* x,
+                                                  double& f,
+                                                  int& nnz,
+                                                  int* indices,
+                                                  double* values)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Evaluate objective and gradient (densely, into values)
+    bool evaluation_success = evaluateObjectiveAndGradient(n, x, f, values);
+
+    // Compress nonzeros (in place, since nnz <= i)
+    nnz = 0;
+    for (int i = 0; i < n; i++) {
+      if (values[i] != 0.0) {
+        indices[nnz] = i;
+        values[nnz] = values[i];
+        nnz++;
+      }
+    } // end for
+
+    // Return
+    return evaluation_success;
+  }
+  /**
+   * Evaluates objectives at a batch of points
+   * \param[in] n is the number of variables, the number of rows of "X", a constant integer
+   * \param[in] m is the number of points in the batch, the number of columns of "X", a constant integer
+   * \param[in] X is the batch of points/iterates, a constant double array (column-major, n*m, point j at X + j*n)
+   * \param[out] F is the objective values at the columns of "X", a double array of length m (return value)
+   * \param[out] success is the evaluation success indicators for the columns of "X", a bool array of length m (return value)
+   * \return indicator of whether all evaluations were successful
+   */
+  virtual bool evaluateObjectiveBatch(int n,
+                                      int m,
+                                      const double* X,
+                                      double* F,
+                                      bool* success)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Initialize indicator
+    bool all_success = true;
+
+    // Loop through points
+    for (int j = 0; j < m; j++) {
+      success[j] = evaluateObjective(n, &X[j * n], F[j]);
+      all_success = (all_success && success[j]);
+    } // end for
+
+    // Return
+    return all_success;
+  }
+  /**
+   * Evaluates objectives and gradients at a batch of points
+   * \param[in] n is the number of variables, the number of rows of "X" and "G", a constant integer
+   * \param[in] m is the number of points in the batch, the number of columns of "X" and "G", a constant integer
+   * \param[in] X is the batch of points/iterates, a constant double array (column-major, n*m, point j at X + j*n)
+   * \param[out] F is the objective values at the columns of "X", a double array of length m (return value)
+   * \param[out] G is the gradient values at the columns of "X", a double array (column-major, n*m) (return value)
+   * \param[out] success is the evaluation success indicators for the columns of "X", a bool array of length m (return value)
+   * \return indicator of whether all evaluations were successful
+   */
+  virtual bool evaluateObjectiveAndGradientBatch(int n,
+                                                 int m,
+                                                 const double* X,
+                                                 double* F,
+                                                 double* G,
+                                                 bool* success)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Initialize indicator
+    bool all_success = true;
+
+    // Loop through points
+    for (int j = 0; j < m; j++) {
+      success[j] = evaluateObjectiveAndGradient(n, &X[j * n], F[j], &G[j * n]);
+      all_success = (all_success && success[j]);
+    } // end for
+
+    // Return
+    return all_success;
+  }
+  /**
+   * Evaluates gradients at a batch of points
+   * \param[in] n is the number of variables, the number of rows of "X" and "G", a constant integer
+   * \param[in] m is the number of points in the batch, the number of columns of "X" and "G", a constant integer
+   * \param[in] X is the batch of points/iterates, a constant double array (column-major, n*m, point j at X + j*n)
+   * \param[out] G is the gradient values at the columns of "X", a double array (column-major, n*m) (return value)
+   * \param[out] success is the evaluation success indicators for the columns of "X", a bool array of length m (return value)
+   * \return indicator of whether all evaluations were successful
+   */
+  virtual bool evaluateGradientBatch(int n,
+                                     int m,
+                                     const double* X,
+                                     double* G,
+                                     bool* success)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Initialize indicator
+    bool all_success = true;
+
+    // Loop through points
+    for (int j = 0; j < m; j++) {
+      success[j] = evaluateGradient(n, &X[j * n], &G[j * n]);
+      all_success = (all_success && success[j]);
+    } // end for
+
+    // Return
+    return all_success;
+  }
+  /**
+   * Evaluates values and gradients of all epsilon-active pieces (for max-type objectives)
+   * (Default indicates that pieces are not available, in which case NonOpt relies on sampling.)
+   * \param[in] n is the number of variables, the size of "x", a constant integer
+   * \param[in] x is a given point/iterate, a constant double array
+   * \param[in] epsilon is the activity tolerance, a constant double; pieces with value at "x" at least f(x) - epsilon are returned
+   * \param[in] m_maximum is the maximum number of pieces to return, a constant integer; if more are epsilon-active, those with largest values are returned
+   * \param[out] m is the number of epsilon-active pieces returned, at most "m_maximum", an integer (return value)
+   * \param[out] F is the values of the epsilon-active pieces at "x", a double vector of length m (return value)
+   * \param[out] G is the gradients of the epsilon-active pieces at "x", a double vector (column-major, n*m) (return value)
+   * \return indicator of whether pieces were evaluated successfully
+   */
+  virtual bool evaluateEpsilonActiveGradients(int n,
+                                              const double* x,
+                                              double epsilon,
+                                              int m_maximum,
+                                              int& m,
+                                              std::vector<double>& F,
+                                              std::vector<double>& G)
+  {
+    ///////////////////////////////////////////////
+    // Default method if not overwritten by user //
+    ///////////////////////////////////////////////
+
+    // Indicate no pieces available
+    m = 0;
+    F.clear();
+    G.clear();
+
+    // Return
+    return false;
+  }
   //@}
 
   /** @name Finalize methods */
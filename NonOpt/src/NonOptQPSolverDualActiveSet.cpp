@@ -7,7 +7,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <iterator>
+#include <unordered_map>
 
 #include "NonOptBLASLAPACK.hpp"
 #include "NonOptDeclarations.hpp"
@@ -19,7 +21,8 @@ namespace NonOpt
 
 // Constructor
 QPSolverDualActiveSet::QPSolverDualActiveSet()
-  : inexact_solution_tolerance_(0.0),
+  : column_block_length_(64),
+    inexact_solution_tolerance_(0.0),
     scalar_(0.0),
     factor_(nullptr),
     inner_solution_1_(nullptr),
@@ -30,55 +33,21 @@ QPSolverDualActiveSet::QPSolverDualActiveSet()
     new_system_vector_(nullptr),
     right_hand_side_(nullptr),
     system_solution_(nullptr),
-    system_solution_best_(nullptr) {}
-
-// Destructor
-QPSolverDualActiveSet::~QPSolverDualActiveSet()
-{
-
-  // Delete arrays
-  if (inner_solution_1_ != nullptr) {
-    delete[] inner_solution_1_;
-    inner_solution_1_ = nullptr;
-  } // end if
-  if (inner_solution_2_ != nullptr) {
-    delete[] inner_solution_2_;
-    inner_solution_2_ = nullptr;
-  } // end if
-  if (inner_solution_3_ != nullptr) {
-    delete[] inner_solution_3_;
-    inner_solution_3_ = nullptr;
-  } // end if
-  if (inner_solution_ls_ != nullptr) {
-    delete[] inner_solution_ls_;
-    inner_solution_ls_ = nullptr;
-  } // end if
-  if (inner_solution_trial_ != nullptr) {
-    delete[] inner_solution_trial_;
-    inner_solution_trial_ = nullptr;
-  } // end if
-  if (new_system_vector_ != nullptr) {
-    delete[] new_system_vector_;
-    new_system_vector_ = nullptr;
-  } // end if
-  if (right_hand_side_ != nullptr) {
-    delete[] right_hand_side_;
-    right_hand_side_ = nullptr;
-  } // end if
-  if (system_solution_ != nullptr) {
-    delete[] system_solution_;
-    system_solution_ = nullptr;
-  } // end if
-  if (system_solution_best_ != nullptr) {
-    delete[] system_solution_best_;
-    system_solution_best_ = nullptr;
-  } // end if
-  if (factor_ != nullptr) {
-    delete[] factor_;
-    factor_ = nullptr;
-  } // end if
-
-} // end destructor
+    system_solution_best_(nullptr),
+    factor_outdated_(false),
+    min_norm_point_fallback_(false),
+    min_norm_point_factor_(nullptr),
+    min_norm_point_solution_1_(nullptr),
+    min_norm_point_solution_2_(nullptr),
+    bundle_columns_(0),
+    bundle_products_count_(0),
+    bundle_sparse_count_(0),
+    gram_capacity_(0),
+    gram_matrix_modification_counter_(0),
+    gram_matrix_(nullptr) {}
+
+// Destructor (arrays are owned by workspace)
+QPSolverDualActiveSet::~QPSolverDualActiveSet() {}
 
 // Add options
 void QPSolverDualActiveSet::addOptions(Options* options)
@@ -93,6 +62,21 @@ void QPSolverDualActiveSet::addOptions(Options* options)
                          false,
                          "Indicator for whether to allow early termination.\n"
                          "Default     : false.");
+  options->addBoolOption("QPDAS_min_norm_point",
+                         true,
+                         "Indicator for whether to solve QPs with infinite scalar \"r\" by a\n"
+                         "              minimum-norm-point method, which ignores the (vacuous)\n"
+                         "              bound constraints and maintains its own factorization.\n"
+                         "Default     : true.");
+  options->addBoolOption("QPDAS_warm_start",
+                         false,
+                         "Indicator for whether to seed the sets of a solve from scratch with\n"
+                         "              those of the last successful solve, for vectors (by\n"
+                         "              identity) that remain in the vector list.  Seeded\n"
+                         "              sets may already satisfy the KKT tolerance, in which\n"
+                         "              case the solution can differ from that of a cold\n"
+                         "              solve (and so can the outcome of a run).\n"
+                         "Default     : false.");
   // Add double options
   options->addDoubleOption("QPDAS_kkt_tolerance",
                            1e-08,
@@ -142,6 +126,17 @@ void QPSolverDualActiveSet::addOptions(Options* options)
                            "Default     : 1e-12.");
 
   // Add integer options
+  options->addIntegerOption("QPDAS_block_size",
+                            1,
+                            1,
+                            NONOPT_INT_INFINITY,
+                            "Maximum number of violated omega constraints added in an\n"
+                            "              iteration, by a rank-k update of the factor, when the\n"
+                            "              gamma sets are empty.  If an iteration with a block does\n"
+                            "              not increase the size of the positive set, then one\n"
+                            "              constraint is added per iteration for the rest of the\n"
+                            "              solve.\n"
+                            "Default     : 1.");
   options->addIntegerOption("QPDAS_inexact_termination_check_interval",
                             4,
                             1,
@@ -171,6 +166,8 @@ void QPSolverDualActiveSet::setOptions(Options* options)
   // Read bool options
   options->valueAsBool("QPDAS_fail_on_factorization_error", fail_on_factorization_error_);
   options->valueAsBool("QPDAS_allow_inexact_termination", allow_inexact_termination_);
+  options->valueAsBool("QPDAS_min_norm_point", min_norm_point_);
+  options->valueAsBool("QPDAS_warm_start", warm_start_);
 
   // Read double options
   options->valueAsDouble("QPDAS_kkt_tolerance", kkt_tolerance_);
@@ -181,6 +178,7 @@ void QPSolverDualActiveSet::setOptions(Options* options)
   options->valueAsDouble("QPDAS_linear_independence_tolerance", linear_independence_tolerance_);
 
   // Read integer options
+  options->valueAsInteger("QPDAS_block_size", block_size_);
   options->valueAsInteger("QPDAS_inexact_termination_check_interval", inexact_termination_check_interval_);
   options->valueAsInteger("QPDAS_iteration_limit_minimum", iteration_limit_minimum_);
   options->valueAsInteger("QPDAS_iteration_limit_maximum", iteration_limit_maximum_);
@@ -210,59 +208,39 @@ void QPSolverDualActiveSet::initializeData(int gamma_length)
   vector_.clear();
   scalar_ = -1.0;
 
-  // Delete arrays (in case they exist)
-  if (inner_solution_1_ != nullptr) {
-    delete[] inner_solution_1_;
-    inner_solution_1_ = nullptr;
-  } // end if
-  if (inner_solution_2_ != nullptr) {
-    delete[] inner_solution_2_;
-    inner_solution_2_ = nullptr;
-  } // end if
-  if (inner_solution_3_ != nullptr) {
-    delete[] inner_solution_3_;
-    inner_solution_3_ = nullptr;
-  } // end if
-  if (inner_solution_ls_ != nullptr) {
-    delete[] inner_solution_ls_;
-    inner_solution_ls_ = nullptr;
-  } // end if
-  if (inner_solution_trial_ != nullptr) {
-    delete[] inner_solution_trial_;
-    inner_solution_trial_ = nullptr;
-  } // end if
-  if (new_system_vector_ != nullptr) {
-    delete[] new_system_vector_;
-    new_system_vector_ = nullptr;
-  } // end if
-  if (right_hand_side_ != nullptr) {
-    delete[] right_hand_side_;
-    right_hand_side_ = nullptr;
-  } // end if
-  if (system_solution_ != nullptr) {
-    delete[] system_solution_;
-    system_solution_ = nullptr;
-  } // end if
-  if (system_solution_best_ != nullptr) {
-    delete[] system_solution_best_;
-    system_solution_best_ = nullptr;
-  } // end if
-  if (factor_ != nullptr) {
-    delete[] factor_;
-    factor_ = nullptr;
-  } // end if
-
-  // Allocate arrays
-  inner_solution_1_ = new double[system_solution_length_];
-  inner_solution_2_ = new double[system_solution_length_];
-  inner_solution_3_ = new double[system_solution_length_];
-  inner_solution_ls_ = new double[system_solution_length_];
-  inner_solution_trial_ = new double[system_solution_length_];
-  new_system_vector_ = new double[system_solution_length_];
-  right_hand_side_ = new double[system_solution_length_];
-  system_solution_ = new double[system_solution_length_];
-  system_solution_best_ = new double[system_solution_length_];
-  factor_ = new double[factor_length_];
+  // Clear cached quantities
+  bundle_.clear();
+  bundle_columns_ = 0;
+  bundle_products_count_ = 0;
+  bundle_products_vector_.clear();
+  gram_matrix_ = nullptr;
+  gram_products_.clear();
+  cache_vector_list_.clear();
+
+  // Clear warm start quantities
+  warm_start_vector_list_.clear();
+  warm_start_gamma_positive_.clear();
+  warm_start_gamma_negative_.clear();
+  warm_start_solution_.clear();
+
+  // Set factor indicators
+  factor_outdated_ = false;
+  min_norm_point_fallback_ = false;
+
+  // Set column length
+  column_.setLength(gamma_length_);
+
+  // Reserve arrays (retained across calls, so reallocation only occurs for larger lengths)
+  factor_ = workspace_.reserve(WA_FACTOR, factor_length_);
+  inner_solution_1_ = workspace_.reserve(WA_INNER_SOLUTION_1, system_solution_length_);
+  inner_solution_2_ = workspace_.reserve(WA_INNER_SOLUTION_2, system_solution_length_);
+  inner_solution_3_ = workspace_.reserve(WA_INNER_SOLUTION_3, system_solution_length_);
+  inner_solution_ls_ = workspace_.reserve(WA_INNER_SOLUTION_LS, system_solution_length_);
+  inner_solution_trial_ = workspace_.reserve(WA_INNER_SOLUTION_TRIAL, system_solution_length_);
+  new_system_vector_ = workspace_.reserve(WA_NEW_SYSTEM_VECTOR, system_solution_length_);
+  right_hand_side_ = workspace_.reserve(WA_RIGHT_HAND_SIDE, system_solution_length_);
+  system_solution_ = workspace_.reserve(WA_SYSTEM_SOLUTION, system_solution_length_);
+  system_solution_best_ = workspace_.reserve(WA_SYSTEM_SOLUTION_BEST, system_solution_length_);
 
   // Set status
   setStatus(QP_UNSET);
@@ -424,11 +402,27 @@ void QPSolverDualActiveSet::dualSolutionOmega(double omega[])
 double QPSolverDualActiveSet::KKTErrorDual()
 {
 
+  // Update cached quantities (for bundle)
+  updateCache();
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'T';
+  char no_transpose = 'N';
+  int size = (int)vector_list_.size();
+  int increment = 1;
+  double one = 1.0;
+  double zero = 0.0;
+
   // Evaluate gradient combination
   Vector Gomega(gamma_length_, 0.0);
-  for (int i = 0; i < (int)vector_list_.size(); i++) {
-    Gomega.addScaledVector(omega_.values()[i], *vector_list_[i].get());
+  if (size > 0 && bundle_columns_ == size) {
+    dgemv_(&no_transpose, &gamma_length_, &size, &one, bundle_.data(), &gamma_length_, omega_.values(), &increment, &zero, Gomega.valuesModifiable(), &increment);
   }
+  else {
+    for (int i = 0; i < size; i++) {
+      Gomega.addScaledVector(omega_.values()[i], *vector_list_[i]);
+    }
+  } // end else
 
   // Declare dual vector
   Vector d0(gamma_length_, 0.0);
@@ -440,9 +434,14 @@ double QPSolverDualActiveSet::KKTErrorDual()
   // Evaluate gradient inner products
   Vector Gtd;
   Gtd.setLength((int)vector_.size());
-  for (int i = 0; i < (int)vector_list_.size(); i++) {
-    Gtd.values()[i] = vector_list_[i]->innerProduct(d);
+  if (size > 0 && bundle_columns_ == size) {
+    dgemv_(&transpose, &gamma_length_, &size, &one, bundle_.data(), &gamma_length_, d.values(), &increment, &zero, Gtd.valuesModifiable(), &increment);
   }
+  else {
+    for (int i = 0; i < size; i++) {
+      Gtd.set(i, vector_list_[i]->innerProduct(d));
+    }
+  } // end else
 
   // Evaluate dual scalar
   double z = omega_.innerProduct(Gtd);
@@ -820,6 +819,10 @@ void QPSolverDualActiveSet::solveQP(const Options* options,
   setStatus(QP_UNSET);
   setNullSolution();
 
+  // Take fallback indicator from caller (cleared so that it does not outlive this solve)
+  bool min_norm_point_fallback = min_norm_point_fallback_;
+  min_norm_point_fallback_ = false;
+
   // try to solve QP, terminate on any exception
   try {
 
@@ -828,15 +831,43 @@ void QPSolverDualActiveSet::solveQP(const Options* options,
       THROW_EXCEPTION(QP_INPUT_ERROR_EXCEPTION, "QP solve unsuccessful. Input error.");
     }
 
+    // Check for infinite scalar, in which case solve by minimum-norm-point method (unless it fell back)
+    if (min_norm_point_ && !min_norm_point_fallback && scalar_ >= NONOPT_DOUBLE_INFINITY) {
+      if (solveQPMinNormPoint(reporter, quantities, false)) {
+        return;
+      }
+      min_norm_point_fallback = true;
+    } // end if
+
+    // Update cached quantities
+    updateCache();
+
+    // Set factor indicator (factor is set from scratch below)
+    factor_outdated_ = false;
+
+    // Try to seed sets from last solve, in which case solve hot
+    if (warmStartSets(reporter)) {
+      min_norm_point_fallback_ = min_norm_point_fallback;
+      solveQPHot(options, reporter, quantities);
+      return;
+    }
+
     // Initialize minimum index and value
     int index = -1;
     double value = NONOPT_DOUBLE_INFINITY;
 
+    // Compute Gram cache products by a single matrix-matrix product
+    std::vector<int> all_indices((int)vector_list_.size());
+    for (int i = 0; i < (int)vector_list_.size(); i++) {
+      all_indices[i] = i;
+    }
+    gramProducts(all_indices);
+
     // Loop through vector list
     for (int i = 0; i < (int)vector_list_.size(); i++) {
 
       // Compute objective value 0.5*g_i^T*W*g_i-b_i
-      double t = 0.5 * matrix_->innerProductOfInverse(*vector_list_[i]) - vector_[i];
+      double t = 0.5 * gramElement(i, i) - vector_[i];
 
       // Check for minimum
       if (i == 0 || t < value) {
@@ -858,7 +889,7 @@ void QPSolverDualActiveSet::solveQP(const Options* options,
     omega_positive_.push_back(index);
 
     // Set factor
-    factor_[0] = sqrt(1.0 + matrix_->innerProductOfInverse(*vector_list_[index]));
+    factor_[0] = sqrt(1.0 + gramElement(index, index));
 
     // Set dual multiplier b_i-g_i^T*W*g_i
     multiplier_ = 1.0 + vector_[index] - pow(factor_[0], 2);
@@ -870,6 +901,7 @@ void QPSolverDualActiveSet::solveQP(const Options* options,
     inner_solution_2_[0] = vector_[index] / factor_[0];
 
     // Solve hot
+    min_norm_point_fallback_ = min_norm_point_fallback;
     solveQPHot(options, reporter, quantities);
 
   } // end try
@@ -891,6 +923,10 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
   iteration_count_ = 0;
   kkt_error_ = -NONOPT_DOUBLE_INFINITY;
 
+  // Take fallback indicator from caller (cleared so that it does not outlive this solve)
+  bool min_norm_point_fallback = min_norm_point_fallback_;
+  min_norm_point_fallback_ = false;
+
   // try to solve QP with hot start, terminate on any exception
   try {
 
@@ -899,6 +935,24 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
       THROW_EXCEPTION(QP_INPUT_ERROR_EXCEPTION, "QP solve unsuccessful. Input error.");
     }
 
+    // Check for infinite scalar, in which case solve by minimum-norm-point method (unless it fell back)
+    if (min_norm_point_ && !min_norm_point_fallback && scalar_ >= NONOPT_DOUBLE_INFINITY) {
+      if (solveQPMinNormPoint(reporter, quantities, true)) {
+        return;
+      }
+      min_norm_point_fallback = true;
+    } // end if
+
+    // Check whether factor corresponds to sets, otherwise solve from scratch
+    if (factor_outdated_) {
+      min_norm_point_fallback_ = min_norm_point_fallback;
+      solveQP(options, reporter, quantities);
+      return;
+    }
+
+    // Update cached quantities (keeping those for vectors unchanged since last solve)
+    updateCache();
+
     // Print message
     reporter->printf(R_QP, R_PER_ITERATION, "\n");
     reporter->printf(R_QP, R_PER_INNER_ITERATION, "Entering main iteration loop\n");
@@ -906,6 +960,9 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
     // Set iteration limit
     int iteration_limit = fmax(iteration_limit_minimum_, fmin(2 * ((int)vector_list_.size() + gamma_length_), iteration_limit_maximum_));
 
+    // Set block pivoting indicator
+    bool block_pivoting = (block_size_ > 1);
+
     // Iteration loop
     while (true) {
 
@@ -955,18 +1012,21 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
         THROW_EXCEPTION(QP_NAN_ERROR_EXCEPTION, "QP solve unsuccessful.  NaN error.");
       }
 
-      // Initialize solution and KKT vectors
-      std::vector<double> kkt_residual_omega((int)vector_.size(), 0.0);
-      std::vector<double> kkt_residual_gamma_positive(gamma_length_, 0.0);
-      std::vector<double> kkt_residual_gamma_negative(gamma_length_, 0.0);
+      // Initialize KKT vectors (from workspace)
+      double* kkt_residual_omega = workspace_.reserve(WA_KKT_RESIDUAL_OMEGA, (int)vector_.size());
+      double* kkt_residual_gamma_positive = workspace_.reserve(WA_KKT_RESIDUAL_GAMMA_POSITIVE, gamma_length_);
+      double* kkt_residual_gamma_negative = workspace_.reserve(WA_KKT_RESIDUAL_GAMMA_NEGATIVE, gamma_length_);
 
       // Declare KKT minimum element set
       int kkt_residual_minimum_set;
       int kkt_residual_minimum_index;
 
+      // Evaluate bundle products G^Td
+      evaluateBundleProducts(primal_solution_);
+
       // Evaluate omega's KKT error components  -g_i^T*W*g_i-g_i^Td
       for (int i = 0; i < (int)vector_.size(); i++) {
-        kkt_residual_omega[i] = multiplier_ - vector_[i] - vector_list_[i]->innerProduct(primal_solution_);
+        kkt_residual_omega[i] = multiplier_ - vector_[i] - bundle_products_[i];
       }
 
       // Zero-out omega's KKT error components for positive set
@@ -995,9 +1055,9 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
       }
 
       // Determine minimum element indices
-      int kkt_residual_omega_minimum_index = distance(kkt_residual_omega.begin(), min_element(kkt_residual_omega.begin(), kkt_residual_omega.end()));
-      int kkt_residual_gamma_positive_minimum_index = distance(kkt_residual_gamma_positive.begin(), min_element(kkt_residual_gamma_positive.begin(), kkt_residual_gamma_positive.end()));
-      int kkt_residual_gamma_negative_minimum_index = distance(kkt_residual_gamma_negative.begin(), min_element(kkt_residual_gamma_negative.begin(), kkt_residual_gamma_negative.end()));
+      int kkt_residual_omega_minimum_index = (int)(std::min_element(kkt_residual_omega, kkt_residual_omega + (int)vector_.size()) - kkt_residual_omega);
+      int kkt_residual_gamma_positive_minimum_index = (int)(std::min_element(kkt_residual_gamma_positive, kkt_residual_gamma_positive + gamma_length_) - kkt_residual_gamma_positive);
+      int kkt_residual_gamma_negative_minimum_index = (int)(std::min_element(kkt_residual_gamma_negative, kkt_residual_gamma_negative + gamma_length_) - kkt_residual_gamma_negative);
 
       // Set minimum elements
       double kkt_residual_omega_minimum = kkt_residual_omega[kkt_residual_omega_minimum_index];
@@ -1071,6 +1131,57 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
         THROW_EXCEPTION(QP_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
       }
 
+      // Check for wall time limit
+      if (quantities->currentWallTime() - quantities->startWallTime() >= quantities->wallTimeLimit()) {
+        THROW_EXCEPTION(QP_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+      }
+
+      // Check for block pivoting
+      if (block_pivoting && kkt_residual_minimum_set == 1 && gamma_positive_.size() == 0 && gamma_negative_.size() == 0) {
+
+        // Collect violated omega constraints, most violated first
+        std::vector<int> block_indices;
+        for (int i = 0; i < (int)vector_.size(); i++) {
+          if (kkt_residual_omega[i] < -kkt_tolerance_) {
+            block_indices.push_back(i);
+          }
+        } // end for
+        std::sort(block_indices.begin(), block_indices.end(), [kkt_residual_omega](int i, int j) { return kkt_residual_omega[i] < kkt_residual_omega[j]; });
+        if ((int)block_indices.size() > block_size_) {
+          block_indices.resize(block_size_);
+        }
+
+        // Set size of positive set before augmentation
+        int size_before = (int)omega_positive_.size();
+
+        // Perform block augmentation (if more than one violated constraint)
+        if (block_indices.size() > 1 && setAugmentBlock(reporter, block_indices)) {
+
+          // Print message
+          reporter->printf(R_QP, R_PER_ITERATION, "  1x%d", (int)block_indices.size());
+
+          // Compute multiplier
+          evaluatePrimalMultiplier(inner_solution_1_, inner_solution_2_);
+
+          // Solve subproblem (deleting elements from sets as needed)
+          solveSubproblem(reporter);
+
+          // Check for stalled progress, in which case use single pivots for rest of solve
+          if ((int)omega_positive_.size() <= size_before) {
+            reporter->printf(R_QP, R_PER_INNER_ITERATION, "Block pivoting stalled! Adding single constraints\n");
+            block_pivoting = false;
+          } // end if
+
+          // Print new line
+          reporter->printf(R_QP, R_PER_ITERATION, "\n");
+
+          // Continue to next iteration
+          continue;
+
+        } // end if
+
+      } // end if
+
       // Print message
       reporter->printf(R_QP, R_PER_ITERATION, "  %d", kkt_residual_minimum_set);
       reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be added to index set %d\n", kkt_residual_minimum_index, kkt_residual_minimum_set);
@@ -1089,7 +1200,7 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
 
       // Check which set is being updated
       if (kkt_residual_minimum_set == 1) {
-        new_diagonal_squared = 1.0 + matrix_->innerProductOfInverse(*vector_list_[kkt_residual_minimum_index]);
+        new_diagonal_squared = 1.0 + gramElement(kkt_residual_minimum_index, kkt_residual_minimum_index);
       }
       else {
         new_diagonal_squared = matrix_->elementOfInverse(kkt_residual_minimum_index, kkt_residual_minimum_index);
@@ -1284,163 +1395,8 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
       // Compute multiplier
       evaluatePrimalMultiplier(inner_solution_1_, inner_solution_2_);
 
-      // Set inner iteration limit
-      int inner_iteration_limit = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
-
-      // Subproblem solution loop
-      for (int inner_iteration_count = 0; inner_iteration_count < inner_iteration_limit; inner_iteration_count++) {
-
-        // Print message
-        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Solving subproblem\n");
-
-        // Set inputs for BLASLAPACK
-        int length = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
-        int increment = 1;
-        double value = 1.0 - multiplier_;
-
-        // Set right-hand side vector
-        dcopy_(&length, inner_solution_2_, &increment, right_hand_side_, &increment);
-        daxpy_(&length, &value, inner_solution_1_, &increment, right_hand_side_, &increment);
-
-        // Solve subproblem
-        solveSystem(right_hand_side_, inner_solution_trial_);
-
-        // Declare boolean for correct signs
-        bool correct_signs = true;
-
-        // Check signs of subproblem solution elements
-        if (correct_signs) {
-          for (int i = 0; i < (int)omega_positive_.size() + (int)gamma_positive_.size(); i++) {
-            if (inner_solution_trial_[i] <= 0.0) {
-              correct_signs = false;
-              break;
-            } // end if
-          }   // end for
-        }     // end if
-        if (correct_signs) {
-          for (int i = 0; i < (int)gamma_negative_.size(); i++) {
-            if (inner_solution_trial_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] >= 0.0) {
-              correct_signs = false;
-              break;
-            } // end if
-          }   // end for
-        }     // end if
-
-        // Check feasibility of subproblem solution
-        if (correct_signs) {
-
-          // Print message
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "Feasible subproblem solution! Breaking loop\n");
-
-          // Replace current solution
-          dcopy_(&length, inner_solution_trial_, &increment, system_solution_, &increment);
-
-          // Break subproblem solution loop
-          break;
-
-        } // end if
-        else {
-
-          // Print message
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "Infeasible subproblem solution! Looking for index to delete\n");
-
-          // Initialize minimum index and values
-          int delete_index = -1;
-          double delete_value = NONOPT_DOUBLE_INFINITY;
-          int delete_set = -1;
-
-          // Compute index with minimum value
-          for (int i = 0; i < (int)omega_positive_.size(); i++) {
-            if (inner_solution_trial_[i] < 0.0) {
-              double temporary_scalar = system_solution_[i] / (system_solution_[i] - inner_solution_trial_[i]);
-              if (temporary_scalar < delete_value) {
-                delete_index = i;
-                delete_value = temporary_scalar;
-                delete_set = 1;
-              } // end if
-            }   // end if
-          }     // end for
-          for (int i = 0; i < (int)gamma_positive_.size(); i++) {
-            if (inner_solution_trial_[(int)omega_positive_.size() + i] < 0.0) {
-              double temporary_scalar = system_solution_[(int)omega_positive_.size() + i] / (system_solution_[(int)omega_positive_.size() + i] - inner_solution_trial_[(int)omega_positive_.size() + i]);
-              if (temporary_scalar < delete_value) {
-                delete_index = i;
-                delete_value = temporary_scalar;
-                delete_set = 2;
-              } // end if
-            }   // end if
-          }     // end for
-          for (int i = 0; i < (int)gamma_negative_.size(); i++) {
-            if (inner_solution_trial_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] > 0.0) {
-              double temporary_scalar = system_solution_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] / (system_solution_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] - inner_solution_trial_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i]);
-              if (temporary_scalar < delete_value) {
-                delete_index = i;
-                delete_value = temporary_scalar;
-                delete_set = 3;
-              } // end if
-            }   // end if
-          }     // end for
-
-          // Print message
-          reporter->printf(R_QP, R_PER_ITERATION, "  %+d", -delete_set);
-          if (delete_set == 1) {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from omega's positive set\n", omega_positive_[delete_index]);
-          }
-          else if (delete_set == 2) {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from gamma's positive set\n", gamma_positive_[delete_index]);
-          }
-          else if (delete_set == 3) {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from gamma's negative set\n", gamma_negative_[delete_index]);
-          }
-          else {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, "Uh oh!  Search for element to delete failed!\n");
-          }
-
-          // Check if search for element to delete was successful
-          if (delete_set > 0) {
-
-            // Update value
-            delete_value = fmin(1.0, delete_value);
-
-            // Set inputs for BLASLAPACK
-            int length = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
-            double value = 1.0 - delete_value;
-            int increment = 1;
-
-            // Scale solution
-            dscal_(&length, &value, system_solution_, &increment);
-
-            // Update solution
-            daxpy_(&length, &delete_value, inner_solution_trial_, &increment, system_solution_, &increment);
-
-            // Perform set deletion
-            setDelete(reporter, delete_set, delete_index, inner_solution_1_, inner_solution_2_);
-
-            // Evaluate multiplier
-            evaluatePrimalMultiplier(inner_solution_1_, inner_solution_2_);
-
-          } // end if
-
-          // Print sets
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "omega_positive (%6d elements):", (int)omega_positive_.size());
-          for (int i = 0; i < (int)omega_positive_.size(); i++) {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, " %d", omega_positive_[i]);
-          }
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "\n");
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "gamma_positive (%6d elements):", (int)gamma_positive_.size());
-          for (int i = 0; i < (int)gamma_positive_.size(); i++) {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, " %d", gamma_positive_[i]);
-          }
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "\n");
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "gamma_negative (%6d elements):", (int)gamma_negative_.size());
-          for (int i = 0; i < (int)gamma_negative_.size(); i++) {
-            reporter->printf(R_QP, R_PER_INNER_ITERATION, " %d", gamma_negative_[i]);
-          }
-          reporter->printf(R_QP, R_PER_INNER_ITERATION, "\n");
-
-        } // end else (correct_signs)
-
-      } // end for (subproblem solution loop)
+      // Solve subproblem (deleting elements from sets as needed)
+      solveSubproblem(reporter);
 
       // Print new line
       reporter->printf(R_QP, R_PER_ITERATION, "\n");
@@ -1455,6 +1411,9 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
   } catch (QP_CPU_TIME_LIMIT_EXCEPTION& exec) {
     setStatus(QP_CPU_TIME_LIMIT);
     THROW_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+  } catch (QP_WALL_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_WALL_TIME_LIMIT);
+    THROW_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
   } catch (QP_FACTORIZATION_ERROR_EXCEPTION& exec) {
     setStatus(QP_FACTORIZATION_ERROR);
   } catch (QP_INPUT_ERROR_EXCEPTION& exec) {
@@ -1474,6 +1433,9 @@ void QPSolverDualActiveSet::solveQPHot(const Options* options,
   // Finalize solution
   finalizeSolution();
 
+  // Record sets for warm start
+  warmStartRecord();
+
 } // end solveQPHot
 
 // Print method
@@ -1598,44 +1560,30 @@ bool QPSolverDualActiveSet::choleskyAugment(double system_vector[],
   int length = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
 
   // Resize factor_?
-  while ((length - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
-
-    // Declare temporary vector
-    double* factor_temp = new double[factor_length_];
-
-    // Set inputs for BLASLAPACK
-    int increment = 1;
-
-    // Copy factor_ to temporary vector
-    dcopy_(&factor_length_, factor_, &increment, factor_temp, &increment);
-
-    // Delete factor_ and resize
-    delete[] factor_;
-    factor_ = nullptr;
-    int factor_length_new = 2 * factor_length_;
-    factor_ = new double[factor_length_new];
-
-    // Copy temporary vector back to factor_
-    dcopy_(&factor_length_, factor_temp, &increment, factor_, &increment);
-
-    // Set new factor length
-    factor_length_ = factor_length_new;
+  if ((length - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
+    while ((length - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
+      factor_length_ = 2 * factor_length_;
+    }
+    factor_ = workspace_.reserve(WA_FACTOR, factor_length_);
+  } // end if
 
-  } // end while
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'L'; // Use "lower" since Fortran uses column-major ordering
+  char transpose = 'N';   // Use "not transpose" since Fortran uses column-major ordering
+  char diagonal = 'N';
+  int increment1 = 1;
+  int incrementn = system_solution_length_;
+  int trailing = length - index - 1;
 
-  // "Add" zero values to R by shifting values
-  for (int i = 0; i < length; i++) {
-    for (int j = length - 1; j > index; j--) {
-      factor_[i * system_solution_length_ + j] = factor_[i * system_solution_length_ + j - 1];
-    }
+  // "Add" zero values to R by shifting values in rows, then shifting rows
+  for (int i = 0; i < length - 1; i++) {
+    memmove(&factor_[i * system_solution_length_ + index + 1], &factor_[i * system_solution_length_ + index], trailing * sizeof(double));
     factor_[i * system_solution_length_ + index] = 0.0;
   } // end for
-  for (int j = 0; j < length; j++) {
-    for (int i = length - 1; i > index; i--) {
-      factor_[i * system_solution_length_ + j] = factor_[(i - 1) * system_solution_length_ + j];
-    }
-    factor_[index * system_solution_length_ + j] = 0.0;
-  } // end for
+  for (int i = length - 1; i > index; i--) {
+    memmove(&factor_[i * system_solution_length_], &factor_[(i - 1) * system_solution_length_], length * sizeof(double));
+  }
+  memset(&factor_[index * system_solution_length_], 0, length * sizeof(double));
 
   // "Add" zero values to solutions by shifting values
   for (int i = length - 1; i > index; i--) {
@@ -1645,19 +1593,14 @@ bool QPSolverDualActiveSet::choleskyAugment(double system_vector[],
   solution1[index] = 0.0;
   solution2[index] = 0.0;
 
-  // Update Cholesky factor (first part)
-  for (int i = 0; i < index; i++) {
-    factor_[i * system_solution_length_ + index] = system_vector[i] / factor_[i * system_solution_length_ + i];
-    for (int j = i + 1; j < index; j++) {
-      system_vector[j] = system_vector[j] - factor_[i * system_solution_length_ + j] * factor_[i * system_solution_length_ + index];
-    }
-  } // end for
+  // Update Cholesky factor (first part), i.e., solve R^T*r = v for leading part of new column
+  if (index > 0) {
+    dtrsv_(&upper_lower, &transpose, &diagonal, &index, factor_, &incrementn, system_vector, &increment1);
+    dcopy_(&index, system_vector, &increment1, &factor_[index], &incrementn);
+  } // end if
 
   // Compute temporary scalar
-  double temporary_scalar = 0.0;
-  for (int i = 0; i < index; i++) {
-    temporary_scalar = temporary_scalar + factor_[i * system_solution_length_ + index] * factor_[i * system_solution_length_ + index];
-  }
+  double temporary_scalar = (index > 0) ? ddot_(&index, &factor_[index], &incrementn, &factor_[index], &incrementn) : 0.0;
 
   // Check diagonal element tolerances
   double diagonal_squared = system_vector[index] - temporary_scalar;
@@ -1669,42 +1612,43 @@ bool QPSolverDualActiveSet::choleskyAugment(double system_vector[],
     success_without_factorization_error = false;
   } // end else
 
-  // Update Cholesky factor (third part)
-  for (int i = index + 1; i < length; i++) {
-    temporary_scalar = 0.0;
-    for (int j = 0; j < index; j++) {
-      temporary_scalar = temporary_scalar + factor_[j * system_solution_length_ + i] * factor_[j * system_solution_length_ + index];
-    }
-    factor_[index * system_solution_length_ + i] = (system_vector[i] - temporary_scalar) / factor_[index * system_solution_length_ + index];
-  } // end for
+  // Update Cholesky factor (third part), i.e., set trailing part of new row
+  double* row = &factor_[index * system_solution_length_ + index + 1];
+  if (trailing > 0) {
+    dcopy_(&trailing, &system_vector[index + 1], &increment1, row, &increment1);
+    char no_transpose = 'N';
+    double minus_one = -1.0;
+    double one = 1.0;
+    dgemv_(&no_transpose, &trailing, &index, &minus_one, &factor_[index + 1], &incrementn, &factor_[index], &incrementn, &one, row, &increment1);
+    double scale = 1.0 / factor_[index * system_solution_length_ + index];
+    dscal_(&trailing, &scale, row, &increment1);
+  } // end if
 
   // Update solution1
-  temporary_scalar = 0.0;
-  for (int i = 0; i < index; i++) {
-    temporary_scalar = temporary_scalar + solution1[i] * factor_[i * system_solution_length_ + index];
-  }
+  temporary_scalar = (index > 0) ? ddot_(&index, solution1, &increment1, &factor_[index], &incrementn) : 0.0;
   solution1[index] = (value1 - temporary_scalar) / factor_[index * system_solution_length_ + index];
 
   // Update solution2
-  temporary_scalar = 0.0;
-  for (int i = 0; i < index; i++) {
-    temporary_scalar = temporary_scalar + solution2[i] * factor_[i * system_solution_length_ + index];
-  }
+  temporary_scalar = (index > 0) ? ddot_(&index, solution2, &increment1, &factor_[index], &incrementn) : 0.0;
   solution2[index] = (value2 - temporary_scalar) / factor_[index * system_solution_length_ + index];
 
-  // Declare and initialize temporary vector
-  double* temporary_vector = new double[length - index + 1];
-  for (int i = 0; i < length - index - 1; i++) {
-    temporary_vector[i] = factor_[index * system_solution_length_ + index + i + 1];
+  // Declare and initialize temporary vector (from workspace)
+  double* temporary_vector = workspace_.reserve(WA_TEMPORARY_VECTOR, trailing + 2);
+  if (trailing > 0) {
+    dcopy_(&trailing, row, &increment1, temporary_vector, &increment1);
   }
-  temporary_vector[length - index - 1] = solution1[index];
-  temporary_vector[length - index] = solution2[index];
+  temporary_vector[trailing] = solution1[index];
+  temporary_vector[trailing + 1] = solution2[index];
 
-  // Update Cholesky factor (last part)
+  // Update Cholesky factor (last part), i.e., downdate trailing rows by hyperbolic rotations
   for (int i = index + 1; i < length; i++) {
 
+    // Set offset of element in temporary vector and number of elements to right of diagonal
+    int k = i - index - 1;
+    int count = length - i - 1;
+
     // Declare and initialize scalar
-    double t_squared = factor_[i * system_solution_length_ + i] * factor_[i * system_solution_length_ + i] - temporary_vector[i - index - 1] * temporary_vector[i - index - 1];
+    double t_squared = factor_[i * system_solution_length_ + i] * factor_[i * system_solution_length_ + i] - temporary_vector[k] * temporary_vector[k];
     double t = 0.0;
 
     // Check diagonal element tolerances
@@ -1718,33 +1662,32 @@ bool QPSolverDualActiveSet::choleskyAugment(double system_vector[],
 
     // Declare and set rotation values
     double c = t / factor_[i * system_solution_length_ + i];
-    double s = temporary_vector[i - index - 1] / factor_[i * system_solution_length_ + i];
+    double s = temporary_vector[k] / factor_[i * system_solution_length_ + i];
 
     // Update factor values
     factor_[i * system_solution_length_ + i] = t;
-    for (int j = i + 1; j < length; j++) {
-      factor_[i * system_solution_length_ + j] = (factor_[i * system_solution_length_ + j] - s * temporary_vector[j - index - 1]) / c;
-    }
+    if (count > 0) {
+      double minus_s = -s;
+      double c_inverse = 1.0 / c;
+      daxpy_(&count, &minus_s, &temporary_vector[k + 1], &increment1, &factor_[i * system_solution_length_ + i + 1], &increment1);
+      dscal_(&count, &c_inverse, &factor_[i * system_solution_length_ + i + 1], &increment1);
+    } // end if
 
     // Update solution values
-    solution1[i] = (solution1[i] - s * temporary_vector[length - index - 1]) / c;
-    solution2[i] = (solution2[i] - s * temporary_vector[length - index]) / c;
+    solution1[i] = (solution1[i] - s * temporary_vector[trailing]) / c;
+    solution2[i] = (solution2[i] - s * temporary_vector[trailing + 1]) / c;
 
     // Update temporary vector values
-    for (int j = i + 1; j < length; j++) {
-      temporary_vector[j - index - 1] = c * temporary_vector[j - index - 1] - s * factor_[i * system_solution_length_ + j];
-    }
-    temporary_vector[length - index - 1] = c * temporary_vector[length - index - 1] - s * solution1[i];
-    temporary_vector[length - index] = c * temporary_vector[length - index] - s * solution2[i];
+    if (count > 0) {
+      double minus_s = -s;
+      dscal_(&count, &c, &temporary_vector[k + 1], &increment1);
+      daxpy_(&count, &minus_s, &factor_[i * system_solution_length_ + i + 1], &increment1, &temporary_vector[k + 1], &increment1);
+    } // end if
+    temporary_vector[trailing] = c * temporary_vector[trailing] - s * solution1[i];
+    temporary_vector[trailing + 1] = c * temporary_vector[trailing + 1] - s * solution2[i];
 
   } // end for
 
-  // Delete temporary vector
-  if (temporary_vector != nullptr) {
-    delete[] temporary_vector;
-    temporary_vector = nullptr;
-  } // end if
-
   // Return
   return success_without_factorization_error;
 
@@ -1759,34 +1702,27 @@ void QPSolverDualActiveSet::choleskyDelete(int index,
   // Set new length
   int length = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
 
-  // "Delete" column of R by shifting columns to the left
+  // "Delete" column of R by shifting values in rows to the left
   for (int i = 0; i <= length; i++) {
-    for (int j = index; j < length; j++) {
-      factor_[i * system_solution_length_ + j] = factor_[i * system_solution_length_ + j + 1];
-    }
-  } // end for
+    memmove(&factor_[i * system_solution_length_ + index], &factor_[i * system_solution_length_ + index + 1], (length - index) * sizeof(double));
+  }
+
+  // Set inputs for BLASLAPACK
+  int increment = 1;
 
-  // Apply Givens rotations
+  // Apply Givens rotations (to pairs of contiguous rows)
   for (int i = index; i < length; i++) {
 
     // Compute scalars
     double p = factor_[i * system_solution_length_ + i];
     double q = factor_[(i + 1) * system_solution_length_ + i];
-    double c = p / sqrt(p * p + q * q);
-    double s = q / sqrt(p * p + q * q);
-
-    // Loop over columns
-    for (int j = i; j < length; j++) {
-
-      // Perform rotation for factor values
-      double y = c * factor_[i * system_solution_length_ + j] + s * factor_[(i + 1) * system_solution_length_ + j];
-      double z = -s * factor_[i * system_solution_length_ + j] + c * factor_[(i + 1) * system_solution_length_ + j];
+    double r = sqrt(p * p + q * q);
+    double c = p / r;
+    double s = q / r;
 
-      // Set new factor values
-      factor_[i * system_solution_length_ + j] = y;
-      factor_[(i + 1) * system_solution_length_ + j] = z;
-
-    } // end for
+    // Perform rotation for factor values
+    int count = length - i;
+    drot_(&count, &factor_[i * system_solution_length_ + i], &increment, &factor_[(i + 1) * system_solution_length_ + i], &increment, &c, &s);
 
     // Set new zero value
     factor_[(i + 1) * system_solution_length_ + i] = 0.0;
@@ -1812,70 +1748,130 @@ void QPSolverDualActiveSet::choleskyDelete(int index,
 } // end choleskyDelete
 
 // Cholesky factorization from scratch
-void QPSolverDualActiveSet::choleskyFromScratch(const Reporter* reporter)
+bool QPSolverDualActiveSet::choleskyFromScratch(const Reporter* reporter)
 {
 
-  // Set size of matrix
+  // Initialize return value
+  bool success_without_factorization_error = true;
+
+  // Set size of matrix and of blocks
   int size = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
+  int size_omega = (int)omega_positive_.size();
+  int size_gamma_positive = (int)gamma_positive_.size();
 
   // Print message
   reporter->printf(R_QP, R_PER_INNER_ITERATION, "Re-doing Cholesky of size %d\n", size);
 
-  // Declare matrix and initialize
-  double* matrix = new double[size * size];
-  for (int i = 0; i < size * size; i++) {
-    matrix[i] = 0.0;
-  }
+  // Resize factor_?
+  if ((size - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
+    while ((size - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
+      factor_length_ = 2 * factor_length_;
+    }
+    factor_ = workspace_.reserve(WA_FACTOR, factor_length_);
+  } // end if
+
+  // Count Gram cache elements of (1,1)-block (upper triangle) not yet computed
+  int missing = 0;
+  for (int i = 0; i < size_omega; i++) {
+    for (int j = i; j < size_omega; j++) {
+      if (!gram_elements_computed_[omega_positive_[i] * gram_capacity_ + omega_positive_[j]]) {
+        missing++;
+      }
+    } // end for
+  }   // end for
 
-  // Declare WG vectors
-  std::vector<std::shared_ptr<Vector>> WG;
+  // Compute (1,1)-block by matrix-matrix products if more than a column is missing
+  if (missing > size_omega) {
 
-  // Compute WG matrix
-  for (int i = 0; i < (int)omega_positive_.size(); i++) {
-    std::shared_ptr<Vector> product(new Vector(gamma_length_));
-    matrix_->matrixVectorProductOfInverse(*vector_list_[omega_positive_[i]], *product);
-    WG.push_back(product);
-  } // end for
+    // Compute Gram cache products not yet computed
+    std::vector<int> omega_positive(omega_positive_.begin(), omega_positive_.end());
+    gramProducts(omega_positive);
 
-  // Compute (1,1)-block (upper triangle)
-  for (int i = 0; i < (int)omega_positive_.size(); i++) {
-    for (int j = i; j < (int)omega_positive_.size(); j++) {
-      matrix[i * size + j] = 1.0 + vector_list_[omega_positive_[i]]->innerProduct(*WG[j]);
+    // Set inputs for BLASLAPACK
+    char transpose = 'T';
+    char no_transpose = 'N';
+    double one = 1.0;
+    double zero = 0.0;
+
+    // Loop over blocks of columns
+    for (int first_column = 0; first_column < size_omega; first_column += column_block_length_) {
+
+      // Gather products (into workspace)
+      int columns = std::min(column_block_length_, size_omega - first_column);
+      double* bundle_products = workspace_.reserve(WA_TEMPORARY_BUNDLE_PRODUCTS, (size_t)columns * gamma_length_);
+      for (int j = 0; j < columns; j++) {
+        memcpy(&bundle_products[(size_t)j * gamma_length_], gramProduct(omega_positive[first_column + j]).values(), gamma_length_ * sizeof(double));
+      }
+
+      // Loop over blocks of rows
+      for (int first_row = 0; first_row < size_omega; first_row += column_block_length_) {
+
+        // Compute G_I^T*(W*G_J) (so that element (i,j), in column-major order, is g_i^T*W*g_j)
+        int rows = std::min(column_block_length_, size_omega - first_row);
+        double* elements = workspace_.reserve(WA_TEMPORARY_MATRIX, (size_t)rows * columns);
+        dgemm_(&transpose, &no_transpose, &rows, &columns, &gamma_length_, &one, bundleColumns(omega_positive, first_row, rows), &gamma_length_, bundle_products, &gamma_length_, &zero, elements, &rows);
+
+        // Store elements not yet computed in Gram cache
+        for (int i = 0; i < rows; i++) {
+          for (int j = 0; j < columns; j++) {
+            int position = omega_positive[first_row + i] * gram_capacity_ + omega_positive[first_column + j];
+            if (!gram_elements_computed_[position]) {
+              gram_elements_[position] = elements[j * rows + i];
+              gram_elements_computed_[position] = true;
+            } // end if
+          }   // end for
+        }     // end for
+
+      } // end for
+
+    } // end for
+
+  } // end if
+
+  // Initialize factor (values left of diagonal)
+  for (int i = 0; i < size; i++) {
+    memset(&factor_[i * system_solution_length_], 0, i * sizeof(double));
+  }
+
+  // Compute (1,1)-block (upper triangle) from Gram cache
+  for (int i = 0; i < size_omega; i++) {
+    for (int j = i; j < size_omega; j++) {
+      factor_[i * system_solution_length_ + j] = 1.0 + gramElement(omega_positive_[i], omega_positive_[j]);
     }
   } // end for
 
   // Compute (1,2)-block
-  for (int i = 0; i < (int)omega_positive_.size(); i++) {
-    for (int j = 0; j < (int)gamma_positive_.size(); j++) {
-      matrix[i * size + (int)omega_positive_.size() + j] = WG[i]->values()[gamma_positive_[j]];
+  for (int i = 0; i < size_omega; i++) {
+    for (int j = 0; j < size_gamma_positive; j++) {
+      factor_[i * system_solution_length_ + size_omega + j] = gramProduct(omega_positive_[i]).values()[gamma_positive_[j]];
     }
   } // end for
 
   // Compute (1,3)-block
-  for (int i = 0; i < (int)omega_positive_.size(); i++) {
+  for (int i = 0; i < size_omega; i++) {
     for (int j = 0; j < (int)gamma_negative_.size(); j++) {
-      matrix[i * size + (int)omega_positive_.size() + (int)gamma_positive_.size() + j] = WG[i]->values()[gamma_negative_[j]];
+      factor_[i * system_solution_length_ + size_omega + size_gamma_positive + j] = gramProduct(omega_positive_[i]).values()[gamma_negative_[j]];
     }
   } // end for
 
   // Compute (2,2)-block (upper triangle)
-  for (int i = 0; i < (int)gamma_positive_.size(); i++) {
-    for (int j = i; j < (int)gamma_positive_.size(); j++) {
-      matrix[((int)omega_positive_.size() + i) * size + ((int)omega_positive_.size() + j)] = matrix_->elementOfInverse(gamma_positive_[i], gamma_positive_[j]);
+  for (int i = 0; i < size_gamma_positive; i++) {
+    for (int j = i; j < size_gamma_positive; j++) {
+      factor_[(size_omega + i) * system_solution_length_ + (size_omega + j)] = matrix_->elementOfInverse(gamma_positive_[i], gamma_positive_[j]);
     }
   } // end for
 
-  // Compute (2,3)-block (upper triangle)
-  for (int i = 0; i < (int)gamma_positive_.size(); i++) {
+  // Compute (2,3)-block
+  for (int i = 0; i < size_gamma_positive; i++) {
     for (int j = 0; j < (int)gamma_negative_.size(); j++) {
-      matrix[((int)omega_positive_.size() + i) * size + ((int)omega_positive_.size() + (int)gamma_positive_.size() + j)] = matrix_->elementOfInverse(gamma_positive_[i], gamma_negative_[j]);
+      factor_[(size_omega + i) * system_solution_length_ + (size_omega + size_gamma_positive + j)] = matrix_->elementOfInverse(gamma_positive_[i], gamma_negative_[j]);
     }
   } // end for
 
   // Compute (3,3)-block (upper triangle)
   for (int i = 0; i < (int)gamma_negative_.size(); i++) {
     for (int j = i; j < (int)gamma_negative_.size(); j++) {
-      matrix[((int)omega_positive_.size() + (int)gamma_positive_.size() + i) * size + ((int)omega_positive_.size() + (int)gamma_positive_.size() + j)] = matrix_->elementOfInverse(gamma_negative_[i], gamma_negative_[j]);
+      factor_[(size_omega + size_gamma_positive + i) * system_solution_length_ + (size_omega + size_gamma_positive + j)] = matrix_->elementOfInverse(gamma_negative_[i], gamma_negative_[j]);
     }
   } // end for
 
@@ -1883,26 +1879,23 @@ void QPSolverDualActiveSet::choleskyFromScratch(const Reporter* reporter)
   char upper_lower = 'L'; // Use "lower" since Fortran uses column-major ordering
   int flag = 0;
 
-  // Compute factorization
-  dpotf2_(&upper_lower, &size, matrix, &size, &flag);
+  // Compute factorization (blocked, in place)
+  dpotrf_(&upper_lower, &size, factor_, &system_solution_length_, &flag);
+  if (flag != 0) {
+    success_without_factorization_error = false;
+  }
 
   // Check tolerance on diagonal
   for (int i = 0; i < size; i++) {
-    if (matrix[i * size + i] < cholesky_tolerance_) {
-      reporter->printf(R_QP, R_PER_INNER_ITERATION, "ARGH! Replacing Cholesky diagonal of %+23.16e with %+23.16e.\n", matrix[i * size + i], cholesky_tolerance_);
-      matrix[i * size + i] = cholesky_tolerance_;
+    if (factor_[i * system_solution_length_ + i] < cholesky_tolerance_) {
+      success_without_factorization_error = false;
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "ARGH! Replacing Cholesky diagonal of %+23.16e with %+23.16e.\n", factor_[i * system_solution_length_ + i], cholesky_tolerance_);
+      factor_[i * system_solution_length_ + i] = cholesky_tolerance_;
     } // end if
   }   // end for
 
-  // Reset factorization
-  for (int i = 0; i < size; i++) {
-    for (int j = 0; j < size; j++) {
-      factor_[i * system_solution_length_ + j] = matrix[i * size + j];
-    }
-  } // end for
-
-  // Set right-hand side 1
-  double* right_hand_side = new double[size];
+  // Set right-hand side 1 (from workspace)
+  double* right_hand_side = workspace_.reserve(WA_TEMPORARY_VECTOR, size);
   for (int i = 0; i < size; i++) {
     right_hand_side[i] = 0.0;
   }
@@ -1927,15 +1920,8 @@ void QPSolverDualActiveSet::choleskyFromScratch(const Reporter* reporter)
   // Re-solve system 2
   solveSystemTranspose(right_hand_side, inner_solution_2_);
 
-  // Delete temporary matrices
-  if (matrix != nullptr) {
-    delete[] matrix;
-    matrix = nullptr;
-  } // end if
-  if (right_hand_side != nullptr) {
-    delete[] right_hand_side;
-    right_hand_side = nullptr;
-  } // end if
+  // Return
+  return success_without_factorization_error;
 
 } // end choleskyFromScratch
 
@@ -1976,9 +1962,57 @@ void QPSolverDualActiveSet::evaluatePrimalVectors()
 
 } // end evaluatePrimalVectors
 
-// Evaluate primal multiplier
-void QPSolverDualActiveSet::evaluatePrimalMultiplier(double solution1[],
-                                                     double solution2[])
+// Evaluate bundle products
+void QPSolverDualActiveSet::evaluateBundleProducts(const Vector& vector)
+{
+
+  // Set size
+  int size = (int)vector_list_.size();
+
+  // Determine first column for which product is needed (products for earlier columns are reused if vector is unchanged)
+  int start = 0;
+  if ((int)bundle_products_vector_.size() == gamma_length_ &&
+      memcmp(bundle_products_vector_.data(), vector.values(), gamma_length_ * sizeof(double)) == 0) {
+    start = std::min(bundle_products_count_, size);
+  }
+  else {
+    bundle_products_vector_.assign(vector.values(), vector.values() + gamma_length_);
+  }
+
+  // Resize products
+  bundle_products_.resize(size);
+
+  // Check for sparse bundle
+  if (bundle_sparse_count_ == size) {
+
+    // Compute products using nonzero indices
+    for (int i = start; i < size; i++) {
+      bundle_products_[i] = vector_list_[i]->innerProduct(vector);
+    }
+
+  } // end if
+  else if (start < size) {
+
+    // Set inputs for BLASLAPACK
+    char transpose = 'T';
+    int count = size - start;
+    double one = 1.0;
+    double zero = 0.0;
+    int increment = 1;
+
+    // Compute products with one matrix-vector product
+    dgemv_(&transpose, &gamma_length_, &count, &one, &bundle_[(size_t)start * gamma_length_], &gamma_length_, vector.values(), &increment, &zero, &bundle_products_[start], &increment);
+
+  } // end else if
+
+  // Set number of products computed
+  bundle_products_count_ = size;
+
+} // end evaluateBundleProducts
+
+// Evaluate primal multiplier
+void QPSolverDualActiveSet::evaluatePrimalMultiplier(double solution1[],
+                                                     double solution2[])
 {
 
   // Set inputs for BLASLAPACK
@@ -2012,41 +2046,34 @@ void QPSolverDualActiveSet::evaluateSystemVector(int set,
   // Check set
   if (set == 1) {
 
-    // Declare temporary vector
-    Vector temporary_vector(gamma_length_);
-
-    // Evaluate temporary vector
-    matrix_->matrixVectorProductOfInverse(*vector_list_[index], temporary_vector);
-
-    // Set "omega" values, i.e.,
+    // Set "omega" values, i.e., ith value = G(:,omega_positive_[i])'*W*G(:,index) + 1
     for (int i = 0; i < (int)omega_positive_.size(); i++) {
-      system_vector[i] = system_vector[i] + ddot_(&gamma_length_, vector_list_[omega_positive_[i]]->values(), &increment1, temporary_vector.values(), &increment1) + 1.0;
+      system_vector[i] = system_vector[i] + gramElement(omega_positive_[i], index) + 1.0;
     }
 
-    // Set "gamma positive" values, i.e.,
+    // Set "gamma positive" values, i.e., ith value = (W*G(:,index))(gamma_positive_[i])
     for (int i = 0; i < (int)gamma_positive_.size(); i++) {
-      Vector col(gamma_length_, 0.0);
-      matrix_->columnOfInverse(gamma_positive_[i], col);
-      system_vector[(int)omega_positive_.size() + i] = vector_list_[index]->innerProduct(col);
-    } // end for
+      system_vector[(int)omega_positive_.size() + i] = gramProduct(index).values()[gamma_positive_[i]];
+    }
 
-    // Set "gamma negative" values, i.e.,
+    // Set "gamma negative" values, i.e., ith value = (W*G(:,index))(gamma_negative_[i])
     for (int i = 0; i < (int)gamma_negative_.size(); i++) {
-      Vector col(gamma_length_, 0.0);
-      matrix_->columnOfInverse(gamma_negative_[i], col);
-      system_vector[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] = vector_list_[index]->innerProduct(col);
-    } // end for
+      system_vector[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] = gramProduct(index).values()[gamma_negative_[i]];
+    }
 
   } // end if
 
   else {
 
+    // Evaluate column of inverse
+    if ((int)omega_positive_.size() > 0) {
+      matrix_->columnOfInverse(index, column_);
+    }
+
     // Set "omega" values, i.e., ith value = G(:,omega_positive_[i])'*W(:,kkt_residual_minimum_index)
     for (int i = 0; i < (int)omega_positive_.size(); i++) {
-      Vector col(gamma_length_, 0.0);
-      matrix_->columnOfInverse(index, col);
-      system_vector[i] = vector_list_[omega_positive_[i]]->innerProduct(col);
-    } // end for
+      system_vector[i] = vector_list_[omega_positive_[i]]->innerProduct(column_);
+    }
 
     // Set "gamma positive" values, i.e., W(gamma_positive_[i],kkt_residual_minimum_index)
     for (int i = 0; i < (int)gamma_positive_.size(); i++) {
@@ -2097,138 +2124,265 @@ void QPSolverDualActiveSet::finalizeSolution()
 
 } // end finalizeSolution
 
-// Resize system solution
-void QPSolverDualActiveSet::resizeSystemSolution()
+// Gram cache element
+double QPSolverDualActiveSet::gramElement(int i,
+                                          int j)
 {
 
-  // Declare temp vectors
-  double* inner_solution_1_temp = new double[system_solution_length_];
-  double* inner_solution_2_temp = new double[system_solution_length_];
-  double* inner_solution_3_temp = new double[system_solution_length_];
-  double* inner_solution_ls_temp = new double[system_solution_length_];
-  double* inner_solution_trial_temp = new double[system_solution_length_];
-  double* new_system_vector_temp = new double[system_solution_length_];
-  double* right_hand_side_temp = new double[system_solution_length_];
-  double* system_solution_temp = new double[system_solution_length_];
-  double* system_solution_best_temp = new double[system_solution_length_];
+  // Compute element, if needed
+  int position = i * gram_capacity_ + j;
+  if (!gram_elements_computed_[position]) {
+    gram_elements_[position] = vector_list_[i]->innerProduct(gramProduct(j));
+    gram_elements_computed_[position] = true;
+  } // end if
 
-  // Set inputs for BLASLAPACK
-  int increment = 1;
+  // Return element
+  return gram_elements_[position];
 
-  // Initialize values
-  dcopy_(&system_solution_length_, inner_solution_1_, &increment, inner_solution_1_temp, &increment);
-  dcopy_(&system_solution_length_, inner_solution_2_, &increment, inner_solution_2_temp, &increment);
-  dcopy_(&system_solution_length_, inner_solution_3_, &increment, inner_solution_3_temp, &increment);
-  dcopy_(&system_solution_length_, inner_solution_ls_, &increment, inner_solution_ls_temp, &increment);
-  dcopy_(&system_solution_length_, inner_solution_trial_, &increment, inner_solution_trial_temp, &increment);
-  dcopy_(&system_solution_length_, new_system_vector_, &increment, new_system_vector_temp, &increment);
-  dcopy_(&system_solution_length_, right_hand_side_, &increment, right_hand_side_temp, &increment);
-  dcopy_(&system_solution_length_, system_solution_, &increment, system_solution_temp, &increment);
-  dcopy_(&system_solution_length_, system_solution_best_, &increment, system_solution_best_temp, &increment);
-
-  // Delete arrays (in case they exist)
-  if (inner_solution_1_ != nullptr) {
-    delete[] inner_solution_1_;
-    inner_solution_1_ = nullptr;
-  } // end if
-  if (inner_solution_2_ != nullptr) {
-    delete[] inner_solution_2_;
-    inner_solution_2_ = nullptr;
-  } // end if
-  if (inner_solution_3_ != nullptr) {
-    delete[] inner_solution_3_;
-    inner_solution_3_ = nullptr;
-  } // end if
-  if (inner_solution_ls_ != nullptr) {
-    delete[] inner_solution_ls_;
-    inner_solution_ls_ = nullptr;
-  } // end if
-  if (inner_solution_trial_ != nullptr) {
-    delete[] inner_solution_trial_;
-    inner_solution_trial_ = nullptr;
-  } // end if
-  if (new_system_vector_ != nullptr) {
-    delete[] new_system_vector_;
-    new_system_vector_ = nullptr;
-  } // end if
-  if (right_hand_side_ != nullptr) {
-    delete[] right_hand_side_;
-    right_hand_side_ = nullptr;
-  } // end if
-  if (system_solution_ != nullptr) {
-    delete[] system_solution_;
-    system_solution_ = nullptr;
-  } // end if
-  if (system_solution_best_ != nullptr) {
-    delete[] system_solution_best_;
-    system_solution_best_ = nullptr;
-  } // end if
+} // end gramElement
 
-  // Set new system solution length
-  int system_solution_length_new = 2 * system_solution_length_;
-
-  // Declare temp vectors
-  inner_solution_1_ = new double[system_solution_length_new];
-  inner_solution_2_ = new double[system_solution_length_new];
-  inner_solution_3_ = new double[system_solution_length_new];
-  inner_solution_ls_ = new double[system_solution_length_new];
-  inner_solution_trial_ = new double[system_solution_length_new];
-  new_system_vector_ = new double[system_solution_length_new];
-  right_hand_side_ = new double[system_solution_length_new];
-  system_solution_ = new double[system_solution_length_new];
-  system_solution_best_ = new double[system_solution_length_new];
+// Gram cache product
+const Vector& QPSolverDualActiveSet::gramProduct(int i)
+{
 
-  // Initialize values
-  dcopy_(&system_solution_length_, inner_solution_1_temp, &increment, inner_solution_1_, &increment);
-  dcopy_(&system_solution_length_, inner_solution_2_temp, &increment, inner_solution_2_, &increment);
-  dcopy_(&system_solution_length_, inner_solution_3_temp, &increment, inner_solution_3_, &increment);
-  dcopy_(&system_solution_length_, inner_solution_ls_temp, &increment, inner_solution_ls_, &increment);
-  dcopy_(&system_solution_length_, inner_solution_trial_temp, &increment, inner_solution_trial_, &increment);
-  dcopy_(&system_solution_length_, new_system_vector_temp, &increment, new_system_vector_, &increment);
-  dcopy_(&system_solution_length_, right_hand_side_temp, &increment, right_hand_side_, &increment);
-  dcopy_(&system_solution_length_, system_solution_temp, &increment, system_solution_, &increment);
-  dcopy_(&system_solution_length_, system_solution_best_temp, &increment, system_solution_best_, &increment);
-
-  // Delete arrays (in case they exist)
-  if (inner_solution_1_temp != nullptr) {
-    delete[] inner_solution_1_temp;
-    inner_solution_1_temp = nullptr;
-  } // end if
-  if (inner_solution_2_temp != nullptr) {
-    delete[] inner_solution_2_temp;
-    inner_solution_2_temp = nullptr;
-  } // end if
-  if (inner_solution_3_temp != nullptr) {
-    delete[] inner_solution_3_temp;
-    inner_solution_3_temp = nullptr;
-  } // end if
-  if (inner_solution_ls_temp != nullptr) {
-    delete[] inner_solution_ls_temp;
-    inner_solution_ls_temp = nullptr;
-  } // end if
-  if (inner_solution_trial_temp != nullptr) {
-    delete[] inner_solution_trial_temp;
-    inner_solution_trial_temp = nullptr;
+  // Compute product, if needed
+  if (gram_products_[i] == nullptr) {
+    gram_products_[i] = vector_list_[i]->makeNewOfSameLength();
+    matrix_->matrixVectorProductOfInverse(*vector_list_[i], *gram_products_[i]);
   } // end if
-  if (new_system_vector_temp != nullptr) {
-    delete[] new_system_vector_temp;
-    new_system_vector_temp = nullptr;
-  } // end if
-  if (right_hand_side_temp != nullptr) {
-    delete[] right_hand_side_temp;
-    right_hand_side_temp = nullptr;
-  } // end if
-  if (system_solution_temp != nullptr) {
-    delete[] system_solution_temp;
-    system_solution_temp = nullptr;
-  } // end if
-  if (system_solution_best_temp != nullptr) {
-    delete[] system_solution_best_temp;
-    system_solution_best_temp = nullptr;
+
+  // Return product
+  return *gram_products_[i];
+
+} // end gramProduct
+
+// Gram cache products
+void QPSolverDualActiveSet::gramProducts(const std::vector<int>& indices)
+{
+
+  // Determine indices of products not yet computed
+  std::vector<int> missing;
+  for (int i = 0; i < (int)indices.size(); i++) {
+    if (gram_products_[indices[i]] == nullptr) {
+      missing.push_back(indices[i]);
+    }
+  } // end for
+
+  // Check for at most one product missing, in which case compute by matrix-vector product
+  int count = (int)missing.size();
+  if (count <= 1) {
+    if (count == 1) {
+      gramProduct(missing[0]);
+    }
+    return;
   } // end if
 
-  // Update lengths
-  system_solution_length_ = system_solution_length_new;
+  // Loop over blocks of columns
+  for (int first = 0; first < count; first += column_block_length_) {
+
+    // Set block length
+    int length = std::min(column_block_length_, count - first);
+
+    // Allocate storage for products (released when last product in block is discarded)
+    std::shared_ptr<double> storage(new double[(size_t)length * gamma_length_], std::default_delete<double[]>());
+
+    // Compute W*G_S directly into storage
+    matrix_->matrixMatrixProductOfInverse(length, bundleColumns(missing, first, length), storage.get());
+
+    // Store products in Gram cache as views of storage
+    for (int i = 0; i < length; i++) {
+      gram_products_[missing[first + i]] = std::shared_ptr<Vector>(new Vector(&storage.get()[(size_t)i * gamma_length_], gamma_length_),
+                                                                   [storage](Vector* product) { delete product; });
+    }
+
+  } // end for
+
+} // end gramProducts
+
+// Bundle columns
+double* QPSolverDualActiveSet::bundleColumns(const std::vector<int>& indices,
+                                             int first,
+                                             int count)
+{
+
+  // Check for consecutive indices stored in bundle
+  bool consecutive = (indices[first] + count <= bundle_columns_);
+  for (int i = 1; consecutive && i < count; i++) {
+    consecutive = (indices[first + i] == indices[first] + i);
+  }
+  if (consecutive) {
+    return &bundle_[(size_t)indices[first] * gamma_length_];
+  }
+
+  // Gather columns (into workspace)
+  double* columns = workspace_.reserve(WA_TEMPORARY_BUNDLE, (size_t)count * gamma_length_);
+  for (int i = 0; i < count; i++) {
+    memcpy(&columns[(size_t)i * gamma_length_], bundleColumn(indices[first + i]), gamma_length_ * sizeof(double));
+  }
+
+  // Return gathered columns
+  return columns;
+
+} // end bundleColumns
+
+// Minimum-norm-point augmentation
+bool QPSolverDualActiveSet::minNormPointAugment(int index)
+{
+
+  // Set current length
+  int length = (int)omega_positive_.size();
+
+  // Reserve arrays (values are preserved)
+  min_norm_point_factor_ = workspace_.reserve(WA_MIN_NORM_POINT_FACTOR, (length + 1) * (length + 2) / 2);
+  min_norm_point_solution_1_ = workspace_.reserve(WA_MIN_NORM_POINT_SOLUTION_1, length + 1);
+  min_norm_point_solution_2_ = workspace_.reserve(WA_MIN_NORM_POINT_SOLUTION_2, length + 1);
+  while (length + 1 > system_solution_length_) {
+    resizeSystemSolution();
+  }
+
+  // Set new column of factor, initially 1+g_j^T*W*g_index for j in positive set
+  double* column = &min_norm_point_factor_[length * (length + 1) / 2];
+  for (int j = 0; j < length; j++) {
+    column[j] = 1.0 + gramElement(omega_positive_[j], index);
+  }
+
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'U';
+  char transpose = 'T';
+  char diagonal = 'N';
+  int increment = 1;
+
+  // Solve R^T*column = (1+g_j^T*W*g_index)
+  if (length > 0) {
+    dtpsv_(&upper_lower, &transpose, &diagonal, &length, min_norm_point_factor_, column, &increment);
+  }
+
+  // Compute new diagonal for factor (squared)
+  double diagonal_squared_full = 1.0 + gramElement(index, index);
+  double diagonal_squared = diagonal_squared_full - ddot_(&length, column, &increment, column, &increment);
+
+  // Check for (numerical) affine dependence
+  if (diagonal_squared <= cholesky_tolerance_ * diagonal_squared_full) {
+    return false;
+  }
+
+  // Set new diagonal
+  column[length] = sqrt(diagonal_squared);
+
+  // Update solutions of R^T*u = 1 and R^T*w = b_S
+  min_norm_point_solution_1_[length] = (1.0 - ddot_(&length, column, &increment, min_norm_point_solution_1_, &increment)) / column[length];
+  min_norm_point_solution_2_[length] = (vector_[index] - ddot_(&length, column, &increment, min_norm_point_solution_2_, &increment)) / column[length];
+
+  // Add element to set
+  omega_positive_.push_back(index);
+
+  // Return
+  return true;
+
+} // end minNormPointAugment
+
+// Minimum-norm-point deletion
+void QPSolverDualActiveSet::minNormPointDelete(int position)
+{
+
+  // Set current length
+  int length = (int)omega_positive_.size();
+
+  // Declare column and rotations (from workspace)
+  double* column = workspace_.reserve(WA_MIN_NORM_POINT_COLUMN, length);
+  double* rotation = workspace_.reserve(WA_MIN_NORM_POINT_ROTATION, 2 * length);
+
+  // Loop over columns after deleted column, shifting each to the left and restoring triangular form
+  for (int j = position + 1; j < length; j++) {
+
+    // Copy column
+    for (int i = 0; i <= j; i++) {
+      column[i] = min_norm_point_factor_[j * (j + 1) / 2 + i];
+    }
+
+    // Apply previous rotations
+    for (int i = position; i < j - 1; i++) {
+      double y = rotation[2 * i] * column[i] + rotation[2 * i + 1] * column[i + 1];
+      double z = -rotation[2 * i + 1] * column[i] + rotation[2 * i] * column[i + 1];
+      column[i] = y;
+      column[i + 1] = z;
+    } // end for
+
+    // Compute and apply new rotation to zero-out subdiagonal element
+    double norm = sqrt(column[j - 1] * column[j - 1] + column[j] * column[j]);
+    rotation[2 * (j - 1)] = column[j - 1] / norm;
+    rotation[2 * (j - 1) + 1] = column[j] / norm;
+    column[j - 1] = norm;
+
+    // Set shifted column
+    for (int i = 0; i < j; i++) {
+      min_norm_point_factor_[(j - 1) * j / 2 + i] = column[i];
+    }
+
+  } // end for
+
+  // Apply rotations to solutions and shift
+  for (int i = position; i < length - 1; i++) {
+    double y = rotation[2 * i] * min_norm_point_solution_1_[i] + rotation[2 * i + 1] * min_norm_point_solution_1_[i + 1];
+    double z = -rotation[2 * i + 1] * min_norm_point_solution_1_[i] + rotation[2 * i] * min_norm_point_solution_1_[i + 1];
+    min_norm_point_solution_1_[i] = y;
+    min_norm_point_solution_1_[i + 1] = z;
+    y = rotation[2 * i] * min_norm_point_solution_2_[i] + rotation[2 * i + 1] * min_norm_point_solution_2_[i + 1];
+    z = -rotation[2 * i + 1] * min_norm_point_solution_2_[i] + rotation[2 * i] * min_norm_point_solution_2_[i + 1];
+    min_norm_point_solution_2_[i] = y;
+    min_norm_point_solution_2_[i + 1] = z;
+  } // end for
+
+  // Remove solution element
+  for (int i = position; i < length - 1; i++) {
+    system_solution_[i] = system_solution_[i + 1];
+  }
+
+  // Remove element from set
+  omega_positive_.erase(omega_positive_.begin() + position);
+
+} // end minNormPointDelete
+
+// Minimum-norm-point affine minimizer
+void QPSolverDualActiveSet::minNormPointAffineMinimizer(double affine[])
+{
+
+  // Set inputs for BLASLAPACK
+  int length = (int)omega_positive_.size();
+  char upper_lower = 'U';
+  char transpose = 'N';
+  char diagonal = 'N';
+  int increment = 1;
+
+  // Evaluate scalar such that sum of affine minimizer is one
+  double scalar = (1.0 - ddot_(&length, min_norm_point_solution_1_, &increment, min_norm_point_solution_2_, &increment)) / ddot_(&length, min_norm_point_solution_1_, &increment, min_norm_point_solution_1_, &increment);
+
+  // Set right-hand side w+scalar*u
+  dcopy_(&length, min_norm_point_solution_2_, &increment, affine, &increment);
+  daxpy_(&length, &scalar, min_norm_point_solution_1_, &increment, affine, &increment);
+
+  // Solve R*affine = w+scalar*u
+  dtpsv_(&upper_lower, &transpose, &diagonal, &length, min_norm_point_factor_, affine, &increment);
+
+} // end minNormPointAffineMinimizer
+
+// Resize system solution
+void QPSolverDualActiveSet::resizeSystemSolution()
+{
+
+  // Set new system solution length
+  system_solution_length_ = 2 * system_solution_length_;
+
+  // Reserve arrays (values are preserved)
+  inner_solution_1_ = workspace_.reserve(WA_INNER_SOLUTION_1, system_solution_length_);
+  inner_solution_2_ = workspace_.reserve(WA_INNER_SOLUTION_2, system_solution_length_);
+  inner_solution_3_ = workspace_.reserve(WA_INNER_SOLUTION_3, system_solution_length_);
+  inner_solution_ls_ = workspace_.reserve(WA_INNER_SOLUTION_LS, system_solution_length_);
+  inner_solution_trial_ = workspace_.reserve(WA_INNER_SOLUTION_TRIAL, system_solution_length_);
+  new_system_vector_ = workspace_.reserve(WA_NEW_SYSTEM_VECTOR, system_solution_length_);
+  right_hand_side_ = workspace_.reserve(WA_RIGHT_HAND_SIDE, system_solution_length_);
+  system_solution_ = workspace_.reserve(WA_SYSTEM_SOLUTION, system_solution_length_);
+  system_solution_best_ = workspace_.reserve(WA_SYSTEM_SOLUTION_BEST, system_solution_length_);
 
 } // end resizeSystemSolution
 
@@ -2314,6 +2468,102 @@ bool QPSolverDualActiveSet::setAugment(const Reporter* reporter,
 
 } // end setAugment
 
+// Set augment (block of omega indices)
+bool QPSolverDualActiveSet::setAugmentBlock(const Reporter* reporter,
+                                            const std::vector<int>& indices)
+{
+
+  // Set sizes (gamma sets are empty)
+  int size = (int)omega_positive_.size();
+  int block = (int)indices.size();
+  int length = size + block;
+
+  // Check for sufficient length of solution arrays
+  if (length > system_solution_length_) {
+    return false;
+  }
+
+  // Print message
+  reporter->printf(R_QP, R_PER_INNER_ITERATION, "Augmenting set 1 with block of %d\n", block);
+
+  // Resize factor_?
+  if ((length - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
+    while ((length - 1) * (system_solution_length_ + 1) >= factor_length_ + 1) {
+      factor_length_ = 2 * factor_length_;
+    }
+    factor_ = workspace_.reserve(WA_FACTOR, factor_length_);
+  } // end if
+
+  // Set new columns (rows of positive set) as 1*1^T + G_S^T*W*G_B
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < block; j++) {
+      factor_[i * system_solution_length_ + size + j] = 1.0 + gramElement(omega_positive_[i], indices[j]);
+    }
+  } // end for
+
+  // Set new rows (upper triangle) as 1*1^T + G_B^T*W*G_B, initializing values left of diagonal
+  double* diagonal_squared = workspace_.reserve(WA_TEMPORARY_VECTOR, block);
+  for (int i = 0; i < block; i++) {
+    memset(&factor_[(size + i) * system_solution_length_], 0, (size + i) * sizeof(double));
+    for (int j = i; j < block; j++) {
+      factor_[(size + i) * system_solution_length_ + size + j] = 1.0 + gramElement(indices[i], indices[j]);
+    }
+    diagonal_squared[i] = factor_[(size + i) * system_solution_length_ + size + i];
+  } // end for
+
+  // Set inputs for BLASLAPACK
+  char side = 'R';
+  char upper_lower = 'L'; // Use "lower" since Fortran uses column-major ordering
+  char transpose = 'T';
+  char no_transpose = 'N';
+  char diagonal = 'N';
+  double one = 1.0;
+  double minus_one = -1.0;
+  int increment = 1;
+  int flag = 0;
+
+  // Compute new columns and downdate new rows, i.e., solve R_S^T*R_SB = 1*1^T + G_S^T*W*G_B and set 1*1^T + G_B^T*W*G_B - R_SB^T*R_SB
+  if (size > 0) {
+    dtrsm_(&side, &upper_lower, &transpose, &diagonal, &block, &size, &one, factor_, &system_solution_length_, &factor_[size], &system_solution_length_);
+    dsyrk_(&upper_lower, &no_transpose, &block, &size, &minus_one, &factor_[size], &system_solution_length_, &one, &factor_[size * system_solution_length_ + size], &system_solution_length_);
+  } // end if
+
+  // Compute factor of new rows (blocked, in place)
+  dpotrf_(&upper_lower, &block, &factor_[size * system_solution_length_ + size], &system_solution_length_, &flag);
+
+  // Check for factorization error or (near) linear dependence, in which case sets are unchanged
+  if (flag != 0) {
+    return false;
+  }
+  for (int i = 0; i < block; i++) {
+    if (pow(factor_[(size + i) * system_solution_length_ + size + i], 2) <= cholesky_tolerance_ * diagonal_squared[i]) {
+      return false;
+    }
+  } // end for
+
+  // Set new solution elements, i.e., solve R_B^T*u_B = 1 - R_SB^T*u_S and R_B^T*w_B = b_B - R_SB^T*w_S
+  for (int i = 0; i < block; i++) {
+    inner_solution_1_[size + i] = 1.0;
+    inner_solution_2_[size + i] = vector_[indices[i]];
+  }
+  if (size > 0) {
+    dgemv_(&no_transpose, &block, &size, &minus_one, &factor_[size], &system_solution_length_, inner_solution_1_, &increment, &one, &inner_solution_1_[size], &increment);
+    dgemv_(&no_transpose, &block, &size, &minus_one, &factor_[size], &system_solution_length_, inner_solution_2_, &increment, &one, &inner_solution_2_[size], &increment);
+  } // end if
+  dtrsv_(&upper_lower, &no_transpose, &diagonal, &block, &factor_[size * system_solution_length_ + size], &system_solution_length_, &inner_solution_1_[size], &increment);
+  dtrsv_(&upper_lower, &no_transpose, &diagonal, &block, &factor_[size * system_solution_length_ + size], &system_solution_length_, &inner_solution_2_[size], &increment);
+
+  // Add elements to set (with zero values)
+  for (int i = 0; i < block; i++) {
+    system_solution_[size + i] = 0.0;
+    omega_positive_.push_back(indices[i]);
+  } // end for
+
+  // Return
+  return true;
+
+} // end setAugmentBlock
+
 // Set delete
 void QPSolverDualActiveSet::setDelete(const Reporter* reporter,
                                       int set,
@@ -2370,6 +2620,435 @@ void QPSolverDualActiveSet::setDelete(const Reporter* reporter,
 
 } // end setDelete
 
+// Solve by minimum-norm-point method
+bool QPSolverDualActiveSet::solveQPMinNormPoint(const Reporter* reporter,
+                                                Quantities* quantities,
+                                                bool warm_start)
+{
+
+  // Initialize values
+  setStatus(QP_UNSET);
+  iteration_count_ = 0;
+  kkt_error_ = -NONOPT_DOUBLE_INFINITY;
+
+  // Set factor indicator (active-set factor is not maintained)
+  factor_outdated_ = true;
+
+  // try to solve QP, terminate on any exception
+  try {
+
+    // Update cached quantities (keeping those for vectors unchanged or moved since last solve)
+    updateCache();
+
+    // Check whether previous solution can be used, i.e., only omega values are positive
+    if (warm_start && (omega_positive_.size() == 0 || gamma_positive_.size() > 0 || gamma_negative_.size() > 0)) {
+      warm_start = false;
+    }
+
+    // Check for warm start
+    if (warm_start) {
+
+      // Store previous positive set and weights
+      std::deque<int> omega_positive_previous = omega_positive_;
+      std::vector<double> weights_previous(system_solution_, system_solution_ + omega_positive_previous.size());
+
+      // Re-build factor by augmentation, skipping vectors that are (numerically) affinely dependent
+      omega_positive_.clear();
+      double sum = 0.0;
+      for (int i = 0; i < (int)omega_positive_previous.size(); i++) {
+        if (omega_positive_previous[i] < (int)vector_list_.size() && minNormPointAugment(omega_positive_previous[i])) {
+          system_solution_[(int)omega_positive_.size() - 1] = weights_previous[i];
+          sum += weights_previous[i];
+        }
+      } // end for
+
+      // Normalize weights (or set uniform weights)
+      for (int i = 0; i < (int)omega_positive_.size(); i++) {
+        system_solution_[i] = (sum > 0.0) ? system_solution_[i] / sum : 1.0 / (double)omega_positive_.size();
+      }
+
+    } // end if
+
+    // Check for cold start (or failed warm start)
+    if (omega_positive_.size() == 0) {
+
+      // Clear sets
+      setNullSolution();
+
+      // Initialize minimum index and value
+      int index = -1;
+      double value = NONOPT_DOUBLE_INFINITY;
+
+      // Compute Gram cache products by a single matrix-matrix product
+      std::vector<int> all_indices((int)vector_list_.size());
+      for (int i = 0; i < (int)vector_list_.size(); i++) {
+        all_indices[i] = i;
+      }
+      gramProducts(all_indices);
+
+      // Loop through vector list
+      for (int i = 0; i < (int)vector_list_.size(); i++) {
+
+        // Compute objective value 0.5*g_i^T*W*g_i-b_i
+        double t = 0.5 * gramElement(i, i) - vector_[i];
+
+        // Check for minimum
+        if (i == 0 || t < value) {
+          index = i;
+          value = t;
+        }
+
+      } // end for
+
+      // Check for failed index choice
+      if (index == -1 || !minNormPointAugment(index)) {
+        THROW_EXCEPTION(QP_INPUT_ERROR_EXCEPTION, "QP solve unsuccessful. Input error.");
+      }
+
+      // Set weight
+      system_solution_[0] = 1.0;
+
+    } // end if
+
+    // Print message
+    reporter->printf(R_QP, R_PER_ITERATION, "\n");
+    reporter->printf(R_QP, R_PER_INNER_ITERATION, "Entering minimum-norm-point iteration loop\n");
+
+    // Set iteration limit
+    int iteration_limit = fmax(iteration_limit_minimum_, fmin(2 * ((int)vector_list_.size() + gamma_length_), iteration_limit_maximum_));
+
+    // Iteration loop
+    while (true) {
+
+      // Minor cycle loop, i.e., move toward affine minimizer over positive set, deleting elements whose weights reach zero
+      while (true) {
+
+        // Evaluate affine minimizer (from workspace)
+        double* affine = workspace_.reserve(WA_MIN_NORM_POINT_AFFINE, (int)omega_positive_.size());
+        minNormPointAffineMinimizer(affine);
+
+        // Determine largest step toward affine minimizer maintaining nonnegativity
+        int delete_position = -1;
+        double step = 1.0;
+        for (int i = 0; i < (int)omega_positive_.size(); i++) {
+          if (affine[i] <= 0.0) {
+            double temporary_scalar = (system_solution_[i] - affine[i] > 0.0) ? system_solution_[i] / (system_solution_[i] - affine[i]) : 0.0;
+            if (temporary_scalar < step) {
+              delete_position = i;
+              step = temporary_scalar;
+            } // end if
+          }   // end if
+        }     // end for
+
+        // Update weights
+        for (int i = 0; i < (int)omega_positive_.size(); i++) {
+          system_solution_[i] = (1.0 - step) * system_solution_[i] + step * affine[i];
+        }
+
+        // Check for affine minimizer in convex hull
+        if (delete_position == -1) {
+          break;
+        }
+
+        // Print message
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from omega's positive set\n", omega_positive_[delete_position]);
+
+        // Delete element
+        minNormPointDelete(delete_position);
+
+      } // end while (minor cycle loop)
+
+      // Print message
+      if (iteration_count_ % 20 == 0) {
+        reporter->printf(R_QP, R_PER_ITERATION, "===========================\n"
+                                                "  Iter.    |S|    min(KKT)\n"
+                                                "===========================\n");
+      }
+      reporter->printf(R_QP, R_PER_ITERATION, " %6d  %6d", iteration_count_, (int)omega_positive_.size());
+
+      // Update best solution
+      if (!updateBestSolution()) {
+        THROW_EXCEPTION(QP_NAN_ERROR_EXCEPTION, "QP solve unsuccessful.  NaN error.");
+      }
+
+      // Evaluate primal solution -W*G*omega from Gram cache
+      primal_solution_.scale(0.0);
+      for (int i = 0; i < (int)omega_positive_.size(); i++) {
+        primal_solution_.addScaledVector(-system_solution_[i], gramProduct(omega_positive_[i]));
+      }
+
+      // Evaluate bundle products G^Td
+      evaluateBundleProducts(primal_solution_);
+
+      // Evaluate multiplier, i.e., omega^T*(b-G^T*W*G*omega)
+      multiplier_ = 0.0;
+      for (int i = 0; i < (int)omega_positive_.size(); i++) {
+        multiplier_ += system_solution_[i] * (vector_[omega_positive_[i]] + bundle_products_[omega_positive_[i]]);
+      }
+
+      // Evaluate omega's KKT error components (from workspace), zero for positive set
+      double* kkt_residual_omega = workspace_.reserve(WA_KKT_RESIDUAL_OMEGA, (int)vector_.size());
+      for (int i = 0; i < (int)vector_.size(); i++) {
+        kkt_residual_omega[i] = multiplier_ - vector_[i] - bundle_products_[i];
+      }
+      for (int i = 0; i < (int)omega_positive_.size(); i++) {
+        kkt_residual_omega[omega_positive_[i]] = 0.0;
+      }
+
+      // Determine minimum element
+      int kkt_residual_minimum_index = (int)(std::min_element(kkt_residual_omega, kkt_residual_omega + (int)vector_.size()) - kkt_residual_omega);
+      kkt_error_ = kkt_residual_omega[kkt_residual_minimum_index];
+
+      // Print message
+      reporter->printf(R_QP, R_PER_ITERATION, "  %+.2e\n", kkt_error_);
+
+      // Increment iteration counter
+      iteration_count_++;
+
+      // Check for successful solve
+      if (kkt_error_ >= -kkt_tolerance_) {
+        THROW_EXCEPTION(QP_SUCCESS_EXCEPTION, "QP solve successful.");
+      }
+
+      // Check for iteration limit
+      if (iteration_count_ >= iteration_limit) {
+        THROW_EXCEPTION(QP_ITERATION_LIMIT_EXCEPTION, "QP solve unsuccessful. Iteration limit reached.");
+      }
+
+      // Check for CPU time limit
+      if ((clock() - quantities->startTime()) / (double)CLOCKS_PER_SEC >= quantities->cpuTimeLimit()) {
+        THROW_EXCEPTION(QP_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+      }
+
+      // Check for wall time limit
+      if (quantities->currentWallTime() - quantities->startWallTime() >= quantities->wallTimeLimit()) {
+        THROW_EXCEPTION(QP_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+      }
+
+      // Print message
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be added to omega's positive set\n", kkt_residual_minimum_index);
+
+      // Augment positive set
+      if (!minNormPointAugment(kkt_residual_minimum_index)) {
+
+        // Check for failure on factorization error
+        if (fail_on_factorization_error_) {
+          THROW_EXCEPTION(QP_FACTORIZATION_ERROR_EXCEPTION, "QP solve unsuccessful. Factorization error.");
+        }
+
+        // Print message
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d is affinely dependent; falling back to active-set method!\n", kkt_residual_minimum_index);
+
+        // Fall back to active-set method (solve is re-done from scratch by caller)
+        setNullSolution();
+        return false;
+
+      } // end if
+
+      // Set weight of new element
+      system_solution_[(int)omega_positive_.size() - 1] = 0.0;
+
+    } // end of main iteration loop
+
+  } // end try
+
+  // catch exceptions
+  catch (QP_SUCCESS_EXCEPTION& exec) {
+    setStatus(QP_SUCCESS);
+  } catch (QP_CPU_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_CPU_TIME_LIMIT);
+    THROW_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+  } catch (QP_WALL_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_WALL_TIME_LIMIT);
+    THROW_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+  } catch (QP_FACTORIZATION_ERROR_EXCEPTION& exec) {
+    setStatus(QP_FACTORIZATION_ERROR);
+  } catch (QP_INPUT_ERROR_EXCEPTION& exec) {
+    setStatus(QP_INPUT_ERROR);
+  } catch (QP_ITERATION_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_ITERATION_LIMIT);
+  } catch (QP_NAN_ERROR_EXCEPTION& exec) {
+    setStatus(QP_NAN_ERROR);
+  }
+
+  // Print new line
+  reporter->printf(R_QP, R_PER_ITERATION, "\n");
+
+  // Evaluate primal vectors for best solution
+  evaluatePrimalVectors();
+
+  // Finalize solution
+  finalizeSolution();
+
+  // Return
+  return true;
+
+} // end solveQPMinNormPoint
+
+// Solve subproblem
+void QPSolverDualActiveSet::solveSubproblem(const Reporter* reporter)
+{
+
+  // Set inner iteration limit
+  int inner_iteration_limit = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
+
+  // Subproblem solution loop
+  for (int inner_iteration_count = 0; inner_iteration_count < inner_iteration_limit; inner_iteration_count++) {
+
+    // Print message
+    reporter->printf(R_QP, R_PER_INNER_ITERATION, "Solving subproblem\n");
+
+    // Set inputs for BLASLAPACK
+    int length = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
+    int increment = 1;
+    double value = 1.0 - multiplier_;
+
+    // Set right-hand side vector
+    dcopy_(&length, inner_solution_2_, &increment, right_hand_side_, &increment);
+    daxpy_(&length, &value, inner_solution_1_, &increment, right_hand_side_, &increment);
+
+    // Solve subproblem
+    solveSystem(right_hand_side_, inner_solution_trial_);
+
+    // Declare boolean for correct signs
+    bool correct_signs = true;
+
+    // Check signs of subproblem solution elements
+    if (correct_signs) {
+      for (int i = 0; i < (int)omega_positive_.size() + (int)gamma_positive_.size(); i++) {
+        if (inner_solution_trial_[i] <= 0.0) {
+          correct_signs = false;
+          break;
+        } // end if
+      }   // end for
+    }     // end if
+    if (correct_signs) {
+      for (int i = 0; i < (int)gamma_negative_.size(); i++) {
+        if (inner_solution_trial_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] >= 0.0) {
+          correct_signs = false;
+          break;
+        } // end if
+      }   // end for
+    }     // end if
+
+    // Check feasibility of subproblem solution
+    if (correct_signs) {
+
+      // Print message
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "Feasible subproblem solution! Breaking loop\n");
+
+      // Replace current solution
+      dcopy_(&length, inner_solution_trial_, &increment, system_solution_, &increment);
+
+      // Break subproblem solution loop
+      break;
+
+    } // end if
+    else {
+
+      // Print message
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "Infeasible subproblem solution! Looking for index to delete\n");
+
+      // Initialize minimum index and values
+      int delete_index = -1;
+      double delete_value = NONOPT_DOUBLE_INFINITY;
+      int delete_set = -1;
+
+      // Compute index with minimum value
+      for (int i = 0; i < (int)omega_positive_.size(); i++) {
+        if (inner_solution_trial_[i] < 0.0) {
+          double temporary_scalar = system_solution_[i] / (system_solution_[i] - inner_solution_trial_[i]);
+          if (temporary_scalar < delete_value) {
+            delete_index = i;
+            delete_value = temporary_scalar;
+            delete_set = 1;
+          } // end if
+        }   // end if
+      }     // end for
+      for (int i = 0; i < (int)gamma_positive_.size(); i++) {
+        if (inner_solution_trial_[(int)omega_positive_.size() + i] < 0.0) {
+          double temporary_scalar = system_solution_[(int)omega_positive_.size() + i] / (system_solution_[(int)omega_positive_.size() + i] - inner_solution_trial_[(int)omega_positive_.size() + i]);
+          if (temporary_scalar < delete_value) {
+            delete_index = i;
+            delete_value = temporary_scalar;
+            delete_set = 2;
+          } // end if
+        }   // end if
+      }     // end for
+      for (int i = 0; i < (int)gamma_negative_.size(); i++) {
+        if (inner_solution_trial_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] > 0.0) {
+          double temporary_scalar = system_solution_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] / (system_solution_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i] - inner_solution_trial_[(int)omega_positive_.size() + (int)gamma_positive_.size() + i]);
+          if (temporary_scalar < delete_value) {
+            delete_index = i;
+            delete_value = temporary_scalar;
+            delete_set = 3;
+          } // end if
+        }   // end if
+      }     // end for
+
+      // Print message
+      reporter->printf(R_QP, R_PER_ITERATION, "  %+d", -delete_set);
+      if (delete_set == 1) {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from omega's positive set\n", omega_positive_[delete_index]);
+      }
+      else if (delete_set == 2) {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from gamma's positive set\n", gamma_positive_[delete_index]);
+      }
+      else if (delete_set == 3) {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Index %d will be deleted from gamma's negative set\n", gamma_negative_[delete_index]);
+      }
+      else {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, "Uh oh!  Search for element to delete failed!\n");
+      }
+
+      // Check if search for element to delete was successful
+      if (delete_set > 0) {
+
+        // Update value
+        delete_value = fmin(1.0, delete_value);
+
+        // Set inputs for BLASLAPACK
+        int length = (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size();
+        double value = 1.0 - delete_value;
+        int increment = 1;
+
+        // Scale solution
+        dscal_(&length, &value, system_solution_, &increment);
+
+        // Update solution
+        daxpy_(&length, &delete_value, inner_solution_trial_, &increment, system_solution_, &increment);
+
+        // Perform set deletion
+        setDelete(reporter, delete_set, delete_index, inner_solution_1_, inner_solution_2_);
+
+        // Evaluate multiplier
+        evaluatePrimalMultiplier(inner_solution_1_, inner_solution_2_);
+
+      } // end if
+
+      // Print sets
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "omega_positive (%6d elements):", (int)omega_positive_.size());
+      for (int i = 0; i < (int)omega_positive_.size(); i++) {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, " %d", omega_positive_[i]);
+      }
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "\n");
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "gamma_positive (%6d elements):", (int)gamma_positive_.size());
+      for (int i = 0; i < (int)gamma_positive_.size(); i++) {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, " %d", gamma_positive_[i]);
+      }
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "\n");
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "gamma_negative (%6d elements):", (int)gamma_negative_.size());
+      for (int i = 0; i < (int)gamma_negative_.size(); i++) {
+        reporter->printf(R_QP, R_PER_INNER_ITERATION, " %d", gamma_negative_[i]);
+      }
+      reporter->printf(R_QP, R_PER_INNER_ITERATION, "\n");
+
+    } // end else (correct_signs)
+
+  } // end for (subproblem solution loop)
+
+} // end solveSubproblem
+
 // Solve linear system
 void QPSolverDualActiveSet::solveSystem(double right_hand_side[],
                                         double solution[])
@@ -2422,4 +3101,234 @@ void QPSolverDualActiveSet::solveSystemTranspose(double right_hand_side[],
 
 } // end solveSystemTranspose
 
+// Update cached quantities
+void QPSolverDualActiveSet::updateCache()
+{
+
+  // Determine number of leading vectors unchanged since last update
+  int unchanged = 0;
+  while (unchanged < (int)cache_vector_list_.size() &&
+         unchanged < (int)vector_list_.size() &&
+         cache_vector_list_[unchanged] == vector_list_[unchanged]) {
+    unchanged++;
+  }
+
+  // Count sparse vectors
+  int size = (int)vector_list_.size();
+  bundle_sparse_count_ = 0;
+  for (int i = 0; i < size; i++) {
+    if (vector_list_[i]->isSparse()) {
+      bundle_sparse_count_++;
+    }
+  } // end for
+
+  // Copy changed vectors into bundle, unless all are sparse
+  if (bundle_sparse_count_ < size) {
+    bundle_.resize((size_t)size * gamma_length_);
+    for (int i = std::min(unchanged, bundle_columns_); i < size; i++) {
+      memcpy(&bundle_[(size_t)i * gamma_length_], vector_list_[i]->values(), gamma_length_ * sizeof(double));
+    }
+    bundle_columns_ = size;
+  } // end if
+  else {
+    bundle_columns_ = std::min(unchanged, bundle_columns_);
+  }
+
+  // Discard bundle products for changed vectors
+  bundle_products_count_ = std::min(bundle_products_count_, unchanged);
+
+  // Determine number of leading Gram cache vectors unchanged (none if matrix changed)
+  int gram_unchanged = unchanged;
+  if (gram_matrix_ != matrix_ || gram_matrix_modification_counter_ != matrix_->modificationCounter()) {
+    gram_matrix_ = matrix_;
+    gram_matrix_modification_counter_ = matrix_->modificationCounter();
+    gram_unchanged = 0;
+  } // end if
+
+  // Determine previous positions of changed vectors that remain in list (only if matrix unchanged)
+  std::vector<int> previous_position;
+  if (gram_unchanged == unchanged && unchanged < size) {
+    std::unordered_map<const Vector*, int> position;
+    for (int i = unchanged; i < (int)cache_vector_list_.size(); i++) {
+      position[cache_vector_list_[i].get()] = i;
+    }
+    for (int i = unchanged; i < size; i++) {
+      std::unordered_map<const Vector*, int>::const_iterator it = position.find(vector_list_[i].get());
+      if (it != position.end()) {
+        if (previous_position.size() == 0) {
+          previous_position.resize(size, -1);
+          for (int j = 0; j < unchanged; j++) {
+            previous_position[j] = j;
+          }
+        } // end if
+        previous_position[i] = it->second;
+      } // end if
+    }   // end for
+  }     // end if
+
+  // Check for moved vectors, in which case move their Gram cache quantities
+  if (previous_position.size() > 0) {
+
+    // Set new elements, keeping those for which both vectors remain in list
+    int capacity = (size > gram_capacity_) ? std::max(size, std::max(8, 2 * gram_capacity_)) : gram_capacity_;
+    std::vector<double> elements((size_t)capacity * capacity, 0.0);
+    std::vector<bool> elements_computed((size_t)capacity * capacity, false);
+    for (int i = 0; i < size; i++) {
+      if (previous_position[i] >= 0) {
+        for (int j = 0; j < size; j++) {
+          if (previous_position[j] >= 0) {
+            elements[i * capacity + j] = gram_elements_[previous_position[i] * gram_capacity_ + previous_position[j]];
+            elements_computed[i * capacity + j] = gram_elements_computed_[previous_position[i] * gram_capacity_ + previous_position[j]];
+          }
+        } // end for
+      }   // end if
+    }     // end for
+    gram_elements_.swap(elements);
+    gram_elements_computed_.swap(elements_computed);
+    gram_capacity_ = capacity;
+
+    // Set new products, keeping those for vectors that remain in list
+    std::vector<std::shared_ptr<Vector>> products(size);
+    for (int i = 0; i < size; i++) {
+      if (previous_position[i] >= 0) {
+        products[i] = gram_products_[previous_position[i]];
+      }
+    }
+    gram_products_.swap(products);
+
+  } // end if
+  else {
+
+    // Increase Gram cache capacity (geometrically) if needed, keeping elements for unchanged vectors
+    if (size > gram_capacity_) {
+      int capacity = std::max(size, std::max(8, 2 * gram_capacity_));
+      std::vector<double> elements((size_t)capacity * capacity, 0.0);
+      std::vector<bool> elements_computed((size_t)capacity * capacity, false);
+      for (int i = 0; i < gram_unchanged; i++) {
+        for (int j = 0; j < gram_unchanged; j++) {
+          elements[i * capacity + j] = gram_elements_[i * gram_capacity_ + j];
+          elements_computed[i * capacity + j] = gram_elements_computed_[i * gram_capacity_ + j];
+        }
+      } // end for
+      gram_elements_.swap(elements);
+      gram_elements_computed_.swap(elements_computed);
+      gram_capacity_ = capacity;
+    } // end if
+
+    // Discard Gram products and elements for changed vectors
+    gram_products_.resize(size);
+    for (int i = gram_unchanged; i < size; i++) {
+      gram_products_[i].reset();
+      for (int j = 0; j < gram_capacity_; j++) {
+        gram_elements_computed_[i * gram_capacity_ + j] = false;
+        gram_elements_computed_[j * gram_capacity_ + i] = false;
+      }
+    } // end for
+
+  } // end else
+
+  // Set vectors for which cached quantities hold
+  cache_vector_list_ = vector_list_;
+
+} // end updateCache
+
+// Record sets for warm start
+void QPSolverDualActiveSet::warmStartRecord()
+{
+
+  // Check for warm start and successful solve with more than one vector
+  if (!warm_start_ || status() != QP_SUCCESS || (int)vector_list_.size() <= 1) {
+    return;
+  }
+
+  // Record vectors in positive set
+  warm_start_vector_list_.clear();
+  for (int i = 0; i < (int)omega_positive_.size(); i++) {
+    warm_start_vector_list_.push_back(vector_list_[omega_positive_[i]]);
+  }
+
+  // Record gamma sets
+  warm_start_gamma_positive_ = gamma_positive_;
+  warm_start_gamma_negative_ = gamma_negative_;
+
+  // Record solution values
+  warm_start_solution_.assign(system_solution_, system_solution_ + (int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size());
+
+} // end warmStartRecord
+
+// Seed sets for warm start
+bool QPSolverDualActiveSet::warmStartSets(const Reporter* reporter)
+{
+
+  // Check for warm start and recorded sets
+  if (!warm_start_ || warm_start_vector_list_.size() == 0) {
+    return false;
+  }
+
+  // Map vectors to (first) positions in vector list
+  std::unordered_map<const Vector*, int> position;
+  for (int i = 0; i < (int)vector_list_.size(); i++) {
+    position.emplace(vector_list_[i].get(), i);
+  }
+
+  // Set positive set with recorded vectors remaining in vector list
+  double sum = 0.0;
+  for (int i = 0; i < (int)warm_start_vector_list_.size(); i++) {
+    auto entry = position.find(warm_start_vector_list_[i].get());
+    if (entry != position.end() && warm_start_solution_[i] > 0.0) {
+      system_solution_[(int)omega_positive_.size()] = warm_start_solution_[i];
+      omega_positive_.push_back(entry->second);
+      sum += warm_start_solution_[i];
+      position.erase(entry);
+    } // end if
+  }   // end for
+
+  // Check for empty positive set
+  if (omega_positive_.size() == 0) {
+    return false;
+  }
+
+  // Scale omega values to sum to one
+  for (int i = 0; i < (int)omega_positive_.size(); i++) {
+    system_solution_[i] /= sum;
+  }
+
+  // Set gamma sets with values of correct sign
+  int offset = (int)warm_start_vector_list_.size();
+  for (int i = 0; i < (int)warm_start_gamma_positive_.size(); i++) {
+    if (warm_start_solution_[offset + i] > 0.0) {
+      system_solution_[(int)omega_positive_.size() + (int)gamma_positive_.size()] = warm_start_solution_[offset + i];
+      gamma_positive_.push_back(warm_start_gamma_positive_[i]);
+    } // end if
+  }   // end for
+  offset += (int)warm_start_gamma_positive_.size();
+  for (int i = 0; i < (int)warm_start_gamma_negative_.size(); i++) {
+    if (warm_start_solution_[offset + i] < 0.0) {
+      system_solution_[(int)omega_positive_.size() + (int)gamma_positive_.size() + (int)gamma_negative_.size()] = warm_start_solution_[offset + i];
+      gamma_negative_.push_back(warm_start_gamma_negative_[i]);
+    } // end if
+  }   // end for
+
+  // Print message
+  reporter->printf(R_QP, R_PER_INNER_ITERATION, "Warm starting with %d of %d recorded vectors\n", (int)omega_positive_.size(), (int)warm_start_vector_list_.size());
+
+  // Compute factor from scratch, reverting to cold start on factorization error
+  if (!choleskyFromScratch(reporter)) {
+    omega_positive_.clear();
+    gamma_positive_.clear();
+    gamma_negative_.clear();
+    return false;
+  } // end if
+
+  // Compute multiplier
+  evaluatePrimalMultiplier(inner_solution_1_, inner_solution_2_);
+
+  // Solve subproblem (deleting elements from sets as needed)
+  solveSubproblem(reporter);
+
+  // Return
+  return true;
+
+} // end warmStartSets
+
 } // namespace NonOpt
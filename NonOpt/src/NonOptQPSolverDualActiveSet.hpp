@@ -10,12 +10,23 @@
 #include <deque>
 
 #include "NonOptQPSolver.hpp"
+#include "NonOptWorkspace.hpp"
 
 namespace NonOpt
 {
 
 /**
  * QPSolverDualActiveSet class
+ * (The Cholesky factor of the system matrix is updated by BLAS kernels when sets change
+ *  and is computed from scratch, in place, by blocked LAPACK factorization.  When "r" is
+ *  infinite, the gamma sets are vacuous and the QP is a minimum W-norm point problem over
+ *  the convex hull of "G"; if the corresponding option is set, it is then solved by a
+ *  Wolfe-type minimum-norm-point method with its own incremental Cholesky factorization,
+ *  which uses only the Gram cache.  If warm starting is enabled, the sets and dual values
+ *  of the last successful solve are recorded with the vectors (by identity) in the positive
+ *  set, and a solve from scratch seeds its sets from those vectors still in "G".  If the
+ *  block size exceeds one and the gamma sets are empty, several violated omega constraints
+ *  may be added in an iteration by a rank-k update of the factor.)
  */
 class QPSolverDualActiveSet : public QPSolver
 {
@@ -156,6 +167,11 @@ public:
    * Vector list length
    */
   inline int const vectorListLength() const { return (int)vector_list_.size(); };
+  /**
+   * Workspace bytes allocated
+   * \return number of bytes allocated (including reallocations) for workspace arrays
+   */
+  inline size_t const workspaceBytesAllocated() const { return workspace_.bytesAllocated(); };
   //@}
 
   /** @name Set methods */
@@ -254,11 +270,46 @@ private:
   void operator=(const QPSolverDualActiveSet&);
   //@}
 
+  /** @name Private enumerations */
+  //@{
+  /**
+   * Workspace array indices
+   */
+  enum WorkspaceArray {
+    WA_FACTOR = 0,
+    WA_INNER_SOLUTION_1,
+    WA_INNER_SOLUTION_2,
+    WA_INNER_SOLUTION_3,
+    WA_INNER_SOLUTION_LS,
+    WA_INNER_SOLUTION_TRIAL,
+    WA_NEW_SYSTEM_VECTOR,
+    WA_RIGHT_HAND_SIDE,
+    WA_SYSTEM_SOLUTION,
+    WA_SYSTEM_SOLUTION_BEST,
+    WA_KKT_RESIDUAL_OMEGA,
+    WA_KKT_RESIDUAL_GAMMA_POSITIVE,
+    WA_KKT_RESIDUAL_GAMMA_NEGATIVE,
+    WA_TEMPORARY_BUNDLE,
+    WA_TEMPORARY_BUNDLE_PRODUCTS,
+    WA_TEMPORARY_MATRIX,
+    WA_TEMPORARY_VECTOR,
+    WA_MIN_NORM_POINT_FACTOR,
+    WA_MIN_NORM_POINT_SOLUTION_1,
+    WA_MIN_NORM_POINT_SOLUTION_2,
+    WA_MIN_NORM_POINT_AFFINE,
+    WA_MIN_NORM_POINT_COLUMN,
+    WA_MIN_NORM_POINT_ROTATION
+  };
+  //@}
+
   /** @name Private members */
   //@{
   /**
    * Length parameters
+   * (Matrix-matrix products over the bundle are computed in blocks of at most
+   *  column_block_length_ columns, which bounds temporary storage.)
    */
+  int column_block_length_;
   int factor_length_;
   int gamma_length_;
   int system_solution_length_;
@@ -267,6 +318,8 @@ private:
    */
   bool fail_on_factorization_error_;
   bool allow_inexact_termination_;
+  bool min_norm_point_;
+  bool warm_start_;
   double cholesky_tolerance_;
   double kkt_tolerance_;
   double inexact_solution_tolerance_;
@@ -274,6 +327,7 @@ private:
   double inexact_termination_initialization_factor_;
   double inexact_termination_ratio_minimum_;
   double linear_independence_tolerance_;
+  int block_size_;
   int inexact_termination_check_interval_;
   int iteration_limit_minimum_;
   int iteration_limit_maximum_;
@@ -298,7 +352,12 @@ private:
   double primal_solution_feasible_best_norm_inf_;
   /**
    * Algorithm quantities
+   * (Arrays are owned by workspace, which is retained across solves.  The upper triangular
+   *  factor is stored by rows with stride system_solution_length_, i.e., as the lower
+   *  triangle of a column-major array for BLAS/LAPACK.)
    */
+  Workspace workspace_;
+  Vector column_;
   double* factor_;
   std::deque<int> gamma_negative_;
   std::deque<int> gamma_negative_best_;
@@ -315,6 +374,29 @@ private:
   std::deque<int> omega_positive_best_;
   double* system_solution_;
   double* system_solution_best_;
+  /**
+   * Minimum-norm-point quantities
+   * (Factor "R" of 1*1^T + G_S^T*W*G_S over the positive set, stored upper packed, and
+   *  solutions of R^T*u = 1 and R^T*w = b_S.  The first indicator records that the last solve
+   *  used this method, in which case the active-set factor does not correspond to the sets;
+   *  the second is set only just before a nested solve call, to tell it that the method met an
+   *  affinely dependent vector and the solve falls back to the active-set method, and is
+   *  cleared on entry to that call, so that it never outlives a solve.)
+   */
+  bool factor_outdated_;
+  bool min_norm_point_fallback_;
+  double* min_norm_point_factor_;
+  double* min_norm_point_solution_1_;
+  double* min_norm_point_solution_2_;
+  /**
+   * Warm start quantities
+   * (Vectors in positive set, gamma sets, and solution values, in system solution order,
+   *  recorded at the end of the last successful solve with more than one vector.)
+   */
+  std::vector<std::shared_ptr<Vector>> warm_start_vector_list_;
+  std::deque<int> warm_start_gamma_positive_;
+  std::deque<int> warm_start_gamma_negative_;
+  std::vector<double> warm_start_solution_;
 
   /**
    * Solution quantities
@@ -329,6 +411,35 @@ private:
   Vector primal_solution_feasible_;
   Vector primal_solution_feasible_best_;
   Vector primal_solution_simple_;
+
+  /**
+   * Bundle quantities
+   * (Copy of "G" stored contiguously, column-major, for matrix-vector and matrix-matrix
+   *  products, and products G^T*d for KKT residuals, with the "d" for which the
+   *  products were computed.  If all vectors are sparse, the copy is not made, since
+   *  products loop over nonzero indices, and columns are read from the vectors.)
+   */
+  int bundle_columns_;
+  int bundle_products_count_;
+  int bundle_sparse_count_;
+  std::vector<double> bundle_;
+  std::vector<double> bundle_products_;
+  std::vector<double> bundle_products_vector_;
+  /**
+   * Gram cache quantities
+   * (Products W*g_i and elements g_i^T*W*g_j, computed on demand and kept across
+   *  solves until the matrix changes or the vector list changes at a position.)
+   */
+  int gram_capacity_;
+  int gram_matrix_modification_counter_;
+  std::shared_ptr<SymmetricMatrix> gram_matrix_;
+  std::vector<std::shared_ptr<Vector>> gram_products_;
+  std::vector<double> gram_elements_;
+  std::vector<bool> gram_elements_computed_;
+  /**
+   * Vector list for which cached quantities hold
+   */
+  std::vector<std::shared_ptr<Vector>> cache_vector_list_;
   //@}
 
   /** @name Private methods */
@@ -337,6 +448,48 @@ private:
    * Sanity check
    */
   bool checkQuantityCompatibility();
+  /**
+   * Bundle column
+   * \param[in] i is index of vector
+   * \return pointer to values of vector (in contiguous bundle, if stored)
+   */
+  inline const double* bundleColumn(int i) const { return (i < bundle_columns_) ? &bundle_[(size_t)i * gamma_length_] : vector_list_[i]->values(); };
+  /**
+   * Bundle columns
+   * \param[in] indices is vector of indices of vectors
+   * \param[in] first is position in indices of first column
+   * \param[in] count is number of columns
+   * \return pointer to columns, contiguous, column-major (in bundle, if indices are consecutive
+   *         and stored; otherwise gathered into workspace)
+   */
+  double* bundleColumns(const std::vector<int>& indices,
+                        int first,
+                        int count);
+  /**
+   * Gram cache element, i.e., g_i^T*W*g_j
+   * \param[in] i is index of first vector
+   * \param[in] j is index of second vector
+   * \return element
+   */
+  double gramElement(int i,
+                     int j);
+  /**
+   * Gram cache product, i.e., W*g_i
+   * \param[in] i is index of vector
+   * \return reference to product
+   */
+  const Vector& gramProduct(int i);
+  /**
+   * Gram cache products, i.e., W*g_i for all i in indices, computing those not yet
+   * computed by matrix-matrix products over blocks of columns
+   * \param[in] indices is vector of indices of vectors
+   */
+  void gramProducts(const std::vector<int>& indices);
+  /**
+   * Update cached quantities, i.e., bundle and Gram cache, discarding those for matrix or vectors that changed
+   * (Gram cache quantities for vectors that moved to new positions in the list are kept.)
+   */
+  void updateCache();
   /**
    * Dual objective quadratic value, scaled to correspond to feasible "d"
    */
@@ -362,7 +515,8 @@ private:
   void choleskyDelete(int index,
                       double solution1[],
                       double solution2[]);
-  void choleskyFromScratch(const Reporter* reporter);
+  bool choleskyFromScratch(const Reporter* reporter);
+  void evaluateBundleProducts(const Vector& vector);
   void evaluatePrimalVectors();
   void evaluatePrimalMultiplier(double solution1[],
                                 double solution2[]);
@@ -378,15 +532,29 @@ private:
                   double solution1[],
                   double solution2[],
                   double augmentation_value);
+  bool setAugmentBlock(const Reporter* reporter,
+                       const std::vector<int>& indices);
   void setDelete(const Reporter* reporter,
                  int set,
                  int index,
                  double solution1[],
                  double solution2[]);
+  void solveSubproblem(const Reporter* reporter);
   void solveSystem(double right_hand_side[],
                    double solution[]);
   void solveSystemTranspose(double right_hand_side[],
                             double solution[]);
+  void warmStartRecord();
+  bool warmStartSets(const Reporter* reporter);
+  /**
+   * Minimum-norm-point methods (for infinite "r"; solve returns false if it falls back to active-set method)
+   */
+  bool solveQPMinNormPoint(const Reporter* reporter,
+                           Quantities* quantities,
+                           bool warm_start);
+  bool minNormPointAugment(int index);
+  void minNormPointDelete(int position);
+  void minNormPointAffineMinimizer(double affine[]);
   //@}
 
 }; // end QPSolverDualActiveSet
@@ -0,0 +1,930 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+#include "NonOptBLASLAPACK.hpp"
+#include "NonOptDeclarations.hpp"
+#include "NonOptDefinitions.hpp"
+#include "NonOptQPSolverFISTA.hpp"
+
+namespace NonOpt
+{
+
+// Constructor
+QPSolverFISTA::QPSolverFISTA()
+  : gamma_length_(0),
+    inexact_solution_tolerance_(0.0),
+    scalar_(0.0),
+    iteration_count_(0),
+    kkt_error_(NONOPT_DOUBLE_INFINITY),
+    lipschitz_gamma_(0.0),
+    lipschitz_omega_(0.0),
+    bundle_products_(nullptr),
+    gradient_omega_(nullptr),
+    iterate_(std::make_shared<Iterate>()),
+    iterate_extrapolated_(std::make_shared<Iterate>()),
+    iterate_previous_(std::make_shared<Iterate>()),
+    iterate_trial_(std::make_shared<Iterate>()) {}
+
+// Destructor (arrays are owned by workspace)
+QPSolverFISTA::~QPSolverFISTA() {}
+
+// Add options
+void QPSolverFISTA::addOptions(Options* options)
+{
+
+  // Add bool options
+  options->addBoolOption("QPFISTA_allow_inexact_termination",
+                         false,
+                         "Indicator for whether to allow early termination.\n"
+                         "Default     : false.");
+  options->addBoolOption("QPFISTA_warm_start",
+                         true,
+                         "Indicator for whether to initialize each solve with the previous\n"
+                         "              solution for vectors that remain in the vector list.  If false,\n"
+                         "              then only hot solves (after data is added) are warm-started.\n"
+                         "Default     : true.");
+
+  // Add double options
+  options->addDoubleOption("QPFISTA_backtracking_factor",
+                           2.0,
+                           1.0,
+                           NONOPT_DOUBLE_INFINITY,
+                           "Factor by which the Lipschitz constant estimate is increased\n"
+                           "              when the sufficient decrease condition of a proximal step does\n"
+                           "              not hold.  The estimate is also decreased by this factor at\n"
+                           "              the start of each solve.\n"
+                           "Default     : 2.0.");
+  options->addDoubleOption("QPFISTA_inexact_termination_descent_tolerance",
+                           1e-04,
+                           0.0,
+                           1.0,
+                           "Descent direction tolerance for inexactness conditions.\n"
+                           "Default     : 1e-04.");
+  options->addDoubleOption("QPFISTA_kkt_tolerance",
+                           1e-06,
+                           0.0,
+                           NONOPT_DOUBLE_INFINITY,
+                           "Tolerance for determining optimality.  If the duality gap\n"
+                           "              between the projected primal solution and the dual solution,\n"
+                           "              relative to the primal objective (if larger than one), falls\n"
+                           "              below this tolerance, then the algorithm terminates with a\n"
+                           "              message of success.\n"
+                           "Default     : 1e-06.");
+
+  // Add integer options
+  options->addIntegerOption("QPFISTA_iteration_limit",
+                            1e+04,
+                            0,
+                            NONOPT_INT_INFINITY,
+                            "Limit on the number of iterations.\n"
+                            "Default     : 1e+04.");
+  options->addIntegerOption("QPFISTA_termination_check_interval",
+                            10,
+                            1,
+                            NONOPT_INT_INFINITY,
+                            "Number of iterations to perform between checks of termination\n"
+                            "              conditions.  Each check requires one product with the\n"
+                            "              vector list.\n"
+                            "Default     : 10.");
+
+} // end addOptions
+
+// Set options
+void QPSolverFISTA::setOptions(Options* options)
+{
+
+  // Read bool options
+  options->valueAsBool("QPFISTA_allow_inexact_termination", allow_inexact_termination_);
+  options->valueAsBool("QPFISTA_warm_start", warm_start_);
+
+  // Read double options
+  options->valueAsDouble("QPFISTA_backtracking_factor", backtracking_factor_);
+  options->valueAsDouble("QPFISTA_inexact_termination_descent_tolerance", inexact_termination_descent_tolerance_);
+  options->valueAsDouble("QPFISTA_kkt_tolerance", kkt_tolerance_);
+
+  // Read integer options
+  options->valueAsInteger("QPFISTA_iteration_limit", iteration_limit_);
+  options->valueAsInteger("QPFISTA_termination_check_interval", termination_check_interval_);
+
+} // end setOptions
+
+// Initialize
+void QPSolverFISTA::initialize(const Options* options,
+                               Quantities* quantities,
+                               const Reporter* reporter)
+{
+  initializeData(quantities->numberOfVariables());
+}
+
+// Initialize data
+void QPSolverFISTA::initializeData(int gamma_length)
+{
+
+  // Set length parameter
+  gamma_length_ = gamma_length;
+
+  // Initialize problem data
+  matrix_ = nullptr;
+  vector_list_.clear();
+  vector_.clear();
+  scalar_ = -1.0;
+
+  // Clear bundle and Lipschitz constant estimate
+  bundle_.clear();
+  bundle_vector_list_.clear();
+  lipschitz_gamma_ = 0.0;
+  lipschitz_omega_ = 0.0;
+
+  // Set status
+  setStatus(QP_UNSET);
+
+  // Set null solution
+  setNullSolution();
+
+} // end initializeData
+
+// Get translated combination 2-norm square
+double QPSolverFISTA::combinationTranslatedNorm2Squared()
+{
+
+  // Set inputs for BLASLAPACK
+  int length = gamma_length_;
+  int increment = 1;
+
+  // Set norm
+  double combination_translated_norm_2 = dnrm2_(&length, combination_translated_.values(), &increment);
+
+  // Set maximum
+  if (std::isnan(combination_translated_norm_2) || combination_translated_norm_2 > NONOPT_DOUBLE_INFINITY) {
+    combination_translated_norm_2 = NONOPT_DOUBLE_INFINITY;
+  }
+
+  // Return 2-norm square
+  return combination_translated_norm_2 * combination_translated_norm_2;
+
+} // end combinationTranslatedNorm2Squared
+
+// Get dual objective quadratic value
+double QPSolverFISTA::dualObjectiveQuadraticValue()
+{
+
+  // Set inputs for BLASLAPACK
+  int length = gamma_length_;
+  int increment = 1;
+
+  // Set quadratic value
+  double dual_objective_quadratic_value = -ddot_(&length, primal_solution_.values(), &increment, combination_translated_.values(), &increment);
+
+  // Set maximum
+  if (std::isnan(dual_objective_quadratic_value) || dual_objective_quadratic_value > NONOPT_DOUBLE_INFINITY) {
+    dual_objective_quadratic_value = NONOPT_DOUBLE_INFINITY;
+  }
+
+  // Return
+  return dual_objective_quadratic_value;
+
+} // end dualObjectiveQuadraticValue
+
+// Get dual solution
+void QPSolverFISTA::dualSolution(double omega[], double gamma[])
+{
+
+  // Set inputs for BLASLAPACK
+  int length = (int)vector_.size();
+  int increment = 1;
+
+  // Copy values
+  dcopy_(&length, omega_.values(), &increment, omega, &increment);
+
+  // Set inputs for BLASLAPACK
+  length = gamma_length_;
+
+  // Copy values
+  dcopy_(&length, gamma_.values(), &increment, gamma, &increment);
+
+} // end dualSolution
+
+// Get dual solution, omega part
+void QPSolverFISTA::dualSolutionOmega(double omega[])
+{
+
+  // Set inputs for BLASLAPACK
+  int length = (int)vector_.size();
+  int increment = 1;
+
+  // Copy values
+  dcopy_(&length, omega_.values(), &increment, omega, &increment);
+
+} // end dualSolutionOmega
+
+// Get KKT error from dual solution
+double QPSolverFISTA::KKTErrorDual()
+{
+
+  // Check for solution corresponding to data
+  if (matrix_ == nullptr || vector_.size() == 0 || omega_.length() != (int)vector_.size() || (int)bundle_.size() != (int)vector_.size() * gamma_length_) {
+    return NONOPT_DOUBLE_INFINITY;
+  }
+
+  // Declare dual vector, i.e., -W*(G*omega + gamma)
+  Vector d0(gamma_length_, 0.0);
+  d0.addScaledVector(-1.0, combination_translated_);
+  Vector d(gamma_length_);
+  matrix_->matrixVectorProductOfInverse(d0, d);
+
+  // Evaluate gradient inner products
+  evaluateBundleProducts(d);
+
+  // Evaluate dual scalar
+  double z = 0.0;
+  for (int i = 0; i < (int)vector_.size(); i++) {
+    z = z + omega_.values()[i] * (bundle_products_[i] + vector_[i]);
+  }
+
+  // Initialize KKT error
+  double kkt_error = 0.0;
+
+  // Loop through KKT conditions, update error
+  for (int j = 0; j < (int)vector_.size(); j++) {
+    kkt_error = fmax(kkt_error, -z + vector_[j] + bundle_products_[j]);
+    kkt_error = fmax(kkt_error, -omega_.values()[j]);
+  }
+  for (int i = 0; i < gamma_length_; i++) {
+    kkt_error = fmax(kkt_error, -scalar_ + d.values()[i]);
+    kkt_error = fmax(kkt_error, -scalar_ - d.values()[i]);
+  }
+  double sum = 0.0;
+  for (int j = 0; j < (int)vector_.size(); j++) {
+    sum = sum + omega_.values()[j];
+  }
+  kkt_error = fmax(kkt_error, fabs(sum - 1.0));
+  for (int i = 0; i < gamma_length_; i++) {
+    if (gamma_.values()[i] > 0.0) {
+      kkt_error = fmax(kkt_error, gamma_.values()[i] * (scalar_ - d.values()[i]));
+    }
+    else if (gamma_.values()[i] < 0.0) {
+      kkt_error = fmax(kkt_error, -gamma_.values()[i] * (scalar_ + d.values()[i]));
+    }
+  } // end for
+
+  // Set maximum
+  if (std::isnan(kkt_error) || kkt_error > NONOPT_DOUBLE_INFINITY) {
+    kkt_error = NONOPT_DOUBLE_INFINITY;
+  }
+
+  // Return
+  return kkt_error;
+
+} // end KKTErrorDual
+
+// Get primal solution
+void QPSolverFISTA::primalSolution(double d[])
+{
+
+  // Set inputs for BLASLAPACK
+  int length = gamma_length_;
+  int increment = 1;
+
+  // Copy values
+  dcopy_(&length, primal_solution_.values(), &increment, d, &increment);
+
+} // end primalSolution
+
+// Get primal solution 2-norm square
+double QPSolverFISTA::primalSolutionNorm2Squared()
+{
+
+  // Set inputs for BLASLAPACK
+  int length = gamma_length_;
+  int increment = 1;
+
+  // Set norm
+  double primal_solution_norm_2 = dnrm2_(&length, primal_solution_.values(), &increment);
+
+  // Set maximum
+  if (std::isnan(primal_solution_norm_2) || primal_solution_norm_2 > NONOPT_DOUBLE_INFINITY) {
+    primal_solution_norm_2 = NONOPT_DOUBLE_INFINITY;
+  }
+
+  // Return 2-norm square
+  return primal_solution_norm_2 * primal_solution_norm_2;
+
+} // end primalSolutionNorm2Squared
+
+// Set null solution
+void QPSolverFISTA::setNullSolution()
+{
+
+  // Algorithm parameters
+  iteration_count_ = 0;
+  kkt_error_ = NONOPT_DOUBLE_INFINITY;
+
+  // Initialize solution
+  omega_.setLength(0);
+  gamma_.setLength(gamma_length_);
+  combination_.setLength(gamma_length_);
+  combination_translated_.setLength(gamma_length_);
+  primal_solution_.setLength(gamma_length_);
+
+} // end setNullSolution
+
+// Add vectors
+void QPSolverFISTA::addData(const std::vector<std::shared_ptr<Vector>> vector_list,
+                            const std::vector<double> vector)
+{
+
+  // Loop through new elements
+  for (int i = 0; i < (int)vector.size(); i++) {
+    vector_list_.push_back(vector_list[i]);
+    vector_.push_back(vector[i]);
+  }
+
+} // end addData
+
+// Solve
+void QPSolverFISTA::solveQP(const Options* options,
+                            const Reporter* reporter,
+                            Quantities* quantities)
+{
+  solve(reporter, quantities, warm_start_);
+}
+
+// Solve hot
+void QPSolverFISTA::solveQPHot(const Options* options,
+                               const Reporter* reporter,
+                               Quantities* quantities)
+{
+  solve(reporter, quantities, true);
+}
+
+// Solve from initial iterate
+void QPSolverFISTA::solve(const Reporter* reporter,
+                          Quantities* quantities,
+                          bool warm_start)
+{
+
+  // Initialize values
+  setStatus(QP_UNSET);
+  iteration_count_ = 0;
+  kkt_error_ = NONOPT_DOUBLE_INFINITY;
+
+  // Check quantity compatibility
+  if (!checkQuantityCompatibility()) {
+    setStatus(QP_INPUT_ERROR);
+    return;
+  }
+
+  // try to solve QP, terminate on any exception
+  try {
+
+    // Initialize iterate
+    initializeIterate(warm_start);
+
+    // Set length
+    int length = (int)vector_.size();
+
+    // Initialize Lipschitz constant estimates for omega and gamma blocks (previous estimates decreased)
+    double lipschitz_omega = lipschitz_omega_ / backtracking_factor_;
+    double lipschitz_gamma = lipschitz_gamma_ / backtracking_factor_;
+
+    // Initialize extrapolated iterate and momentum parameter
+    iterate_extrapolated_->omega.copy(iterate_->omega);
+    iterate_extrapolated_->gamma.copy(iterate_->gamma);
+    iterate_extrapolated_->combination.copy(iterate_->combination);
+    iterate_extrapolated_->product.copy(iterate_->product);
+    iterate_extrapolated_->quadratic = iterate_->quadratic;
+    double momentum = 1.0;
+
+    // Print message
+    reporter->printf(R_QP, R_PER_ITERATION, "\n");
+
+    // Iteration loop
+    while (true) {
+
+      // Print message
+      if (iteration_count_ % 20 == 0) {
+        reporter->printf(R_QP, R_PER_ITERATION, "====================================================\n"
+                                                "  Iter.   Lip.(omega)  Lip.(gamma)  Objective    Gap\n"
+                                                "====================================================\n");
+      }
+
+      // Evaluate gradient at extrapolated iterate, i.e., G^T*W*v - b (gamma part is W*v)
+      evaluateBundleProducts(iterate_extrapolated_->product);
+      for (int i = 0; i < length; i++) {
+        gradient_omega_[i] = bundle_products_[i] - vector_[i];
+      }
+
+      // Set initial Lipschitz constant estimates, if needed
+      if (lipschitz_omega <= 0.0 || lipschitz_gamma <= 0.0) {
+        initializeLipschitzEstimates(lipschitz_omega, lipschitz_gamma);
+      }
+
+      // Backtracking loop
+      double step_norm2_squared;
+      while (true) {
+
+        // Set trial omega by projected gradient step
+        double* omega_trial = iterate_trial_->omega.valuesModifiable();
+        for (int i = 0; i < length; i++) {
+          omega_trial[i] = iterate_extrapolated_->omega.values()[i] - gradient_omega_[i] / lipschitz_omega;
+        }
+        projectOntoSimplex(omega_trial, length);
+
+        // Set trial gamma by soft-thresholded gradient step
+        double* gamma_trial = iterate_trial_->gamma.valuesModifiable();
+        double threshold = scalar_ / lipschitz_gamma;
+        for (int i = 0; i < gamma_length_; i++) {
+          double value = iterate_extrapolated_->gamma.values()[i] - iterate_extrapolated_->product.values()[i] / lipschitz_gamma;
+          gamma_trial[i] = (value > threshold) ? value - threshold : ((value < -threshold) ? value + threshold : 0.0);
+        } // end for
+
+        // Evaluate trial iterate
+        evaluateIterate(*iterate_trial_);
+
+        // Check nan error
+        if (std::isnan(iterate_trial_->objective)) {
+          THROW_EXCEPTION(QP_NAN_ERROR_EXCEPTION, "QP solve unsuccessful.  NaN error.");
+        }
+
+        // Evaluate step norms and curvature along step, i.e., (v_trial - v)^T*W*(v_trial - v)
+        double step_omega_norm2_squared = 0.0;
+        for (int i = 0; i < length; i++) {
+          step_omega_norm2_squared += pow(omega_trial[i] - iterate_extrapolated_->omega.values()[i], 2.0);
+        }
+        double step_gamma_norm2_squared = 0.0;
+        for (int i = 0; i < gamma_length_; i++) {
+          step_gamma_norm2_squared += pow(gamma_trial[i] - iterate_extrapolated_->gamma.values()[i], 2.0);
+        }
+        step_norm2_squared = step_omega_norm2_squared + step_gamma_norm2_squared;
+        double curvature = 0.0;
+        for (int i = 0; i < gamma_length_; i++) {
+          curvature += (iterate_trial_->combination.values()[i] - iterate_extrapolated_->combination.values()[i]) *
+                       (iterate_trial_->product.values()[i] - iterate_extrapolated_->product.values()[i]);
+        }
+
+        // Check sufficient decrease condition for block-diagonal metric (allowing for rounding errors in differences)
+        if (curvature <= lipschitz_omega * step_omega_norm2_squared + lipschitz_gamma * step_gamma_norm2_squared + 10.0 * DBL_EPSILON * (iterate_trial_->quadratic + iterate_extrapolated_->quadratic)) {
+          break;
+        }
+
+        // Evaluate curvature for gamma block, i.e., (gamma_trial - gamma)^T*W*(gamma_trial - gamma),
+        // and for omega block, i.e., (G*(omega_trial - omega))^T*W*(G*(omega_trial - omega))
+        // (previous iterate is overwritten after backtracking, so its vectors are used for storage)
+        Vector& step_gamma = iterate_previous_->combination;
+        Vector& step_gamma_product = iterate_previous_->product;
+        step_gamma.linearCombination(1.0, iterate_trial_->gamma, -1.0, iterate_extrapolated_->gamma);
+        matrix_->matrixVectorProductOfInverse(step_gamma, step_gamma_product);
+        double curvature_gamma = step_gamma.innerProduct(step_gamma_product);
+        double curvature_omega = curvature + curvature_gamma;
+        for (int i = 0; i < gamma_length_; i++) {
+          curvature_omega -= 2.0 * (iterate_trial_->combination.values()[i] - iterate_extrapolated_->combination.values()[i]) * step_gamma_product.values()[i];
+        }
+
+        // Increase Lipschitz constant estimates for blocks that violate their part of the condition
+        // (since (v_trial - v)^T*W*(v_trial - v) is at most twice the sum of the block curvatures)
+        bool increase_omega = (2.0 * curvature_omega > lipschitz_omega * step_omega_norm2_squared);
+        bool increase_gamma = (2.0 * curvature_gamma > lipschitz_gamma * step_gamma_norm2_squared);
+        if (increase_omega || !increase_gamma) {
+          lipschitz_omega *= backtracking_factor_;
+        }
+        if (increase_gamma || !increase_omega) {
+          lipschitz_gamma *= backtracking_factor_;
+        }
+
+      } // end while (backtracking loop)
+
+      // Store Lipschitz constant estimates
+      lipschitz_omega_ = lipschitz_omega;
+      lipschitz_gamma_ = lipschitz_gamma;
+
+      // Increment iteration counter
+      iteration_count_++;
+
+      // Update iterates (trial becomes current, current becomes previous)
+      std::swap(iterate_previous_, iterate_);
+      std::swap(iterate_, iterate_trial_);
+
+      // Check for objective increase
+      if (iterate_->objective > iterate_previous_->objective) {
+
+        // Restart momentum at current iterate
+        momentum = 1.0;
+        iterate_extrapolated_->omega.copy(iterate_->omega);
+        iterate_extrapolated_->gamma.copy(iterate_->gamma);
+        iterate_extrapolated_->combination.copy(iterate_->combination);
+        iterate_extrapolated_->product.copy(iterate_->product);
+
+      } // end if
+      else {
+
+        // Update momentum parameter
+        double momentum_next = 0.5 * (1.0 + sqrt(1.0 + 4.0 * momentum * momentum));
+        double beta = (momentum - 1.0) / momentum_next;
+        momentum = momentum_next;
+
+        // Set extrapolated iterate
+        iterate_extrapolated_->omega.linearCombination(1.0 + beta, iterate_->omega, -beta, iterate_previous_->omega);
+        iterate_extrapolated_->gamma.linearCombination(1.0 + beta, iterate_->gamma, -beta, iterate_previous_->gamma);
+        iterate_extrapolated_->combination.linearCombination(1.0 + beta, iterate_->combination, -beta, iterate_previous_->combination);
+        iterate_extrapolated_->product.linearCombination(1.0 + beta, iterate_->product, -beta, iterate_previous_->product);
+
+      } // end else
+      iterate_extrapolated_->quadratic = iterate_extrapolated_->combination.innerProduct(iterate_extrapolated_->product);
+
+      // Print message
+      reporter->printf(R_QP, R_PER_ITERATION, " %6d  %+.4e  %+.4e  %+.4e", iteration_count_, lipschitz_omega, lipschitz_gamma, iterate_->objective);
+
+      // Check termination conditions (step of zero implies extrapolated iterate is optimal)
+      if (iteration_count_ % termination_check_interval_ == 0 || step_norm2_squared == 0.0) {
+        bool terminate = terminationCondition(quantities);
+        reporter->printf(R_QP, R_PER_ITERATION, "  %+.4e\n", kkt_error_);
+        if (terminate || step_norm2_squared == 0.0) {
+          THROW_EXCEPTION(QP_SUCCESS_EXCEPTION, "QP solve successful.");
+        }
+      } // end if
+      else {
+        reporter->printf(R_QP, R_PER_ITERATION, "\n");
+      }
+
+      // Check for iteration limit
+      if (iteration_count_ >= iteration_limit_) {
+        THROW_EXCEPTION(QP_ITERATION_LIMIT_EXCEPTION, "QP solve unsuccessful. Iteration limit reached.");
+      }
+
+      // Check for CPU time limit
+      if ((clock() - quantities->startTime()) / (double)CLOCKS_PER_SEC >= quantities->cpuTimeLimit()) {
+        THROW_EXCEPTION(QP_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+      }
+
+      // Check for wall time limit
+      if (quantities->currentWallTime() - quantities->startWallTime() >= quantities->wallTimeLimit()) {
+        THROW_EXCEPTION(QP_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+      }
+
+    } // end while (iteration loop)
+
+  } // end try
+
+  // catch exceptions
+  catch (QP_SUCCESS_EXCEPTION& exec) {
+    setStatus(QP_SUCCESS);
+  } catch (QP_CPU_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_CPU_TIME_LIMIT);
+    finalizeSolution();
+    THROW_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
+  } catch (QP_WALL_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_WALL_TIME_LIMIT);
+    finalizeSolution();
+    THROW_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+  } catch (QP_ITERATION_LIMIT_EXCEPTION& exec) {
+    setStatus(QP_ITERATION_LIMIT);
+  } catch (QP_NAN_ERROR_EXCEPTION& exec) {
+    setStatus(QP_NAN_ERROR);
+  }
+
+  // Print new line
+  reporter->printf(R_QP, R_PER_ITERATION, "\n");
+
+  // Finalize solution
+  finalizeSolution();
+
+} // end solve
+
+// Check quantities
+bool QPSolverFISTA::checkQuantityCompatibility()
+{
+
+  // Check for null pointer to matrix
+  if (matrix_ == nullptr) {
+    return false;
+  }
+
+  // Check matrix size
+  if (gamma_length_ != matrix_->size()) {
+    return false;
+  }
+
+  // Loop through vector list
+  for (int i = 0; i < (int)vector_list_.size(); i++) {
+
+    // Check vector size
+    if (gamma_length_ != vector_list_[i]->length()) {
+      return false;
+    }
+
+  } // end for
+
+  // Check length of vector list and vector (should be nonempty)
+  if ((int)vector_list_.size() != (int)vector_.size() || vector_.size() == 0) {
+    return false;
+  }
+
+  // Check scalar (should be positive)
+  if (scalar_ <= 0.0) {
+    return false;
+  }
+
+  // Return success
+  return true;
+
+} // end checkQuantityCompatibility
+
+// Evaluate bundle products
+void QPSolverFISTA::evaluateBundleProducts(const Vector& vector)
+{
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'T';
+  int length = gamma_length_;
+  int size = (int)vector_.size();
+  int increment = 1;
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Compute products G^T*vector (one matrix-vector product with contiguous bundle)
+  dgemv_(&transpose, &length, &size, &one, bundle_.data(), &length, vector.values(), &increment, &zero, bundle_products_, &increment);
+
+} // end evaluateBundleProducts
+
+// Evaluate primal solution
+double QPSolverFISTA::evaluatePrimalSolution()
+{
+
+  // Set projection scalar so that d is feasible
+  double product_norm_inf = iterate_->product.normInf();
+  double projection_scalar = (product_norm_inf > scalar_) ? scalar_ / product_norm_inf : 1.0;
+
+  // Set primal solution, i.e., -W*(G*omega + gamma), scaled onto inf-norm ball
+  // (scaling, rather than projecting elementwise, yields d^T*H*d without products with H)
+  primal_solution_.copy(iterate_->product);
+  primal_solution_.scale(-projection_scalar);
+
+  // Return projection scalar
+  return projection_scalar;
+
+} // end evaluatePrimalSolution
+
+// Evaluate iterate
+void QPSolverFISTA::evaluateIterate(Iterate& iterate)
+{
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'N';
+  int length = gamma_length_;
+  int size = (int)vector_.size();
+  int increment = 1;
+  double one = 1.0;
+
+  // Evaluate combination G*omega + gamma (one matrix-vector product with contiguous bundle)
+  iterate.combination.copy(iterate.gamma);
+  dgemv_(&transpose, &length, &size, &one, bundle_.data(), &length, iterate.omega.values(), &increment, &one, iterate.combination.valuesModifiable(), &increment);
+
+  // Evaluate product W*(G*omega + gamma)
+  matrix_->matrixVectorProductOfInverse(iterate.combination, iterate.product);
+
+  // Evaluate quadratic value
+  iterate.quadratic = iterate.combination.innerProduct(iterate.product);
+
+  // Evaluate objective value, i.e., 0.5*v^T*W*v - b^T*omega + r*||gamma||_1
+  iterate.objective = 0.5 * iterate.quadratic - ddot_(&size, vector_.data(), &increment, iterate.omega.values(), &increment);
+  if (scalar_ < NONOPT_DOUBLE_INFINITY) {
+    iterate.objective += scalar_ * iterate.gamma.norm1();
+  }
+
+} // end evaluateIterate
+
+// Finalize solution
+void QPSolverFISTA::finalizeSolution()
+{
+
+  // Set dual solution
+  omega_.setLength((int)vector_.size());
+  omega_.copy(iterate_->omega);
+  gamma_.copy(iterate_->gamma);
+
+  // Set combinations
+  combination_translated_.copy(iterate_->combination);
+  combination_.linearCombination(1.0, iterate_->combination, -1.0, iterate_->gamma);
+
+  // Set primal solution
+  evaluatePrimalSolution();
+
+} // end finalizeSolution
+
+// Initialize Lipschitz constant estimates
+void QPSolverFISTA::initializeLipschitzEstimates(double& lipschitz_omega,
+                                                 double& lipschitz_gamma)
+{
+
+  // Set gamma block estimate as Rayleigh quotient of W at extrapolated combination
+  double combination_norm2_squared = pow(iterate_extrapolated_->combination.norm2(), 2.0);
+  lipschitz_gamma = (iterate_extrapolated_->quadratic > 0.0 && combination_norm2_squared > 0.0) ? iterate_extrapolated_->quadratic / combination_norm2_squared : 1.0;
+
+  // Set direction as gradient projected onto null space of sum(omega), i.e., tangent to simplex
+  // (the Rayleigh quotient of G^T*W*G along the mean gradient would overestimate the curvature
+  //  along feasible directions)
+  int length = (int)vector_.size();
+  double* direction = workspace_.reserve(WA_DIRECTION, length);
+  double mean = 0.0;
+  for (int i = 0; i < length; i++) {
+    mean += gradient_omega_[i] / (double)length;
+  }
+  double direction_norm2_squared = 0.0;
+  for (int i = 0; i < length; i++) {
+    direction[i] = gradient_omega_[i] - mean;
+    direction_norm2_squared += direction[i] * direction[i];
+  }
+
+  // Check for zero direction
+  if (direction_norm2_squared <= 0.0) {
+    lipschitz_omega = lipschitz_gamma;
+    return;
+  }
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'N';
+  int gamma_length = gamma_length_;
+  int increment = 1;
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Set omega block estimate as Rayleigh quotient of G^T*W*G along direction
+  // (previous iterate is overwritten in first iteration, so its vectors are used for storage)
+  Vector& combination = iterate_previous_->combination;
+  Vector& product = iterate_previous_->product;
+  dgemv_(&transpose, &gamma_length, &length, &one, bundle_.data(), &gamma_length, direction, &increment, &zero, combination.valuesModifiable(), &increment);
+  matrix_->matrixVectorProductOfInverse(combination, product);
+  double quadratic = combination.innerProduct(product);
+  lipschitz_omega = (quadratic > 0.0) ? quadratic / direction_norm2_squared : lipschitz_gamma;
+
+} // end initializeLipschitzEstimates
+
+// Initialize iterate
+void QPSolverFISTA::initializeIterate(bool warm_start)
+{
+
+  // Set lengths (values initialized to zero)
+  int size = (int)vector_.size();
+  Iterate* iterates[4] = {iterate_.get(), iterate_extrapolated_.get(), iterate_previous_.get(), iterate_trial_.get()};
+  for (int k = 0; k < 4; k++) {
+    iterates[k]->omega.setLength(size);
+    iterates[k]->gamma.setLength(gamma_length_);
+    iterates[k]->combination.setLength(gamma_length_);
+    iterates[k]->product.setLength(gamma_length_);
+  } // end for
+
+  // Reserve arrays (retained across calls, so reallocation only occurs for larger lengths)
+  bundle_products_ = workspace_.reserve(WA_BUNDLE_PRODUCTS, size);
+  gradient_omega_ = workspace_.reserve(WA_GRADIENT_OMEGA, size);
+
+  // Set omega from previous solution for vectors that remain in vector list
+  double sum = 0.0;
+  if (warm_start && omega_.length() == (int)bundle_vector_list_.size()) {
+    std::unordered_map<const Vector*, int> positions;
+    for (int j = 0; j < (int)bundle_vector_list_.size(); j++) {
+      positions[bundle_vector_list_[j].get()] = j;
+    }
+    for (int i = 0; i < size; i++) {
+      std::unordered_map<const Vector*, int>::const_iterator position = positions.find(vector_list_[i].get());
+      if (position != positions.end()) {
+        iterate_->omega.set(i, omega_.values()[position->second]);
+        sum += omega_.values()[position->second];
+      } // end if
+    }   // end for
+  }     // end if
+
+  // Scale warm start onto simplex (keeping gamma, if finite radius), or set uniform omega
+  if (sum > 0.0) {
+    iterate_->omega.scale(1.0 / sum);
+    if (scalar_ < NONOPT_DOUBLE_INFINITY) {
+      iterate_->gamma.copy(gamma_);
+    }
+  } // end if
+  else {
+    for (int i = 0; i < size; i++) {
+      iterate_->omega.set(i, 1.0 / (double)size);
+    }
+  } // end else
+
+  // Determine number of leading vectors unchanged since last bundle update
+  int unchanged = 0;
+  while (unchanged < (int)bundle_vector_list_.size() &&
+         unchanged < size &&
+         bundle_vector_list_[unchanged] == vector_list_[unchanged]) {
+    unchanged++;
+  }
+
+  // Copy changed vectors into bundle
+  bundle_.resize((size_t)size * gamma_length_);
+  for (int i = unchanged; i < size; i++) {
+    memcpy(&bundle_[(size_t)i * gamma_length_], vector_list_[i]->values(), gamma_length_ * sizeof(double));
+  }
+
+  // Set vector list to which bundle corresponds
+  bundle_vector_list_ = vector_list_;
+
+  // Evaluate iterate
+  evaluateIterate(*iterate_);
+
+} // end initializeIterate
+
+// Project onto unit simplex
+void QPSolverFISTA::projectOntoSimplex(double* values,
+                                       int length)
+{
+
+  // Sort values in decreasing order
+  double* sorted = workspace_.reserve(WA_PROJECTION, length);
+  memcpy(sorted, values, length * sizeof(double));
+  std::sort(sorted, sorted + length, std::greater<double>());
+
+  // Determine threshold, i.e., tau such that sum(max(values - tau, 0)) = 1
+  double cumulative_sum = 0.0;
+  double threshold = 0.0;
+  for (int i = 0; i < length; i++) {
+    cumulative_sum += sorted[i];
+    double candidate = (cumulative_sum - 1.0) / (double)(i + 1);
+    if (sorted[i] > candidate) {
+      threshold = candidate;
+    }
+    else {
+      break;
+    }
+  } // end for
+
+  // Set projected values
+  for (int i = 0; i < length; i++) {
+    values[i] = fmax(values[i] - threshold, 0.0);
+  }
+
+} // end projectOntoSimplex
+
+// Termination condition
+bool QPSolverFISTA::terminationCondition(const Quantities* quantities)
+{
+
+  // Evaluate projected primal solution and bundle products G^T*d
+  double projection_scalar = evaluatePrimalSolution();
+  evaluateBundleProducts(primal_solution_);
+
+  // Evaluate primal objective at projected d, i.e., max_i (b_i + g_i^T*d) + 0.5*d^T*H*d
+  double b_max = -NONOPT_DOUBLE_INFINITY;
+  double bPlusGd_max = -NONOPT_DOUBLE_INFINITY;
+  for (int i = 0; i < (int)vector_.size(); i++) {
+    b_max = fmax(b_max, vector_[i]);
+    bPlusGd_max = fmax(bPlusGd_max, vector_[i] + bundle_products_[i]);
+  } // end for
+  double primal_objective = bPlusGd_max + 0.5 * pow(projection_scalar, 2.0) * iterate_->quadratic;
+
+  // Evaluate dual objective
+  double dual_objective = -iterate_->objective;
+
+  // Set duality gap as KKT error
+  kkt_error_ = primal_objective - dual_objective;
+
+  // Check for optimality (relative to primal objective)
+  if (kkt_error_ <= kkt_tolerance_ * fmax(1.0, fabs(primal_objective))) {
+    return true;
+  }
+
+  // Check for inexact termination
+  if (allow_inexact_termination_) {
+
+    // Evaluate combination inf-norm, i.e., ||G*omega||_inf
+    double combination_norm_inf = 0.0;
+    for (int i = 0; i < gamma_length_; i++) {
+      combination_norm_inf = fmax(combination_norm_inf, fabs(iterate_->combination.values()[i] - iterate_->gamma.values()[i]));
+    }
+
+    // Check "zero d" condition
+    if (primal_solution_.normInf() <= inexact_solution_tolerance_ &&
+        combination_norm_inf <= inexact_solution_tolerance_ &&
+        iterate_->combination.normInf() <= inexact_solution_tolerance_) {
+      return true;
+    }
+
+    // Check "nonzero d" condition, i.e., descent for first vector and gap small relative to reduction
+    double factor = pow(quantities->inexactTerminationFactor(), 2.0) + 2 * quantities->inexactTerminationFactor();
+    if (bundle_products_[0] <= inexact_termination_descent_tolerance_ * primal_solution_.innerProduct(iterate_->combination) &&
+        factor * (b_max - primal_objective) >= kkt_error_) {
+      return true;
+    }
+
+  } // end if
+
+  // Return
+  return false;
+
+} // end terminationCondition
+
+} // namespace NonOpt
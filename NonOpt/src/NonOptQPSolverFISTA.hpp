@@ -0,0 +1,395 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTQPSOLVERFISTA_HPP__
+#define __NONOPTQPSOLVERFISTA_HPP__
+
+#include "NonOptQPSolver.hpp"
+#include "NonOptWorkspace.hpp"
+
+namespace NonOpt
+{
+
+/**
+ * QPSolverFISTA class
+ * (Accelerated proximal gradient method with backtracking and adaptive restart applied
+ *  to the dual, i.e., projection of omega onto the unit simplex and soft-thresholding of
+ *  gamma.  Each iteration requires two products with the contiguously stored "G" and one
+ *  product with "W", so that no factorization is maintained.  Solves are warm-started
+ *  from the previous omega for vectors that remain in the vector list.)
+ */
+class QPSolverFISTA : public QPSolver
+{
+
+public:
+  /** @name Constructor */
+  //@{
+  /**
+   * Constructor
+   */
+  QPSolverFISTA();
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Destructor
+   */
+  ~QPSolverFISTA();
+  //@}
+
+  /** @name Options handling methods */
+  //@{
+  /**
+   * Add options
+   * \param[in,out] options is pointer to Options object from NonOpt
+   */
+  void addOptions(Options* options);
+  /**
+   * Set options
+   * \param[in] options is pointer to Options object from NonOpt
+   */
+  void setOptions(Options* options);
+  //@}
+
+  /** @name Initialization method */
+  //@{
+  /**
+   * Initialize strategy
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in,out] quantities is pointer to Quantities object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   */
+  void initialize(const Options* options,
+                  Quantities* quantities,
+                  const Reporter* reporter);
+  /**
+   * Initialize data
+   * \param[in] gamma_length is length of gamma solution vector
+   */
+  void initializeData(int gamma_length);
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Get combination of vectors' infinity norm
+   * \return "||G*omega||_inf"
+   */
+  double combinationNormInf() { return combination_.normInf(); };
+  /**
+   * Get translated combination of vectors' infinity norm
+   * \return "||G*omega + gamma||_inf"
+   */
+  double combinationTranslatedNormInf() { return combination_translated_.normInf(); };
+  /**
+   * Get translated combination of vectors' infinity norm
+   * \return "||G*omega + gamma||_2^2"
+   */
+  double combinationTranslatedNorm2Squared();
+  /**
+   * Get dual objective quadratic value
+   * \return "(G*omega + gamma)'*W*(G*omega + gamma)"
+   */
+  double dualObjectiveQuadraticValue();
+  /**
+   * Get dual solution
+   * \param[out] omega is dual solution, omega part
+   * \param[out] gamma is dual solution, gamma part
+   */
+  void dualSolution(double omega[], double gamma[]);
+  /**
+   * Get dual solution, omega part
+   * \param[out] omega is dual solution, omega part
+   */
+  void dualSolutionOmega(double omega[]);
+  /**
+   * Get dual solution, omega part, length
+   * \return dual solution, omega part, length
+   */
+  int dualSolutionOmegaLength() { return (int)vector_.size(); };
+  /**
+   * Get KKT error
+   * \return solver's KKT error (duality gap)
+   */
+  double KKTError() { return kkt_error_; };
+  /**
+   * Get KKT error full
+   * \return full KKT error corresponding to dual solution
+   */
+  double KKTErrorDual();
+  /**
+   * Get iteration count
+   * \return number of iterations performed
+   */
+  int numberOfIterations() { return iteration_count_; };
+  /**
+   * Get primal solution
+   * \param[out] "d" (equal to "-W*(G*omega + gamma)", scaled onto "||d||_inf <= r")
+   */
+  void primalSolution(double d[]);
+  /**
+   * Get primal solution infinity norm
+   * \return "||d||_inf"
+   */
+  double primalSolutionNormInf() { return primal_solution_.normInf(); };
+  /**
+   * Get primal solution 2-norm square
+   * \return "||d||_2^2"
+   */
+  double primalSolutionNorm2Squared();
+  /**
+   * Get name of strategy
+   * \return string with name of strategy
+   */
+  std::string name() { return "FISTA"; };
+  /**
+   * Vector list length
+   */
+  inline int const vectorListLength() const { return (int)vector_list_.size(); };
+  /**
+   * Workspace bytes allocated
+   * \return number of bytes allocated (including reallocations) for workspace arrays
+   */
+  inline size_t const workspaceBytesAllocated() const { return workspace_.bytesAllocated(); };
+  //@}
+
+  /** @name Set methods */
+  //@{
+  /**
+   * Set inexact solution tolerance
+   */
+  void setInexactSolutionTolerance(double tolerance) { inexact_solution_tolerance_ = tolerance; };
+  /**
+   * Set "d" to zero
+   */
+  void setPrimalSolutionToZero() { primal_solution_.scale(0.0); };
+  /**
+   * Set matrix
+   * \param[in] matrix is pointer to SymmetricMatrix, for which "W" is the "Inverse"
+   */
+  void setMatrix(const std::shared_ptr<SymmetricMatrix> matrix) { matrix_ = matrix; };
+  /**
+   * Set null solution
+   */
+  void setNullSolution();
+  /**
+   * Set vector list
+   * \param[in] vector_list is vector of pointers to Vectors to be set as QP "G" data
+   */
+  void setVectorList(const std::vector<std::shared_ptr<Vector>> vector_list) { vector_list_ = vector_list; };
+  /**
+   * Set vector
+   * \param[in] vector is vector of double values to be set as QP "b" data
+   */
+  void setVector(const std::vector<double> vector) { vector_ = vector; };
+  /**
+   * Set scalar
+   * \param[in] scalar is double value to be set as QP "r" data
+   */
+  void setScalar(double scalar) { scalar_ = scalar; };
+  //@}
+
+  /** @name Add data methods */
+  //@{
+  /**
+   * Add vectors
+   * \param[in] vector_list is vector of pointers to Vectors to be added to QP "G" data
+   * \param[in] vector is vector of double values to be added to QP "b" data
+   */
+  void addData(const std::vector<std::shared_ptr<Vector>> vector_list,
+               const std::vector<double> vector);
+  //@}
+
+  /** @name Solve methods */
+  //@{
+  /**
+   * Solve QP (warm-started from previous solution if warm start option is set)
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   */
+  void solveQP(const Options* options,
+               const Reporter* reporter,
+               Quantities* quantities);
+  /**
+   * Solve QP hot, after new data added, warm-started from previous solution
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   */
+  void solveQPHot(const Options* options,
+                  const Reporter* reporter,
+                  Quantities* quantities);
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  QPSolverFISTA(const QPSolverFISTA&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const QPSolverFISTA&);
+  //@}
+
+  /** @name Private enumerations */
+  //@{
+  /**
+   * Workspace array indices
+   */
+  enum WorkspaceArray {
+    WA_BUNDLE_PRODUCTS = 0,
+    WA_DIRECTION,
+    WA_GRADIENT_OMEGA,
+    WA_PROJECTION
+  };
+  //@}
+
+  /** @name Private structures */
+  //@{
+  /**
+   * Dual iterate with combination "v = G*omega + gamma", product "W*v", and objective values
+   * (Combination and product are linear in (omega,gamma), so those for extrapolated
+   *  iterates are formed from those of previous iterates without further products.)
+   */
+  struct Iterate {
+    Vector omega;
+    Vector gamma;
+    Vector combination;
+    Vector product;
+    double quadratic;
+    double objective;
+  };
+  //@}
+
+  /** @name Private members */
+  //@{
+  /**
+   * Length parameters
+   */
+  int gamma_length_;
+  /**
+   * Input parameters
+   */
+  bool allow_inexact_termination_;
+  bool warm_start_;
+  double backtracking_factor_;
+  double inexact_solution_tolerance_;
+  double inexact_termination_descent_tolerance_;
+  double kkt_tolerance_;
+  int iteration_limit_;
+  int termination_check_interval_;
+  /**
+   * QP data quantities
+   */
+  double scalar_;                                    /**< "r" */
+  std::shared_ptr<SymmetricMatrix> matrix_;          /**< "W" */
+  std::vector<std::shared_ptr<Vector>> vector_list_; /**< "G" */
+  std::vector<double> vector_;                       /**< "b" */
+  /**
+   * Algorithm parameters
+   */
+  int iteration_count_;
+  double kkt_error_;
+  double lipschitz_gamma_;
+  double lipschitz_omega_;
+  /**
+   * Algorithm quantities
+   * (Arrays are owned by workspace, which is retained across solves.)
+   */
+  Workspace workspace_;
+  double* bundle_products_;
+  double* gradient_omega_;
+  std::shared_ptr<Iterate> iterate_;
+  std::shared_ptr<Iterate> iterate_extrapolated_;
+  std::shared_ptr<Iterate> iterate_previous_;
+  std::shared_ptr<Iterate> iterate_trial_;
+  /**
+   * Solution quantities
+   */
+  Vector combination_;
+  Vector combination_translated_;
+  Vector gamma_;
+  Vector omega_;
+  Vector primal_solution_;
+  /**
+   * Bundle quantities
+   * (Copy of "G" stored contiguously, column-major, and vector list to which it corresponds.)
+   */
+  std::vector<double> bundle_;
+  std::vector<std::shared_ptr<Vector>> bundle_vector_list_;
+  //@}
+
+  /** @name Private methods */
+  //@{
+  /**
+   * Sanity check
+   */
+  bool checkQuantityCompatibility();
+  /**
+   * Solve QP from initial iterate
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   * \param[in] quantities is pointer to Quantities object from NonOpt
+   * \param[in] warm_start indicates whether to warm start from previous solution
+   */
+  void solve(const Reporter* reporter,
+             Quantities* quantities,
+             bool warm_start);
+  /**
+   * Evaluate bundle products, i.e., G^T*vector
+   * \param[in] vector is reference to Vector of length gamma_length_
+   */
+  void evaluateBundleProducts(const Vector& vector);
+  /**
+   * Evaluate primal solution, i.e., "-W*(G*omega + gamma)" for current iterate, scaled onto "||d||_inf <= r"
+   * \return scalar by which "-W*(G*omega + gamma)" is scaled
+   */
+  double evaluatePrimalSolution();
+  /**
+   * Evaluate combination, product, and objective values of iterate from its omega and gamma
+   * \param[in,out] iterate is Iterate to evaluate
+   */
+  void evaluateIterate(Iterate& iterate);
+  /**
+   * Finalize solution, i.e., set omega, gamma, combinations, and projected primal solution
+   */
+  void finalizeSolution();
+  /**
+   * Initialize Lipschitz constant estimates for omega and gamma blocks (as Rayleigh quotients)
+   * \param[out] lipschitz_omega is estimate for omega block
+   * \param[out] lipschitz_gamma is estimate for gamma block
+   */
+  void initializeLipschitzEstimates(double& lipschitz_omega,
+                                    double& lipschitz_gamma);
+  /**
+   * Initialize iterate, mapping previous omega to vectors remaining in vector list if warm starting
+   * \param[in] warm_start indicates whether to warm start from previous solution
+   */
+  void initializeIterate(bool warm_start);
+  /**
+   * Project onto unit simplex, i.e., {omega : omega >= 0, sum(omega) = 1}
+   * \param[in,out] values is pointer to array of values to project
+   * \param[in] length is length of array
+   */
+  void projectOntoSimplex(double* values,
+                          int length);
+  /**
+   * Termination condition based on duality gap (and inexact conditions, if allowed)
+   * \param[in] quantities is pointer to Quantities object from NonOpt
+   * \return indicator of whether to terminate
+   */
+  bool terminationCondition(const Quantities* quantities);
+  //@}
+
+}; // end QPSolverFISTA
+
+} // namespace NonOpt
+
+#endif /* __NONOPTQPSOLVERFISTA_HPP__ */
@@ -14,16 +14,19 @@ namespace NonOpt
 
 // Constructor
 Quantities::Quantities()
-  : direction_computation_time_(0),
-    evaluation_time_(0),
+  : evaluation_time_(0),
+    evaluation_wall_time_(0.0),
+    function_counter_(0),
+    gradient_counter_(0),
+    direction_computation_time_(0),
     line_search_time_(0),
+    direction_computation_wall_time_(0.0),
+    line_search_wall_time_(0.0),
     inexact_termination_factor_(0.0),
     iterate_norm_initial_(0.0),
     stationarity_radius_(0.0),
     stepsize_(0.0),
     trust_region_radius_(0.0),
-    function_counter_(0),
-    gradient_counter_(0),
     iteration_counter_(0),
     inner_iteration_counter_(0),
     number_of_variables_(0),
@@ -31,8 +34,11 @@ Quantities::Quantities()
     total_inner_iteration_counter_(0),
     total_qp_iteration_counter_(0),
     approximate_hessian_initial_scaling_(false),
+    bundle_compression_(false),
     evaluate_function_with_gradient_(false),
+    bundle_compression_tolerance_(0.0),
     cpu_time_limit_(NONOPT_DOUBLE_INFINITY),
+    gradient_sparsity_threshold_(0.0),
     inexact_termination_factor_initial_(1.0),
     inexact_termination_update_factor_(1.0),
     inexact_termination_update_stepsize_threshold_(1.0),
@@ -45,12 +51,17 @@ Quantities::Quantities()
     trust_region_radius_initialization_factor_(1.0),
     trust_region_radius_initialization_minimum_(1.0),
     trust_region_radius_update_factor_(1.0),
+    wall_time_limit_(NONOPT_DOUBLE_INFINITY),
+    evaluation_cache_size_(0),
     function_evaluation_limit_(10),
     gradient_evaluation_limit_(10),
-    iteration_limit_(1)
+    iteration_limit_(1),
+    memory_pool_size_(0)
 {
   start_time_ = clock();
   end_time_ = start_time_;
+  start_wall_time_ = currentWallTime();
+  end_wall_time_ = start_wall_time_;
   current_iterate_.reset();
   trial_iterate_.reset();
   direction_.reset();
@@ -70,6 +81,13 @@ void Quantities::addOptions(Options* options)
                          false,
                          "Indicator of whether to scale initial matrix for approximate Hessian.\n"
                          "Default     : false");
+  options->addBoolOption("bundle_compression",
+                         true,
+                         "Indicator of whether to merge gradients within the bundle\n"
+                         "              compression tolerance of each other (in the infinity norm) before\n"
+                         "              they are passed to the QP solver in direction computations.\n"
+                         "              Of merged entries, the largest linear term value is kept.\n"
+                         "Default     : true");
   options->addBoolOption("evaluate_function_with_gradient",
                          false,
                          "Determines whether to evaluate function and gradient\n"
@@ -77,6 +95,16 @@ void Quantities::addOptions(Options* options)
                          "Default     : false");
 
   // Add double options
+  options->addDoubleOption("bundle_compression_tolerance",
+                           0.0,
+                           0.0,
+                           NONOPT_DOUBLE_INFINITY,
+                           "Tolerance for merging gradients before they are passed to the QP\n"
+                           "              solver.  Gradients whose infinity-norm distance is at most this\n"
+                           "              tolerance are merged.  If 0, then only identical gradients (e.g.,\n"
+                           "              for sample points on the same piece of a piecewise linear\n"
+                           "              function) are merged, so the QP solution is unchanged.\n"
+                           "Default     : 0.0");
   options->addDoubleOption("cpu_time_limit",
                            1e+04,
                            0.0,
@@ -85,6 +113,19 @@ void Quantities::addOptions(Options* options)
                            "              at the beginning of an iteration, so the true CPU time limit\n"
                            "              also depends on the time required to a complete an iteration.\n"
                            "Default     : 1e+04");
+  options->addDoubleOption("gradient_sparsity_threshold",
+                           0.0,
+                           0.0,
+                           1.0,
+                           "Threshold for treating gradients as sparse.  If positive, then\n"
+                           "              gradients (also in fused and batch evaluations) are evaluated\n"
+                           "              through the problem's sparse gradient methods, with nonzero\n"
+                           "              indices kept in the evaluation cache, and a gradient with at\n"
+                           "              most this fraction of nonzero entries keeps its nonzero\n"
+                           "              indices so that inner products and scaled additions with it\n"
+                           "              (e.g., in QP solves) only loop over those indices.  If 0,\n"
+                           "              then gradients are treated as dense.\n"
+                           "Default     : 0.0");
   options->addDoubleOption("inexact_termination_factor_initial",
                            sqrt(2.0) - 1.0,
                            0.0,
@@ -180,8 +221,30 @@ void Quantities::addOptions(Options* options)
                            "              for updating the stationarity and trust region radii are met,\n"
                            "              then the trust region radius is multiplied by this fraction.\n"
                            "Default     : 1e-01");
+  options->addDoubleOption("wall_time_limit",
+                           1e+04,
+                           0.0,
+                           NONOPT_DOUBLE_INFINITY,
+                           "Limit on the number of wall clock seconds.  This limit is checked\n"
+                           "              wherever the CPU time limit is checked, so the true wall clock\n"
+                           "              time limit also depends on the time required to complete an\n"
+                           "              iteration (or inner iteration).  Unlike the CPU time limit,\n"
+                           "              time spent in threads or in external processes is measured\n"
+                           "              as elapsed real time.\n"
+                           "Default     : 1e+04");
 
   // Add integer options
+  options->addIntegerOption("evaluation_cache_size",
+                            0,
+                            0,
+                            NONOPT_INT_INFINITY,
+                            "Number of points for which objective and gradient values are\n"
+                            "              kept in a least-recently-used cache, keyed by the exact bytes\n"
+                            "              of the point.  Evaluations at a point already in the cache\n"
+                            "              return the stored values without calling the problem (and\n"
+                            "              without counting toward evaluation limits).  If 0, then no\n"
+                            "              values are cached.\n"
+                            "Default     : 0");
   options->addIntegerOption("function_evaluation_limit",
                             1e+05,
                             0,
@@ -201,6 +264,16 @@ void Quantities::addOptions(Options* options)
                             "Limit on the number of iterations that will be performed.\n"
                             "              Note that each iteration might involve inner iterations.\n"
                             "Default     : 1e+04");
+  options->addIntegerOption("memory_pool_size",
+                            0,
+                            0,
+                            NONOPT_INT_INFINITY,
+                            "Number of freed blocks of each size (e.g., Vector value arrays and\n"
+                            "              Point objects) kept for reuse by a solver-owned memory pool,\n"
+                            "              rather than returned to the system allocator.  Memory held\n"
+                            "              is at most this number times the size of each block type.\n"
+                            "              If 0, then no pool is used.\n"
+                            "Default     : 0");
 
 } // end addOptions
 
@@ -210,10 +283,13 @@ void Quantities::setOptions(Options* options)
 
   // Read bool options
   options->valueAsBool("approximate_hessian_initial_scaling", approximate_hessian_initial_scaling_);
+  options->valueAsBool("bundle_compression", bundle_compression_);
   options->valueAsBool("evaluate_function_with_gradient", evaluate_function_with_gradient_);
 
   // Read double options
+  options->valueAsDouble("bundle_compression_tolerance", bundle_compression_tolerance_);
   options->valueAsDouble("cpu_time_limit", cpu_time_limit_);
+  options->valueAsDouble("gradient_sparsity_threshold", gradient_sparsity_threshold_);
   options->valueAsDouble("inexact_termination_factor_initial", inexact_termination_factor_initial_);
   options->valueAsDouble("inexact_termination_update_factor", inexact_termination_update_factor_);
   options->valueAsDouble("inexact_termination_update_stepsize_threshold", inexact_termination_update_stepsize_threshold_);
@@ -226,11 +302,20 @@ void Quantities::setOptions(Options* options)
   options->valueAsDouble("trust_region_radius_initialization_factor", trust_region_radius_initialization_factor_);
   options->valueAsDouble("trust_region_radius_initialization_minimum", trust_region_radius_initialization_minimum_);
   options->valueAsDouble("trust_region_radius_update_factor", trust_region_radius_update_factor_);
+  options->valueAsDouble("wall_time_limit", wall_time_limit_);
 
   // Read integer options
+  options->valueAsInteger("evaluation_cache_size", evaluation_cache_size_);
   options->valueAsInteger("function_evaluation_limit", function_evaluation_limit_);
   options->valueAsInteger("gradient_evaluation_limit", gradient_evaluation_limit_);
   options->valueAsInteger("iteration_limit", iteration_limit_);
+  options->valueAsInteger("memory_pool_size", memory_pool_size_);
+
+  // Set bundle compressor parameters
+  bundle_compressor_.setParameters(bundle_compression_, bundle_compression_tolerance_);
+
+  // Set evaluation cache capacity
+  evaluation_cache_.setCapacity(evaluation_cache_size_);
 
 } // end setOptions
 
@@ -244,6 +329,11 @@ void Quantities::initialize(const std::shared_ptr<Problem> problem)
   direction_computation_time_ = 0;
   evaluation_time_ = 0;
   line_search_time_ = 0;
+  start_wall_time_ = currentWallTime();
+  end_wall_time_ = start_wall_time_;
+  direction_computation_wall_time_ = 0.0;
+  evaluation_wall_time_ = 0.0;
+  line_search_wall_time_ = 0.0;
 
   // Initialize counters
   function_counter_ = 0;
@@ -254,6 +344,13 @@ void Quantities::initialize(const std::shared_ptr<Problem> problem)
   total_inner_iteration_counter_ = 0;
   total_qp_iteration_counter_ = 0;
 
+  // Clear bundle compressor (entries are for a previous problem)
+  bundle_compressor_.clear();
+  bundle_compressor_.resetCounter();
+
+  // Clear evaluation cache (values are for a previous problem)
+  evaluation_cache_.clear();
+
   // Declare integer
   int n;
 
@@ -268,8 +365,16 @@ void Quantities::initialize(const std::shared_ptr<Problem> problem)
   // Set number of variables
   number_of_variables_ = n;
 
-  // Declare vector
-  std::shared_ptr<Vector> v(new Vector(number_of_variables_));
+  // Set memory pool (blocks from a previous problem return to the previous pool)
+  if (memory_pool_size_ > 0) {
+    memory_pool_ = std::make_shared<MemoryPool>(memory_pool_size_);
+  }
+  else {
+    memory_pool_.reset();
+  }
+
+  // Declare vector (Points and Vectors derived from initial iterate are drawn from same pool)
+  std::shared_ptr<Vector> v(new Vector(number_of_variables_, memory_pool_));
 
   // Get initial point
   evaluation_success = problem->initialPoint(number_of_variables_, v->valuesModifiable());
@@ -292,7 +397,7 @@ void Quantities::initialize(const std::shared_ptr<Problem> problem)
   direction_termination_ = std::make_shared<Vector>(number_of_variables_);
 
   // Initialize point set
-  point_set_ = std::make_shared<std::vector<std::shared_ptr<Point>>>();
+  point_set_ = std::make_shared<PointSet>();
 
   // Initialize stepsize
   stepsize_ = 0.0;
@@ -408,6 +513,17 @@ void Quantities::updateRadii()
 
 } // end updateRadii
 
+// Increment evaluation wall time
+void Quantities::incrementEvaluationWallTime(double evaluation_wall_time)
+{
+
+  // Add to total (atomic compare-exchange since evaluations may be performed by worker threads)
+  double current = evaluation_wall_time_.load();
+  while (!evaluation_wall_time_.compare_exchange_weak(current, current + evaluation_wall_time)) {
+  }
+
+} // end incrementEvaluationWallTime
+
 // Print header
 void Quantities::printHeader(const Reporter* reporter)
 {
@@ -449,18 +565,52 @@ void Quantities::printFooter(const Reporter* reporter)
                                   "CPU seconds.......................... : %f\n"
                                   "CPU seconds in evaluations........... : %f\n"
                                   "CPU seconds in direction computations : %f\n"
-                                  "CPU seconds in line searches......... : %f\n",
+                                  "CPU seconds in line searches......... : %f\n"
+                                  "\n"
+                                  "Wall seconds......................... : %f\n"
+                                  "Wall seconds in evaluations.......... : %f\n"
+                                  "Wall seconds in direction computations: %f\n"
+                                  "Wall seconds in line searches........ : %f\n",
                    current_iterate_->objective(),
                    current_iterate_->objectiveUnscaled(),
                    iteration_counter_,
                    total_inner_iteration_counter_,
                    total_qp_iteration_counter_,
-                   function_counter_,
-                   gradient_counter_,
+                   function_counter_.load(),
+                   gradient_counter_.load(),
                    (end_time_ - start_time_) / (double)CLOCKS_PER_SEC,
-                   evaluation_time_ / (double)CLOCKS_PER_SEC,
+                   evaluation_time_.load() / (double)CLOCKS_PER_SEC,
                    direction_computation_time_ / (double)CLOCKS_PER_SEC,
-                   line_search_time_ / (double)CLOCKS_PER_SEC);
+                   line_search_time_ / (double)CLOCKS_PER_SEC,
+                   end_wall_time_ - start_wall_time_,
+                   evaluation_wall_time_.load(),
+                   direction_computation_wall_time_,
+                   line_search_wall_time_);
+
+  // Print bundle compressor footer
+  if (bundle_compressor_.enabled()) {
+    reporter->printf(R_NL, R_BASIC, "\n"
+                                    "Bundle entries merged................ : %d\n",
+                     bundle_compressor_.mergeCounter());
+  }
+
+  // Print evaluation cache footer
+  if (evaluation_cache_.capacity() > 0) {
+    reporter->printf(R_NL, R_BASIC, "\n"
+                                    "Evaluation cache lookups............. : %d\n"
+                                    "Evaluation cache hit rate............ : %f\n",
+                     evaluation_cache_.lookupCounter(),
+                     evaluation_cache_.hitRate());
+  }
+
+  // Print memory pool footer
+  if (memory_pool_) {
+    reporter->printf(R_NL, R_BASIC, "\n"
+                                    "Memory pool allocations.............. : %d\n"
+                                    "Memory pool reuses................... : %d\n",
+                     memory_pool_->allocationCounter(),
+                     memory_pool_->reuseCounter());
+  }
 
 } // end printFooter
 
@@ -468,8 +618,9 @@ void Quantities::printFooter(const Reporter* reporter)
 void Quantities::finalize()
 {
 
-  // Set end time
+  // Set end times
   end_time_ = clock();
+  end_wall_time_ = currentWallTime();
 
 } // end finalize
 
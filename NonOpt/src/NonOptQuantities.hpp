@@ -7,13 +7,19 @@
 #ifndef __NONOPTITERATIONQUANTITIES_HPP__
 #define __NONOPTITERATIONQUANTITIES_HPP__
 
+#include <atomic>
+#include <chrono>
 #include <ctime>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "NonOptBundleCompressor.hpp"
+#include "NonOptEvaluationCache.hpp"
+#include "NonOptMemoryPool.hpp"
 #include "NonOptOptions.hpp"
 #include "NonOptPoint.hpp"
+#include "NonOptPointSet.hpp"
 #include "NonOptProblem.hpp"
 #include "NonOptReporter.hpp"
 #include "NonOptVector.hpp"
@@ -83,6 +89,11 @@ public:
    * \return indicator of whether to use initial scaling
    */
   inline bool const approximateHessianInitialScaling() const { return approximate_hessian_initial_scaling_; };
+  /**
+   * Bundle compressor
+   * \return pointer to BundleCompressor of QP data passed by direction computation
+   */
+  inline BundleCompressor* bundleCompressor() { return &bundle_compressor_; };
   /**
    * CPU time limit
    * \return CPU time limit
@@ -93,6 +104,11 @@ public:
    * \return pointer to Point representing current iterate
    */
   inline std::shared_ptr<Point> currentIterate() { return current_iterate_; };
+  /**
+   * Current wall clock time
+   * \return seconds on monotonic wall clock (only differences between values are meaningful)
+   */
+  inline double const currentWallTime() const { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); };
   /**
    * Direction
    * \return pointer to Vector representing search direction
@@ -108,21 +124,41 @@ public:
    * \return direction computation time that was set
    */
   inline clock_t const directionComputationTime() const { return direction_computation_time_; };
+  /**
+   * Direction computation wall time
+   * \return direction computation wall clock seconds that were set
+   */
+  inline double const directionComputationWallTime() const { return direction_computation_wall_time_; };
   /**
    * End time
    * \return end time that was set
    */
   inline clock_t const endTime() const { return end_time_; };
+  /**
+   * End wall time
+   * \return end wall clock time that was set
+   */
+  inline double const endWallTime() const { return end_wall_time_; };
   /**
    * Evaluate function with gradient indicator
    * \return indicator of whether to evaluate function with gradient
    */
   inline bool const evaluateFunctionWithGradient() const { return evaluate_function_with_gradient_; };
+  /**
+   * Evaluation cache
+   * \return pointer to EvaluationCache of problem function values
+   */
+  inline EvaluationCache* evaluationCache() { return &evaluation_cache_; };
   /**
    * Evaluation time
    * \return problem function evaluation time that was set
    */
   inline clock_t const evaluationTime() const { return evaluation_time_; };
+  /**
+   * Evaluation wall time
+   * \return problem function evaluation wall clock seconds that were set
+   */
+  inline double const evaluationWallTime() const { return evaluation_wall_time_; };
   /**
    * Function evaluation counter
    * \return function evaluations performed so far
@@ -143,6 +179,24 @@ public:
    * \return gradient evaluation limit
    */
   inline int const gradientEvaluationLimit() const { return gradient_evaluation_limit_; };
+  /**
+   * Gradient sparsity threshold
+   * \return fraction of number of variables below which gradients are treated as sparse
+   */
+  inline double const gradientSparsityThreshold() const { return gradient_sparsity_threshold_; };
+  /**
+   * Sparse gradient index buffer
+   * (Retained across evaluations, so only grows.  Used on the main thread only.)
+   * \param[in] n is number of entries required
+   * \return pointer to integer array with space for at least n entries
+   */
+  inline int* sparseGradientIndices(int n)
+  {
+    if ((int)sparse_gradient_indices_.size() < n) {
+      sparse_gradient_indices_.resize(n);
+    }
+    return sparse_gradient_indices_.data();
+  };
   /**
    * Inexact termination factor
    * \return current inexact termination factor
@@ -178,6 +232,16 @@ public:
    * \return line search time that was set
    */
   inline clock_t const lineSearchTime() const { return line_search_time_; };
+  /**
+   * Line search wall time
+   * \return line search wall clock seconds that were set
+   */
+  inline double const lineSearchWallTime() const { return line_search_wall_time_; };
+  /**
+   * Memory pool
+   * \return pointer to MemoryPool from which Points and Vectors are drawn (null if none)
+   */
+  inline std::shared_ptr<MemoryPool> memoryPool() { return memory_pool_; };
   /**
    * Get problem size
    * \return number of variables
@@ -187,7 +251,7 @@ public:
    * Get point set
    * \return pointer to vector of pointers to Points representing current point set
    */
-  inline std::shared_ptr<std::vector<std::shared_ptr<Point>>> pointSet() { return point_set_; };
+  inline std::shared_ptr<PointSet> pointSet() { return point_set_; };
   /**
    * QP iteration counter
    * \return QP iterations performed so far (during current iteration)
@@ -203,6 +267,11 @@ public:
    * \return start time that was set
    */
   inline clock_t const startTime() const { return start_time_; };
+  /**
+   * Start wall time
+   * \return start wall clock time that was set
+   */
+  inline double const startWallTime() const { return start_wall_time_; };
   /**
    * Stationarity radius
    * \return current stationarity radius
@@ -238,6 +307,11 @@ public:
    * \return current trust region radius
    */
   inline double const trustRegionRadius() const { return trust_region_radius_; };
+  /**
+   * Wall time limit
+   * \return wall clock time limit
+   */
+  inline double const wallTimeLimit() const { return wall_time_limit_; };
   //@}
 
   /** @name Set methods */
@@ -286,16 +360,31 @@ public:
    * \param[in] direction_computation_time is amount to add to total direction computation time
    */
   inline void incrementDirectionComputationTime(clock_t direction_computation_time) { direction_computation_time_ += direction_computation_time; };
+  /**
+   * Increment direction computation wall time
+   * \param[in] direction_computation_wall_time is amount to add to total direction computation wall clock seconds
+   */
+  inline void incrementDirectionComputationWallTime(double direction_computation_wall_time) { direction_computation_wall_time_ += direction_computation_wall_time; };
   /**
    * Increment evaluation time
    * \param[in] evaluation_time is amount to add to total problem function evaluation time
    */
   inline void incrementEvaluationTime(clock_t evaluation_time) { evaluation_time_ += evaluation_time; };
+  /**
+   * Increment evaluation wall time
+   * \param[in] evaluation_wall_time is amount to add to total problem function evaluation wall clock seconds
+   */
+  void incrementEvaluationWallTime(double evaluation_wall_time);
   /**
    * Increment line search time
    * \param[in] line_search_time is amount to add to total line search time
    */
   inline void incrementLineSearchTime(clock_t line_search_time) { line_search_time_ += line_search_time; };
+  /**
+   * Increment line search wall time
+   * \param[in] line_search_wall_time is amount to add to total line search wall clock seconds
+   */
+  inline void incrementLineSearchWallTime(double line_search_wall_time) { line_search_wall_time_ += line_search_wall_time; };
   /**
    * Increment function evaluation counter
    */
@@ -398,20 +487,31 @@ private:
 
   /** @name Private members */
   //@{
+  /**
+   * Evaluation counters and time are atomic since evaluations may be performed by worker threads
+   */
+  std::atomic<clock_t> evaluation_time_;
+  std::atomic<double> evaluation_wall_time_;
+  std::atomic<int> function_counter_;
+  std::atomic<int> gradient_counter_;
+  /**
+   * Other members
+   */
   clock_t direction_computation_time_;
   clock_t end_time_;
-  clock_t evaluation_time_;
   clock_t line_search_time_;
   clock_t start_time_;
+  double direction_computation_wall_time_;
+  double end_wall_time_;
+  double line_search_wall_time_;
+  double start_wall_time_;
   double inexact_termination_factor_;
   double iterate_norm_initial_;
   double stationarity_radius_;
   double stepsize_;
   double trust_region_radius_;
-  int function_counter_;
-  int gradient_counter_;
   int iteration_counter_;
-  int inner_iteration_counter_;
+  std::atomic<int> inner_iteration_counter_; /**< Atomic since it may be read by a QP solve on a worker thread */
   int number_of_variables_;
   int qp_iteration_counter_;
   int total_inner_iteration_counter_;
@@ -420,14 +520,21 @@ private:
   std::shared_ptr<Point> trial_iterate_;
   std::shared_ptr<Vector> direction_;
   std::shared_ptr<Vector> direction_termination_;
-  std::shared_ptr<std::vector<std::shared_ptr<Point>>> point_set_;
+  std::shared_ptr<PointSet> point_set_;
+  BundleCompressor bundle_compressor_;
+  EvaluationCache evaluation_cache_;
+  std::shared_ptr<MemoryPool> memory_pool_;
+  std::vector<int> sparse_gradient_indices_;
   //@}
 
   /** @name Private members (options) */
   //@{
   bool approximate_hessian_initial_scaling_;
+  bool bundle_compression_;
   bool evaluate_function_with_gradient_;
+  double bundle_compression_tolerance_;
   double cpu_time_limit_;
+  double gradient_sparsity_threshold_;
   double inexact_termination_factor_initial_;
   double inexact_termination_update_factor_;
   double inexact_termination_update_stepsize_threshold_;
@@ -440,9 +547,12 @@ private:
   double trust_region_radius_initialization_factor_;
   double trust_region_radius_initialization_minimum_;
   double trust_region_radius_update_factor_;
+  double wall_time_limit_;
+  int evaluation_cache_size_;
   int function_evaluation_limit_;
   int gradient_evaluation_limit_;
   int iteration_limit_;
+  int memory_pool_size_;
   //@}
 
 }; // end Quantities
@@ -38,6 +38,11 @@ public:
   /** @name Set methods */
   //@{
   inline void resetSeed() { generator.seed(0); };
+  /**
+   * Reset seed to given value (e.g., to set up independent per-thread streams)
+   * \param[in] seed is new seed value
+   */
+  inline void resetSeed(unsigned int seed) { generator.seed(seed); };
   //@}
 
   /** @name Generate methods */
@@ -51,6 +56,15 @@ public:
     std::normal_distribution<double> distribution(0.0, 1.0);
     return distribution(generator);
   };
+  /**
+   * Generate uniformly distributed value
+   * \return double value from uniform distribution over [0,1)
+   */
+  double generateUniform()
+  {
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    return distribution(generator);
+  };
   //@}
 
 private:
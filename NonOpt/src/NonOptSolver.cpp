@@ -201,6 +201,9 @@ void NonOptSolver::optimize(const std::shared_ptr<Problem> problem)
       if ((clock() - quantities_.startTime()) / (double)CLOCKS_PER_SEC >= quantities_.cpuTimeLimit()) {
         THROW_EXCEPTION(NONOPT_CPU_TIME_LIMIT_EXCEPTION, "CPU time limit has been reached.");
       }
+      if (quantities_.currentWallTime() - quantities_.startWallTime() >= quantities_.wallTimeLimit()) {
+        THROW_EXCEPTION(NONOPT_WALL_TIME_LIMIT_EXCEPTION, "Wall time limit has been reached.");
+      }
       if (quantities_.currentIterate()->vector()->norm2() >= quantities_.iterateNormTolerance() * fmax(1.0, quantities_.iterateNormInitial())) {
         THROW_EXCEPTION(NONOPT_ITERATE_NORM_LIMIT_EXCEPTION, "Iterates appear to be diverging.");
       }
@@ -213,6 +216,9 @@ void NonOptSolver::optimize(const std::shared_ptr<Problem> problem)
         THROW_EXCEPTION(NONOPT_DERIVATIVE_CHECKER_FAILURE_EXCEPTION, "Derivative checker failed.");
       }
 
+      // Start termination checks that may run asynchronously (concurrently with direction computation)
+      strategies_.termination()->startConditions(&options_, &quantities_, &reporter_, &strategies_);
+
       // Compute direction
       strategies_.directionComputation()->computeDirection(&options_, &quantities_, &reporter_, &strategies_);
 
@@ -301,6 +307,8 @@ void NonOptSolver::optimize(const std::shared_ptr<Problem> problem)
     setStatus(NONOPT_OBJECTIVE_TOLERANCE);
   } catch (NONOPT_CPU_TIME_LIMIT_EXCEPTION& exec) {
     setStatus(NONOPT_CPU_TIME_LIMIT);
+  } catch (NONOPT_WALL_TIME_LIMIT_EXCEPTION& exec) {
+    setStatus(NONOPT_WALL_TIME_LIMIT);
   } catch (NONOPT_ITERATE_NORM_LIMIT_EXCEPTION& exec) {
     setStatus(NONOPT_ITERATE_NORM_LIMIT);
   } catch (NONOPT_ITERATION_LIMIT_EXCEPTION& exec) {
@@ -337,6 +345,9 @@ void NonOptSolver::optimize(const std::shared_ptr<Problem> problem)
     setStatus(NONOPT_VECTOR_ASSERT_FAILURE);
   }
 
+  // Wait for termination checks running asynchronously (e.g., if exception thrown during direction computation)
+  strategies_.termination()->joinConditions();
+
   // Print end of line
   reporter_.printf(R_NL, R_PER_ITERATION, "\n");
 
@@ -387,6 +398,9 @@ void NonOptSolver::printFooter()
   case NONOPT_CPU_TIME_LIMIT:
     reporter_.printf(R_NL, R_BASIC, "CPU time limit reached.");
     break;
+  case NONOPT_WALL_TIME_LIMIT:
+    reporter_.printf(R_NL, R_BASIC, "Wall time limit reached.");
+    break;
   case NONOPT_ITERATE_NORM_LIMIT:
     reporter_.printf(R_NL, R_BASIC, "Iterates seem to be diverging.");
     break;
@@ -108,6 +108,21 @@ public:
    * \return seconds between start and end time not including problem function evaluation time
    */
   inline double const timeNonOpt() const { return (quantities_.endTime() - quantities_.startTime() - quantities_.evaluationTime()) / (double)CLOCKS_PER_SEC; };
+  /**
+   * Get wall time
+   * \return wall clock seconds between start and end wall time
+   */
+  inline double const wallTime() const { return quantities_.endWallTime() - quantities_.startWallTime(); };
+  /**
+   * Get wall time in evaluations
+   * \return wall clock seconds to perform problem function evaluations
+   */
+  inline double const wallTimeEvaluations() const { return quantities_.evaluationWallTime(); };
+  /**
+   * Get wall time in NonOpt
+   * \return wall clock seconds between start and end wall time not including problem function evaluation wall time
+   */
+  inline double const wallTimeNonOpt() const { return quantities_.endWallTime() - quantities_.startWallTime() - quantities_.evaluationWallTime(); };
   /**
    * Get status
    * \return current status of algorithm
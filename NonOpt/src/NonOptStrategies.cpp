@@ -15,8 +15,10 @@
 #include "NonOptLineSearchWeakWolfe.hpp"
 #include "NonOptPointSetUpdateProximity.hpp"
 #include "NonOptQPSolverDualActiveSet.hpp"
+#include "NonOptQPSolverFISTA.hpp"
 #include "NonOptSymmetricMatrixDense.hpp"
 #include "NonOptSymmetricMatrixLimitedMemory.hpp"
+#include "NonOptSymmetricMatrixPartitioned.hpp"
 #include "NonOptTerminationBasic.hpp"
 #include "NonOptTerminationSecondQP.hpp"
 
@@ -103,6 +105,8 @@ void Strategies::addOptions(Options* options)
   std::shared_ptr<QPSolver> qp_solver;
   qp_solver = std::make_shared<QPSolverDualActiveSet>();
   qp_solver->addOptions(options);
+  qp_solver = std::make_shared<QPSolverFISTA>();
+  qp_solver->addOptions(options);
   // ADD NEW QP SOLVER STRATEGIES HERE //
 
   // Add options for symmetric matrix strategies
@@ -111,6 +115,8 @@ void Strategies::addOptions(Options* options)
   symmetric_matrix->addOptions(options);
   symmetric_matrix = std::make_shared<SymmetricMatrixLimitedMemory>();
   symmetric_matrix->addOptions(options);
+  symmetric_matrix = std::make_shared<SymmetricMatrixPartitioned>();
+  symmetric_matrix->addOptions(options);
   // ADD NEW SYMMETRIC MATRIX STRATEGIES HERE //
 
   // Add options for termination strategies
@@ -204,6 +210,10 @@ void Strategies::setOptions(Options* options)
     qp_solver_ = std::make_shared<QPSolverDualActiveSet>();
     qp_solver_termination_ = std::make_shared<QPSolverDualActiveSet>();
   }
+  else if (qp_solver_name.compare("FISTA") == 0) {
+    qp_solver_ = std::make_shared<QPSolverFISTA>();
+    qp_solver_termination_ = std::make_shared<QPSolverFISTA>();
+  }
   else {
     qp_solver_ = std::make_shared<QPSolverDualActiveSet>();
     qp_solver_termination_ = std::make_shared<QPSolverDualActiveSet>();
@@ -216,6 +226,9 @@ void Strategies::setOptions(Options* options)
   else if (symmetric_matrix_name.compare("LimitedMemory") == 0) {
     symmetric_matrix_ = std::make_shared<SymmetricMatrixLimitedMemory>();
   }
+  else if (symmetric_matrix_name.compare("Partitioned") == 0) {
+    symmetric_matrix_ = std::make_shared<SymmetricMatrixPartitioned>();
+  }
   else {
     symmetric_matrix_ = std::make_shared<SymmetricMatrixDense>();
   }
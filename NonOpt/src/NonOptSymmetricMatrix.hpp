@@ -42,7 +42,8 @@ public:
   /**
    * Constructor
    */
-  SymmetricMatrix(){};
+  SymmetricMatrix()
+    : modification_counter_(0){};
   //@}
 
   /** @name Destructor */
@@ -124,6 +125,15 @@ public:
    * \return inner product of vector with this vector
    */
   virtual double innerProductOfInverse(const Vector& vector) = 0;
+  /**
+   * Get inner products of symmetric matrix inverse with columns of matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store matrix'*inverse*matrix (column-major, number_of_columns squared)
+   */
+  virtual void innerProductsOfInverse(int number_of_columns,
+                                      double* matrix,
+                                      double* product) = 0;
   /**
    * Get product of symmetric matrix with vector
    * \param[in] vector is reference to a Vector
@@ -138,6 +148,20 @@ public:
    */
   virtual void matrixVectorProductOfInverse(const Vector& vector,
                                             Vector& product) = 0;
+  /**
+   * Get product of symmetric matrix inverse with matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store product values (column-major, same size as matrix)
+   */
+  virtual void matrixMatrixProductOfInverse(int number_of_columns,
+                                            double* matrix,
+                                            double* product) = 0;
+  /**
+   * Get modification counter
+   * \return number of times matrix has been modified (so that users may detect changes to a shared matrix)
+   */
+  inline int const modificationCounter() const { return modification_counter_; };
   /**
    * Get name of strategy
    * \return string with name of strategy
@@ -190,6 +214,14 @@ public:
   //@}
 
 protected:
+  /** @name Protected methods */
+  //@{
+  /**
+   * Increment modification counter (to be called by any method that modifies matrix)
+   */
+  inline void incrementModificationCounter() { modification_counter_++; };
+  //@}
+
   /** @name Protected members */
   //@{
   std::string type_; /**< Type of update */
@@ -212,7 +244,8 @@ private:
 
   /** @name Private members */
   //@{
-  SM_Status status_; /**< Termination status */
+  SM_Status status_;          /**< Termination status */
+  int modification_counter_; /**< Number of modifications */
   //@}
 
 }; // end SymmetricMatrix
@@ -24,6 +24,10 @@ SymmetricMatrixDense::~SymmetricMatrixDense()
     delete[] values_of_inverse_;
     values_of_inverse_ = nullptr;
   } // end if
+  if (factor_of_inverse_ != nullptr) {
+    delete[] factor_of_inverse_;
+    factor_of_inverse_ = nullptr;
+  } // end if
 
 } // end destructor
 
@@ -31,6 +35,15 @@ SymmetricMatrixDense::~SymmetricMatrixDense()
 void SymmetricMatrixDense::addOptions(Options* options)
 {
 
+  // Add bool options
+  options->addBoolOption("SMD_inverse_only",
+                         false,
+                         "Indicator for whether to store only the inverse, in packed form, in\n"
+                         "              which case products with and elements of the matrix are\n"
+                         "              computed on demand using a Cholesky factorization of the\n"
+                         "              inverse.  Halves (at least) the storage and update cost.\n"
+                         "Default     : false.");
+
   // Add double options
 
   // Add integer options
@@ -41,6 +54,9 @@ void SymmetricMatrixDense::addOptions(Options* options)
 void SymmetricMatrixDense::setOptions(Options* options)
 {
 
+  // Read bool options
+  options->valueAsBool("SMD_inverse_only", inverse_only_);
+
   // Read double options
 
   // Read integer options
@@ -71,6 +87,20 @@ void const SymmetricMatrixDense::column(int column_index,
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
   ASSERT_EXCEPTION(size_ == column.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column has incorrect length.");
 
+  // Check for inverse only
+  if (inverse_only_) {
+
+    // Set unit vector
+    column.setLength(size_);
+    column.set(column_index, 1.0);
+
+    // Solve with inverse
+    solveWithInverse(column);
+
+    return;
+
+  } // end if
+
   // Set inputs for BLASLAPACK
   int length = column_index + 1;
   int increment1 = size_;
@@ -99,6 +129,25 @@ void const SymmetricMatrixDense::columnOfInverse(int column_index,
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
   ASSERT_EXCEPTION(size_ == column.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column has incorrect length.");
 
+  // Check for inverse only
+  if (inverse_only_) {
+
+    // Set inputs for BLASLAPACK
+    int length = column_index + 1;
+    int increment = 1;
+
+    // Copy first column_index+1 elements (contiguous in packed column)
+    dcopy_(&length, &values_of_inverse_[packed_(0, column_index)], &increment, column.valuesModifiable(), &increment);
+
+    // Copy remaining size_-(column_index+1) elements (from subsequent packed columns)
+    for (int i = column_index + 1; i < size_; i++) {
+      column.set(i, values_of_inverse_[packed_(column_index, i)]);
+    }
+
+    return;
+
+  } // end if
+
   // Set inputs for BLASLAPACK
   int length = column_index + 1;
   int increment1 = size_;
@@ -128,6 +177,18 @@ double const SymmetricMatrixDense::element(int row_index,
   ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
 
+  // Check for inverse only
+  if (inverse_only_) {
+
+    // Compute column
+    Vector column(size_);
+    this->column(column_index, column);
+
+    // Return element
+    return column.values()[row_index];
+
+  } // end if
+
   // Return element
   if (row_index > column_index) {
     int temp = row_index;
@@ -155,6 +216,9 @@ double const SymmetricMatrixDense::elementOfInverse(int row_index,
     row_index = column_index;
     column_index = temp;
   } // end if
+  if (inverse_only_) {
+    return values_of_inverse_[packed_(row_index, column_index)];
+  }
   return values_of_inverse_[row_index * size_ + column_index];
 
 } // end elementOfInverse
@@ -176,7 +240,13 @@ double SymmetricMatrixDense::innerProduct(const Vector& vector)
   double scale2 = 0.0;
 
   // Compute matrix-vector product
-  dsymv_(&upper_lower, &size_, &scale1, values_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  if (inverse_only_) {
+    product.copy(vector);
+    solveWithInverse(product);
+  }
+  else {
+    dsymv_(&upper_lower, &size_, &scale1, values_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  }
 
   // Return product
   return ddot_(&size_, product.values(), &increment, vector.values(), &increment);
@@ -200,13 +270,51 @@ double SymmetricMatrixDense::innerProductOfInverse(const Vector& vector)
   double scale2 = 0.0;
 
   // Compute matrix-vector product
-  dsymv_(&upper_lower, &size_, &scale1, values_of_inverse_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  if (inverse_only_) {
+    upper_lower = 'U';
+    dspmv_(&upper_lower, &size_, &scale1, values_of_inverse_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  }
+  else {
+    dsymv_(&upper_lower, &size_, &scale1, values_of_inverse_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  }
 
   // Return product
   return ddot_(&size_, product.values(), &increment, vector.values(), &increment);
 
 } // end innerProductOfInverse
 
+// Inner products of inverse
+void SymmetricMatrixDense::innerProductsOfInverse(int number_of_columns,
+                                                  double* matrix,
+                                                  double* product)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(number_of_columns >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Number of columns is negative.");
+
+  // Declare temporary matrix
+  double* Wmatrix = new double[size_ * number_of_columns];
+
+  // Compute matrix-matrix product
+  matrixMatrixProductOfInverse(number_of_columns, matrix, Wmatrix);
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'T';
+  char no_transpose = 'N';
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Compute inner products
+  dgemm_(&transpose, &no_transpose, &number_of_columns, &number_of_columns, &size_, &one, matrix, &size_, Wmatrix, &size_, &zero, product, &number_of_columns);
+
+  // Delete temporary matrix
+  if (Wmatrix != nullptr) {
+    delete[] Wmatrix;
+    Wmatrix = nullptr;
+  } // end if
+
+} // end innerProductsOfInverse
+
 // Matrix-vector product
 void SymmetricMatrixDense::matrixVectorProduct(const Vector& vector,
                                                Vector& product)
@@ -223,7 +331,13 @@ void SymmetricMatrixDense::matrixVectorProduct(const Vector& vector,
   double scale2 = 0.0;
 
   // Compute matrix-vector product
-  dsymv_(&upper_lower, &size_, &scale1, values_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  if (inverse_only_) {
+    product.copy(vector);
+    solveWithInverse(product);
+  }
+  else {
+    dsymv_(&upper_lower, &size_, &scale1, values_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  }
 
 } // end matrixVectorProduct
 
@@ -243,10 +357,45 @@ void SymmetricMatrixDense::matrixVectorProductOfInverse(const Vector& vector,
   double scale2 = 0.0;
 
   // Compute matrix-vector product
-  dsymv_(&upper_lower, &size_, &scale1, values_of_inverse_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  if (inverse_only_) {
+    upper_lower = 'U';
+    dspmv_(&upper_lower, &size_, &scale1, values_of_inverse_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  }
+  else {
+    dsymv_(&upper_lower, &size_, &scale1, values_of_inverse_, &size_, vector.values(), &increment, &scale2, product.valuesModifiable(), &increment);
+  }
 
 } // end matrixVectorProductOfInverse
 
+// Matrix-matrix product of inverse
+void SymmetricMatrixDense::matrixMatrixProductOfInverse(int number_of_columns,
+                                                        double* matrix,
+                                                        double* product)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(number_of_columns >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Number of columns is negative.");
+
+  // Set inputs for BLASLAPACK
+  char side = 'L';
+  char upper_lower = 'L';
+  double scale1 = 1.0;
+  int increment = 1;
+  double scale2 = 0.0;
+
+  // Compute matrix-matrix product (column by column if packed)
+  if (inverse_only_) {
+    upper_lower = 'U';
+    for (int j = 0; j < number_of_columns; j++) {
+      dspmv_(&upper_lower, &size_, &scale1, values_of_inverse_, &matrix[j * size_], &increment, &scale2, &product[j * size_], &increment);
+    }
+  } // end if
+  else {
+    dsymm_(&side, &upper_lower, &size_, &number_of_columns, &scale1, values_of_inverse_, &size_, matrix, &size_, &scale2, product, &size_);
+  }
+
+} // end matrixMatrixProductOfInverse
+
 // Set as diagonal matrix
 void SymmetricMatrixDense::setAsDiagonal(int size,
                                          double value)
@@ -255,8 +404,11 @@ void SymmetricMatrixDense::setAsDiagonal(int size,
   // Assert
   ASSERT_EXCEPTION(value > 0.0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Value is nonpositive.");
 
-  // Check current size
-  if (size_ != size) {
+  // Increment modification counter
+  incrementModificationCounter();
+
+  // Check current size and storage
+  if (size_ != size || (values_ == nullptr) != inverse_only_) {
 
     // Delete previous array, if exists
     if (values_ != nullptr) {
@@ -267,15 +419,21 @@ void SymmetricMatrixDense::setAsDiagonal(int size,
       delete[] values_of_inverse_;
       values_of_inverse_ = nullptr;
     } // end if
+    if (factor_of_inverse_ != nullptr) {
+      delete[] factor_of_inverse_;
+      factor_of_inverse_ = nullptr;
+    } // end if
 
     // Set size
     size_ = size;
 
     // Set length
-    length_ = size * size;
+    length_ = (inverse_only_ ? size * (size + 1) / 2 : size * size);
 
     // Allocate arrays
-    values_ = new double[length_];
+    if (!inverse_only_) {
+      values_ = new double[length_];
+    }
     values_of_inverse_ = new double[length_];
 
   } // end if
@@ -286,14 +444,23 @@ void SymmetricMatrixDense::setAsDiagonal(int size,
   int increment2 = 1;
 
   // Initialize values
-  dcopy_(&length_, &zero_value, &increment1, values_, &increment2);
+  if (!inverse_only_) {
+    dcopy_(&length_, &zero_value, &increment1, values_, &increment2);
+  }
   dcopy_(&length_, &zero_value, &increment1, values_of_inverse_, &increment2);
 
   // Set diagonal entries
-  for (int i = 0; i < length_; i = i + size_ + 1) {
-    values_[i] = value;
-    values_of_inverse_[i] = 1.0 / value;
-  } // end for
+  if (inverse_only_) {
+    for (int i = 0; i < size_; i++) {
+      values_of_inverse_[packed_(i, i)] = 1.0 / value;
+    }
+  } // end if
+  else {
+    for (int i = 0; i < length_; i = i + size_ + 1) {
+      values_[i] = value;
+      values_of_inverse_[i] = 1.0 / value;
+    } // end for
+  }   // end else
 
 } // end setAsDiagonal
 
@@ -306,12 +473,25 @@ void SymmetricMatrixDense::update(const Vector& s,
   ASSERT_EXCEPTION(size_ == s.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector s has incorrect length.");
   ASSERT_EXCEPTION(size_ == y.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector y has incorrect length.");
 
+  // Increment modification counter
+  incrementModificationCounter();
+
   // Call appropriate update method
   if (type_.compare("BFGS") == 0) {
-    updateBFGS(s, y);
+    if (inverse_only_) {
+      updateBFGSOfInverse(s, y);
+    }
+    else {
+      updateBFGS(s, y);
+    }
   }
   else if (type_.compare("DFP") == 0) {
-    updateDFP(s, y);
+    if (inverse_only_) {
+      updateDFPOfInverse(s, y);
+    }
+    else {
+      updateDFP(s, y);
+    }
   }
 
 } // end update
@@ -444,11 +624,154 @@ void SymmetricMatrixDense::updateDFP(const Vector& s,
 
 } // end updateDFP
 
+// Symmetric update of inverse
+void SymmetricMatrixDense::updateBFGSOfInverse(const Vector& s,
+                                               const Vector& y)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(size_ == s.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector s has incorrect length.");
+  ASSERT_EXCEPTION(size_ == y.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector y has incorrect length.");
+
+  // Declare temporary vector
+  double* Wy = new double[size_];
+
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'U';
+  double scale1 = 1.0;
+  int increment = 1;
+  double scale2 = 0.0;
+
+  // Compute matrix-vector product
+  dspmv_(&upper_lower, &size_, &scale1, values_of_inverse_, y.values(), &increment, &scale2, Wy, &increment);
+
+  // Declare scalars
+  double yWy = ddot_(&size_, y.values(), &increment, Wy, &increment);
+  double sy = ddot_(&size_, y.values(), &increment, s.values(), &increment);
+
+  // Set scale
+  double scale = (1.0 + yWy / sy) / sy;
+
+  // Perform symmetric rank-1 update (to add (1+yWy/sy)/sy*s*s')
+  dspr_(&upper_lower, &size_, &scale, s.values(), &increment, values_of_inverse_);
+
+  // Set input for BLASLAPACK
+  scale = -(1.0 / sy);
+
+  // Perform symmetric rank-2 update (to add -(1/sy)*s*Wy'-(1/sy)*Wy*s')
+  dspr2_(&upper_lower, &size_, &scale, s.values(), &increment, Wy, &increment, values_of_inverse_);
+
+  // Delete intermediate vector
+  if (Wy != nullptr) {
+    delete[] Wy;
+    Wy = nullptr;
+  } // end if
+
+} // end updateBFGSOfInverse
+
+// Symmetric update of inverse
+void SymmetricMatrixDense::updateDFPOfInverse(const Vector& s,
+                                              const Vector& y)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(size_ == s.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector s has incorrect length.");
+  ASSERT_EXCEPTION(size_ == y.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector y has incorrect length.");
+
+  // Declare temporary vector
+  double* Wy = new double[size_];
+
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'U';
+  double scale1 = 1.0;
+  int increment = 1;
+  double scale2 = 0.0;
+
+  // Compute matrix-vector product
+  dspmv_(&upper_lower, &size_, &scale1, values_of_inverse_, y.values(), &increment, &scale2, Wy, &increment);
+
+  // Declare scalars
+  double yWy = ddot_(&size_, y.values(), &increment, Wy, &increment);
+  double sy = ddot_(&size_, y.values(), &increment, s.values(), &increment);
+
+  // Set scale
+  double scale = -1.0 / yWy;
+
+  // Perform symmetric rank-1 update (to add -W*y*y'*W/(y'*W*y))
+  dspr_(&upper_lower, &size_, &scale, Wy, &increment, values_of_inverse_);
+
+  // Set scale
+  scale = 1.0 / sy;
+
+  // Perform symmetric rank-1 update (to add s*s'/(s'*y))
+  dspr_(&upper_lower, &size_, &scale, s.values(), &increment, values_of_inverse_);
+
+  // Delete intermediate vector
+  if (Wy != nullptr) {
+    delete[] Wy;
+    Wy = nullptr;
+  } // end if
+
+} // end updateDFPOfInverse
+
+// Solve with inverse
+void SymmetricMatrixDense::solveWithInverse(Vector& vector)
+{
+
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'U';
+  int increment = 1;
+  int flag = 0;
+
+  // Check for factorization of current inverse
+  if (factor_of_inverse_ == nullptr || factor_modification_counter_ != modificationCounter()) {
+
+    // Allocate factor, if needed
+    if (factor_of_inverse_ == nullptr) {
+      factor_of_inverse_ = new double[length_];
+    }
+
+    // Copy inverse
+    dcopy_(&length_, values_of_inverse_, &increment, factor_of_inverse_, &increment);
+
+    // Compute Cholesky factorization
+    dpptrf_(&upper_lower, &size_, factor_of_inverse_, &flag);
+
+    // Assert
+    ASSERT_EXCEPTION(flag == 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Inverse is not positive definite.");
+
+    // Set modification counter
+    factor_modification_counter_ = modificationCounter();
+
+  } // end if
+
+  // Solve using factorization
+  dpptrs_(&upper_lower, &size_, &increment, factor_of_inverse_, vector.valuesModifiable(), &size_, &flag);
+
+} // end solveWithInverse
+
 // Print
 void SymmetricMatrixDense::print(const Reporter* reporter,
                                  std::string name) const
 {
 
+  // Check for inverse only
+  if (inverse_only_) {
+
+    // Print elements of symmetric matrix inverse
+    reporter->printf(R_NL, R_BASIC, "Matrix inverse:\n");
+    reporter->printf(R_QP, R_BASIC, "Matrix inverse:\n");
+    for (int i = 0; i < size_; i++) {
+      for (int j = i; j < size_; j++) {
+        reporter->printf(R_NL, R_BASIC, "%s[%6d][%6d]=%+23.16e\n", name.c_str(), i, j, values_of_inverse_[packed_(i, j)]);
+        reporter->printf(R_QP, R_BASIC, "%s[%6d][%6d]=%+23.16e\n", name.c_str(), i, j, values_of_inverse_[packed_(i, j)]);
+      } // end for
+    }   // end for
+
+    return;
+
+  } // end if
+
   // Print elements of symmetric matrix
   reporter->printf(R_NL, R_BASIC, "Matrix:\n");
   reporter->printf(R_QP, R_BASIC, "Matrix:\n");
@@ -14,6 +14,10 @@ namespace NonOpt
 
 /**
  * SymmetricMatrixDense class
+ * (By default, the matrix and its inverse are both stored in full arrays.  If only the
+ *  inverse is stored, then it is stored in packed form, i.e., the upper triangle by
+ *  columns, and products with and elements of the matrix are computed on demand using a
+ *  Cholesky factorization of the inverse, which is recomputed after any modification.)
  */
 class SymmetricMatrixDense : public SymmetricMatrix
 {
@@ -25,9 +29,13 @@ public:
    * Construct SymmetricMatrixDense
    */
   SymmetricMatrixDense()
-    : size_(-1),
+    : inverse_only_(false),
+      size_(-1),
+      length_(0),
+      factor_modification_counter_(-1),
       values_(nullptr),
-      values_of_inverse_(nullptr){};
+      values_of_inverse_(nullptr),
+      factor_of_inverse_(nullptr){};
   //@}
 
   /** @name Destructor */
@@ -109,6 +117,15 @@ public:
    * \return inner product of vector with this vector
    */
   double innerProductOfInverse(const Vector& vector);
+  /**
+   * Get inner products of symmetric matrix inverse with columns of matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store matrix'*inverse*matrix (column-major, number_of_columns squared)
+   */
+  void innerProductsOfInverse(int number_of_columns,
+                              double* matrix,
+                              double* product);
   /**
    * Get product of symmetric matrix with vector
    * \param[in] vector is reference to a Vector
@@ -123,6 +140,15 @@ public:
    */
   void matrixVectorProductOfInverse(const Vector& vector,
                                     Vector& product);
+  /**
+   * Get product of symmetric matrix inverse with matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store product values (column-major, same size as matrix)
+   */
+  void matrixMatrixProductOfInverse(int number_of_columns,
+                                    double* matrix,
+                                    double* product);
   /**
    * Get name of strategy
    * \return string with name of strategy
@@ -135,24 +161,32 @@ public:
   inline int const size() const { return size_; };
   /**
    * Get values (const) of symmetric matrix
-   * \return is pointer to array of values
+   * \return is pointer to array of values (nullptr if only inverse is stored)
    */
   inline double* const values() const { return values_; };
   /**
    * Get values (const) of symmetric matrix inverse
-   * \return is pointer to array of values
+   * \return is pointer to array of values (packed if only inverse is stored)
    */
   inline double* const valuesOfInverse() const { return values_of_inverse_; };
   /**
    * Get values (modifiable) of symmetric matrix
-   * \return is pointer to array of values (to allow modification of array)
+   * \return is pointer to array of values (to allow modification of array; nullptr if only inverse is stored)
    */
-  inline double* valuesModifiable() { return values_; };
+  inline double* valuesModifiable()
+  {
+    incrementModificationCounter();
+    return values_;
+  };
   /**
    * Get values (modifiable) of symmetric matrix inverse
-   * \return is pointer to array of values (to allow modification of array)
+   * \return is pointer to array of values (to allow modification of array; packed if only inverse is stored)
    */
-  inline double* valuesOfInverseModifiable() { return values_of_inverse_; };
+  inline double* valuesOfInverseModifiable()
+  {
+    incrementModificationCounter();
+    return values_of_inverse_;
+  };
   //@}
 
   /** @name Modify methods */
@@ -201,10 +235,13 @@ private:
 
   /** @name Private members */
   //@{
-  int size_;                  /**< Number of rows and number of columns */
-  int length_;                /**< Number of rows *   number of columns */
-  double* values_;            /**< Double array */
-  double* values_of_inverse_; /**< Double array */
+  bool inverse_only_;               /**< Indicator for whether only inverse is stored */
+  int size_;                        /**< Number of rows and number of columns */
+  int length_;                      /**< Number of rows *   number of columns (or packed length) */
+  int factor_modification_counter_; /**< Modification counter when factor was computed */
+  double* values_;                  /**< Double array */
+  double* values_of_inverse_;       /**< Double array */
+  double* factor_of_inverse_;       /**< Double array (packed Cholesky factor of inverse) */
   //@}
 
   /** @name Private methods */
@@ -213,6 +250,15 @@ private:
                   const Vector& y);
   void updateDFP(const Vector& s,
                  const Vector& y);
+  void updateBFGSOfInverse(const Vector& s,
+                           const Vector& y);
+  void updateDFPOfInverse(const Vector& s,
+                          const Vector& y);
+  /**
+   * Solve with inverse, i.e., multiply by matrix, using Cholesky factorization of inverse
+   * \param[in,out] vector is Vector to be overwritten by product of matrix with it
+   */
+  void solveWithInverse(Vector& vector);
   //@}
 
   /** @name Indexing methods */
@@ -229,6 +275,14 @@ private:
    * \return column corresponding to array index i
    */
   inline int const col_(int i) const { return i % size_; };
+  /**
+   * Packed array index
+   * \param[in] row_index is row index number (at most column_index)
+   * \param[in] column_index is column index number
+   * \return packed array index corresponding to (row_index,column_index)
+   */
+  inline int const packed_(int row_index,
+                           int column_index) const { return row_index + column_index * (column_index + 1) / 2; };
   //@}
 
 }; // end SymmetricMatrixDense
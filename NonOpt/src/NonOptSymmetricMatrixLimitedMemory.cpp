@@ -17,22 +17,7 @@ SymmetricMatrixLimitedMemory::~SymmetricMatrixLimitedMemory()
 {
 
   // Delete arrays
-  if (compact_form_diagonal_ != nullptr) {
-    delete[] compact_form_diagonal_;
-    compact_form_diagonal_ = nullptr;
-  } // end if
-  if (compact_form_factorization_ != nullptr) {
-    delete[] compact_form_factorization_;
-    compact_form_factorization_ = nullptr;
-  } // end if
-  if (compact_form_inner_product_ != nullptr) {
-    delete[] compact_form_inner_product_;
-    compact_form_inner_product_ = nullptr;
-  } // end if
-  if (compact_form_lower_triangular_ != nullptr) {
-    delete[] compact_form_lower_triangular_;
-    compact_form_lower_triangular_ = nullptr;
-  } // end if
+  deleteArrays();
 
 } // end destructor
 
@@ -77,25 +62,6 @@ void SymmetricMatrixLimitedMemory::initialize(const Options* options,
   // Set as identity
   setAsDiagonal(quantities->numberOfVariables(), 1.0);
 
-  // Delete array, if it exists
-  if (compact_form_diagonal_ != nullptr) {
-    delete[] compact_form_diagonal_;
-    compact_form_diagonal_ = nullptr;
-  } // end if
-  if (compact_form_inner_product_ != nullptr) {
-    delete[] compact_form_inner_product_;
-    compact_form_inner_product_ = nullptr;
-  } // end if
-  if (compact_form_lower_triangular_ != nullptr) {
-    delete[] compact_form_lower_triangular_;
-    compact_form_lower_triangular_ = nullptr;
-  } // end if
-
-  // Allocate memory for compact form matrices
-  compact_form_diagonal_ = new double[history_];
-  compact_form_inner_product_ = new double[history_ * history_];
-  compact_form_lower_triangular_ = new double[history_ * history_];
-
 } // end initialize
 
 // Column
@@ -108,38 +74,20 @@ void const SymmetricMatrixLimitedMemory::column(int column_index,
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
   ASSERT_EXCEPTION(size_ == column.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column has incorrect length.");
 
-  // Initialize bool indicating column computed
-  bool column_computed = false;
-  int column_computed_index = -1;
-
-  // Loop over computed columns
-  for (int i = 0; i < (int)computed_column_indices_.size(); i++) {
-    if (computed_column_indices_[i] == column_index) {
-      column_computed = true;
-      column_computed_index = i;
-      break;
-    } // end if
-  }   // end for
+  // Find computed column
+  auto computed_column = computed_columns_.find(column_index);
 
   // Compute column
-  if (column_computed) {
-    column.copy(*computed_columns_[column_computed_index]);
+  if (computed_column != computed_columns_.end()) {
+    column.copy(*computed_column->second);
   }
   else {
 
-    // Create unit vector
-    Vector unit_vector(size_, 0.0);
-    unit_vector.set(column_index, 1.0);
-
-    // Perform matrix-vector product
-    matrixVectorProduct(unit_vector, column);
+    // Compute column with compact form (BFGS) or its inverse (DFP)
+    columnOfCompactForm(type_.compare("DFP") == 0, column_index, column);
 
     // Save column
-    std::shared_ptr<Vector> computed_column = column.makeNewCopy();
-
-    // Push to set
-    computed_columns_.push_back(computed_column);
-    computed_column_indices_.push_back(column_index);
+    computed_columns_[column_index] = column.makeNewCopy();
 
   } // end else
 
@@ -155,38 +103,20 @@ void const SymmetricMatrixLimitedMemory::columnOfInverse(int column_index,
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
   ASSERT_EXCEPTION(size_ == column.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column has incorrect length.");
 
-  // Initialize bool indicating column computed
-  bool column_computed = false;
-  int column_computed_index = -1;
-
-  // Loop over computed columns
-  for (int i = 0; i < (int)computed_column_indices_of_inverse_.size(); i++) {
-    if (computed_column_indices_of_inverse_[i] == column_index) {
-      column_computed = true;
-      column_computed_index = i;
-      break;
-    } // end if
-  }   // end for
+  // Find computed column
+  auto computed_column = computed_columns_of_inverse_.find(column_index);
 
   // Compute column
-  if (column_computed) {
-    column.copy(*computed_columns_of_inverse_[column_computed_index]);
+  if (computed_column != computed_columns_of_inverse_.end()) {
+    column.copy(*computed_column->second);
   }
   else {
 
-    // Create unit vector
-    Vector unit_vector(size_, 0.0);
-    unit_vector.set(column_index, 1.0);
-
-    // Perform matrix-vector product
-    matrixVectorProductOfInverse(unit_vector, column);
+    // Compute column with inverse of compact form (BFGS) or compact form (DFP)
+    columnOfCompactForm(type_.compare("BFGS") == 0, column_index, column);
 
     // Save column
-    std::shared_ptr<Vector> computed_column = column.makeNewCopy();
-
-    // Push to set
-    computed_columns_of_inverse_.push_back(computed_column);
-    computed_column_indices_of_inverse_.push_back(column_index);
+    computed_columns_of_inverse_[column_index] = column.makeNewCopy();
 
   } // end else
 
@@ -203,35 +133,18 @@ double const SymmetricMatrixLimitedMemory::element(int row_index,
   ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
 
-  // Initialize bool indicating element in a computed column
-  bool element_computed = false;
-
-  // Initialize element
-  double element_value = 0.0;
-
-  // Loop over computed columns
-  for (int i = 0; i < (int)computed_column_indices_.size(); i++) {
-    if (computed_column_indices_[i] == row_index) {
-      element_computed = true;
-      element_value = computed_columns_[i]->values()[column_index];
-      break;
-    } // end if
-    if (computed_column_indices_[i] == column_index) {
-      element_computed = true;
-      element_value = computed_columns_[i]->values()[row_index];
-      break;
-    } // end if
-  }   // end for
-
-  // Check if element already computed
-  if (!element_computed) {
-    Vector column_vector(size_);
-    column(column_index, column_vector);
-    element_value = column_vector.values()[row_index];
-  } // end if
+  // Check for element in a computed column
+  auto computed_column = computed_columns_.find(column_index);
+  if (computed_column != computed_columns_.end()) {
+    return computed_column->second->values()[row_index];
+  }
+  computed_column = computed_columns_.find(row_index);
+  if (computed_column != computed_columns_.end()) {
+    return computed_column->second->values()[column_index];
+  }
 
-  // Return element
-  return element_value;
+  // Return element of compact form (BFGS) or its inverse (DFP)
+  return elementOfCompactForm(type_.compare("DFP") == 0, row_index, column_index);
 
 } // end element
 
@@ -246,35 +159,18 @@ double const SymmetricMatrixLimitedMemory::elementOfInverse(int row_index,
   ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
   ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
 
-  // Initialize bool indicating element in a computed column
-  bool element_computed = false;
-
-  // Initialize element
-  double element_value = 0.0;
-
-  // Loop over computed columns
-  for (int i = 0; i < (int)computed_column_indices_of_inverse_.size(); i++) {
-    if (computed_column_indices_of_inverse_[i] == row_index) {
-      element_computed = true;
-      element_value = computed_columns_of_inverse_[i]->values()[column_index];
-      break;
-    } // end if
-    if (computed_column_indices_of_inverse_[i] == column_index) {
-      element_computed = true;
-      element_value = computed_columns_of_inverse_[i]->values()[row_index];
-      break;
-    } // end if
-  }   // end for
-
-  // Check of element already computed
-  if (!element_computed) {
-    Vector column_vector(size_);
-    columnOfInverse(column_index, column_vector);
-    element_value = column_vector.values()[row_index];
-  } // end if
+  // Check for element in a computed column
+  auto computed_column = computed_columns_of_inverse_.find(column_index);
+  if (computed_column != computed_columns_of_inverse_.end()) {
+    return computed_column->second->values()[row_index];
+  }
+  computed_column = computed_columns_of_inverse_.find(row_index);
+  if (computed_column != computed_columns_of_inverse_.end()) {
+    return computed_column->second->values()[column_index];
+  }
 
-  // Return element
-  return element_value;
+  // Return element of inverse of compact form (BFGS) or compact form (DFP)
+  return elementOfCompactForm(type_.compare("BFGS") == 0, row_index, column_index);
 
 } // end elementOfInverse
 
@@ -314,6 +210,40 @@ double SymmetricMatrixLimitedMemory::innerProductOfInverse(const Vector& vector)
 
 } // end innerProductOfInverse
 
+// Inner products of inverse
+void SymmetricMatrixLimitedMemory::innerProductsOfInverse(int number_of_columns,
+                                                          double* matrix,
+                                                          double* product)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(number_of_columns >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Number of columns is negative.");
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'T';
+  char no_transpose = 'N';
+  int m = pair_count_;
+  int length = 2 * m;
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Compute inner products with initial matrix inverse
+  double scale = scale_(type_.compare("BFGS") == 0);
+  dgemm_(&transpose, &no_transpose, &number_of_columns, &number_of_columns, &size_, &scale, matrix, &size_, matrix, &size_, &zero, product, &number_of_columns);
+
+  // Check for pairs in storage
+  if (m > 0 && number_of_columns > 0) {
+
+    // Compute products with pairs and coefficients, i.e., [S'G; Y'G] and C (BFGS)
+    double* products = productsOfCompactForm(type_.compare("BFGS") == 0, number_of_columns, matrix, true);
+
+    // Complete inner products (G'*W*G = scale*G'G + [S'G; Y'G]'*C for BFGS)
+    dgemm_(&transpose, &no_transpose, &number_of_columns, &number_of_columns, &length, &one, products, &length, &products[length * number_of_columns], &length, &one, product, &number_of_columns);
+
+  } // end if
+
+} // end innerProductsOfInverse
+
 // Matrix-vector product
 void SymmetricMatrixLimitedMemory::matrixVectorProduct(const Vector& vector,
                                                        Vector& product)
@@ -323,370 +253,418 @@ void SymmetricMatrixLimitedMemory::matrixVectorProduct(const Vector& vector,
   ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
   ASSERT_EXCEPTION(size_ == product.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Product has incorrect length.");
 
-  // Call appropriate update method
-  if (type_.compare("BFGS") == 0) {
-    matrixVectorProductBFGS(vector, product);
-  }
-  else if (type_.compare("DFP") == 0) {
-    matrixVectorProductDFP(vector, product);
-  }
+  // Compute product with compact form (BFGS) or its inverse (DFP)
+  productWithCompactForm(type_.compare("DFP") == 0, vector, product);
 
 } // end matrixVectorProduct
 
-// Matrix-vector product BFGS
-void SymmetricMatrixLimitedMemory::matrixVectorProductBFGS(const Vector& vector,
-                                                           Vector& product)
+// Matrix-vector product
+void SymmetricMatrixLimitedMemory::matrixVectorProductOfInverse(const Vector& vector,
+                                                                Vector& product)
 {
 
-  // Check if no pairs in storage
-  if ((int)s_.size() == 0) {
+  // Asserts
+  ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
+  ASSERT_EXCEPTION(size_ == product.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Product has incorrect length.");
 
-    // Compute product as multiple of vector
-    product.copy(vector);
-    product.scale(initial_diagonal_value_);
+  // Compute product with inverse of compact form (BFGS) or compact form (DFP)
+  productWithCompactForm(type_.compare("BFGS") == 0, vector, product);
+
+} // end matrixVectorProductOfInverse
+
+// Matrix-matrix product of inverse
+void SymmetricMatrixLimitedMemory::matrixMatrixProductOfInverse(int number_of_columns,
+                                                                double* matrix,
+                                                                double* product)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(number_of_columns >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Number of columns is negative.");
+
+  // Set inputs for BLASLAPACK
+  char no_transpose = 'N';
+  int m = pair_count_;
+  int length = size_ * number_of_columns;
+  int ldc = 2 * m;
+  int increment = 1;
+  double one = 1.0;
+
+  // Compute product with initial matrix inverse
+  double scale = scale_(type_.compare("BFGS") == 0);
+  dcopy_(&length, matrix, &increment, product, &increment);
+  dscal_(&length, &scale, product, &increment);
+
+  // Check for pairs in storage
+  if (m > 0 && number_of_columns > 0) {
+
+    // Set pointers to "S" (BFGS) or "Y" (DFP) and "Y" (BFGS) or "S" (DFP) values
+    double* first_values = (type_.compare("DFP") == 0) ? y_values_ : s_values_;
+    double* second_values = (type_.compare("DFP") == 0) ? s_values_ : y_values_;
+
+    // Compute coefficients
+    double* coefficients = productsOfCompactForm(type_.compare("BFGS") == 0, number_of_columns, matrix, false);
+
+    // Complete matrix-matrix product
+    dgemm_(&no_transpose, &no_transpose, &size_, &number_of_columns, &m, &one, first_values, &size_, coefficients, &ldc, &one, product, &size_);
+    dgemm_(&no_transpose, &no_transpose, &size_, &number_of_columns, &m, &one, second_values, &size_, &coefficients[m], &ldc, &one, product, &size_);
 
   } // end if
-  else {
 
-    // Declare factorization size
-    int factor_size = 2 * (int)s_.size();
-    int factor_length = factor_size * factor_size;
+} // end matrixMatrixProductOfInverse
 
-    // Set inputs for BLASLAPACK
-    char u = 'U';
-    int* v = new int[factor_size];
-    int flag = 0;
-
-    // Delete factorization array, if exists
-    if (compact_form_factorization_ != nullptr) {
-      delete[] compact_form_factorization_;
-      compact_form_factorization_ = nullptr;
-    } // end if
-
-    // Declare array (matrix size = (2*number of pairs)^2)
-    compact_form_factorization_ = new double[factor_length];
-
-    // Fill (1,1) block
-    for (int i = 0; i < (int)s_.size(); i++) {
-      for (int j = i; j < (int)s_.size(); j++) {
-        compact_form_factorization_[i + j * factor_size] = compact_form_inner_product_[i * history_ + j];
-      }
+// Delete arrays
+void SymmetricMatrixLimitedMemory::deleteArrays()
+{
+
+  // Delete arrays, if they exist
+  if (s_values_ != nullptr) {
+    delete[] s_values_;
+    s_values_ = nullptr;
+  } // end if
+  if (y_values_ != nullptr) {
+    delete[] y_values_;
+    y_values_ = nullptr;
+  } // end if
+  if (inner_products_ss_ != nullptr) {
+    delete[] inner_products_ss_;
+    inner_products_ss_ = nullptr;
+  } // end if
+  if (inner_products_sy_ != nullptr) {
+    delete[] inner_products_sy_;
+    inner_products_sy_ = nullptr;
+  } // end if
+  if (inner_products_yy_ != nullptr) {
+    delete[] inner_products_yy_;
+    inner_products_yy_ = nullptr;
+  } // end if
+  if (compact_form_factorization_ != nullptr) {
+    delete[] compact_form_factorization_;
+    compact_form_factorization_ = nullptr;
+  } // end if
+  if (compact_form_middle_ != nullptr) {
+    delete[] compact_form_middle_;
+    compact_form_middle_ = nullptr;
+  } // end if
+  if (compact_form_triangular_ != nullptr) {
+    delete[] compact_form_triangular_;
+    compact_form_triangular_ = nullptr;
+  } // end if
+  if (workspace_ != nullptr) {
+    delete[] workspace_;
+    workspace_ = nullptr;
+  } // end if
+  if (compact_form_pivots_ != nullptr) {
+    delete[] compact_form_pivots_;
+    compact_form_pivots_ = nullptr;
+  } // end if
+
+} // end deleteArrays
+
+// Factorize compact form
+void SymmetricMatrixLimitedMemory::factorizeCompactForm()
+{
+
+  // Declare sizes
+  int m = pair_count_;
+  int factor_size = 2 * m;
+
+  // Set pointer to "S'S" (BFGS) or "Y'Y" (DFP) and "Y'Y" (BFGS) or "S'S" (DFP) values
+  double* first_inner_products = (type_.compare("DFP") == 0) ? inner_products_yy_ : inner_products_ss_;
+  double* second_inner_products = (type_.compare("DFP") == 0) ? inner_products_ss_ : inner_products_yy_;
+
+  // Set scale of initial matrix for compact form and for its inverse
+  double scale = scale_(false);
+  double scale_inverse = scale_(true);
+
+  // Fill upper triangle of compact form, i.e., [scale*S'S L; L' -D] (BFGS)
+  for (int j = 0; j < m; j++) {
+    for (int i = 0; i <= j; i++) {
+      compact_form_factorization_[i + j * factor_size] = scale * first_inner_products[storage_(i) * history_ + storage_(j)];
+    }
+    for (int i = 0; i < m; i++) {
+      compact_form_factorization_[i + (m + j) * factor_size] = (i > j) ? crossProduct_(i, j) : 0.0;
+    }
+    for (int i = 0; i <= j; i++) {
+      compact_form_factorization_[m + i + (m + j) * factor_size] = (i == j) ? -crossProduct_(i, i) : 0.0;
+    }
+  } // end for
+
+  // Fill upper triangles of "R" and of "D+scale_inverse*Y'Y" (BFGS)
+  for (int j = 0; j < m; j++) {
+    for (int i = 0; i <= j; i++) {
+      compact_form_triangular_[i + j * m] = crossProduct_(i, j);
+      compact_form_middle_[i + j * m] = scale_inverse * second_inner_products[storage_(i) * history_ + storage_(j)] + ((i == j) ? crossProduct_(i, i) : 0.0);
     } // end for
+  }   // end for
 
-    // Fill (1,2) block
-    int shift_over = 2 * (int)s_.size() * (int)s_.size();
-    for (int i = 0; i < (int)s_.size(); i++) {
-      for (int j = 0; j < (int)s_.size(); j++) {
-        if (i > j) {
-          compact_form_factorization_[shift_over + i + j * factor_size] = compact_form_lower_triangular_[i * history_ + j];
-        }
-        else {
-          compact_form_factorization_[shift_over + i + j * factor_size] = 0.0;
-        }
-      } // end for
-    }   // end for
-
-    // Fill (2,2) block
-    int shift_down = (int)s_.size();
-    for (int i = 0; i < (int)s_.size(); i++) {
-      for (int j = 0; j < (int)s_.size(); j++) {
-        if (i == j) {
-          compact_form_factorization_[shift_over + shift_down + i + j * factor_size] = -compact_form_diagonal_[i];
-        }
-        else {
-          compact_form_factorization_[shift_over + shift_down + i + j * factor_size] = 0.0;
-        }
-      } // end for
-    }   // end for
+  // Set inputs for BLASLAPACK
+  char u = 'U';
+  int l = 4 * history_ * history_;
+  int flag = 0;
 
-    // Set inputs for BLASLAPACK
-    double* w = new double[factor_length];
-    int l = factor_length;
+  // Compute factorization
+  dsytrf_(&u, &factor_size, compact_form_factorization_, &factor_size, compact_form_pivots_, workspace_, &l, &flag);
 
-    // Compute factorization
-    dsytrf_(&u, &factor_size, compact_form_factorization_, &factor_size, v, w, &l, &flag);
+  // Indicate factorization done
+  compact_form_factorized_ = true;
 
-    // Indicate factorization done
-    compact_form_factorized_ = true;
+} // end factorizeCompactForm
 
-    // Delete temporary array
-    if (w != nullptr) {
-      delete[] w;
-      w = nullptr;
-    } // end if
+// Coefficients of compact form
+void SymmetricMatrixLimitedMemory::coefficientsOfCompactForm(bool inverse,
+                                                             double* coefficients)
+{
 
-    // Compute product with initial matrix
-    product.copy(vector);
-    product.scale(initial_diagonal_value_);
-
-    // Compute right product
-    Vector right_product(factor_size);
-    for (int i = 0; i < factor_size; i++) {
-      if (i < factor_size / 2) {
-        right_product.set(i, s_[i]->innerProduct(product));
-      }
-      else {
-        right_product.set(i, y_[i - factor_size / 2]->innerProduct(vector));
-      }
-    } // end for
+  // Set scale of initial matrix
+  double scale = scale_(inverse);
 
-    // Set inputs for BLASLAPACK
-    int rhs = 1;
-
-    // Compute solve with factorization
-    dsytrs_(&u, &factor_size, &rhs, compact_form_factorization_, &factor_size, v, right_product.valuesModifiable(), &factor_size, &flag);
-
-    // Complete outer product
-    Vector outer_product(size_, 0.0);
-    for (int i = 0; i < factor_size; i++) {
-      if (i < factor_size / 2) {
-        outer_product.addScaledVector(initial_diagonal_value_ * right_product.values()[i], *s_[i]);
-      }
-      else {
-        outer_product.addScaledVector(right_product.values()[i], *y_[i - factor_size / 2]);
-      }
+  // Set inputs for BLASLAPACK
+  char u = 'U';
+  char transpose = 'T';
+  char no_transpose = 'N';
+  char non_unit = 'N';
+  int m = pair_count_;
+  int factor_size = 2 * m;
+  int increment = 1;
+  int rhs = 1;
+  int flag = 0;
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Set workspace pointers (vectors by pair index, following coefficients)
+  double* a = &coefficients[2 * m];
+  double* b = &coefficients[3 * m];
+
+  // Check for inverse
+  if (!inverse) {
+
+    // Set right-hand side [scale*S'v; Y'v] (BFGS) in pair order
+    for (int i = 0; i < m; i++) {
+      a[i] = scale * coefficients[storage_(i)];
+      b[i] = coefficients[m + storage_(i)];
     } // end for
 
-    // Compute matrix-vector product
-    product.addScaledVector(-1.0, outer_product);
+    // Compute solve with factorization (a and b are contiguous)
+    dsytrs_(&u, &factor_size, &rhs, compact_form_factorization_, &factor_size, compact_form_pivots_, a, &factor_size, &flag);
 
-    // Delete temporary array
-    if (v != nullptr) {
-      delete[] v;
-      v = nullptr;
-    } // end if
+    // Set coefficients in storage order
+    for (int i = 0; i < m; i++) {
+      coefficients[storage_(i)] = -scale * a[i];
+      coefficients[m + storage_(i)] = -b[i];
+    } // end for
 
   } // end if
+  else {
+
+    // Compute a = R^{-1}*S'v (BFGS)
+    for (int i = 0; i < m; i++) {
+      a[i] = coefficients[storage_(i)];
+    }
+    dtrsv_(&u, &no_transpose, &non_unit, &m, compact_form_triangular_, &m, a, &increment);
+
+    // Compute b = R^{-T}*((D+scale*Y'Y)*a - scale*Y'v) (BFGS)
+    dsymv_(&u, &m, &one, compact_form_middle_, &m, a, &increment, &zero, b, &increment);
+    for (int i = 0; i < m; i++) {
+      b[i] -= scale * coefficients[m + storage_(i)];
+    }
+    dtrsv_(&u, &transpose, &non_unit, &m, compact_form_triangular_, &m, b, &increment);
+
+    // Set coefficients in storage order
+    for (int i = 0; i < m; i++) {
+      coefficients[storage_(i)] = b[i];
+      coefficients[m + storage_(i)] = -scale * a[i];
+    } // end for
 
-} // end matrixVectorProductBFGS
+  } // end else
 
-// Matrix-vector product DFP
-void SymmetricMatrixLimitedMemory::matrixVectorProductDFP(const Vector& vector,
-                                                          Vector& product)
+} // end coefficientsOfCompactForm
+
+// Column of compact form
+void SymmetricMatrixLimitedMemory::columnOfCompactForm(bool inverse,
+                                                       int column_index,
+                                                       Vector& column)
 {
 
-  // Create intermediate value vectors
-  double* a = new double[(int)s_.size()];
-  double* b = new double[(int)s_.size()];
+  // Initialize column as column of initial matrix
+  column.setLength(size_);
+  column.set(column_index, scale_(inverse));
 
-  // Initialize product
-  product.copy(vector);
+  // Check for pairs in storage
+  if (pair_count_ > 0) {
 
-  // Set parameters for daxpy
-  double value = 0.0;
-  int increment = 1;
+    // Factorize, if needed
+    if (!compact_form_factorized_) {
+      factorizeCompactForm();
+    }
 
-  // Two-loop
-  for (int i = (int)s_.size() - 1; i >= 0; i--) {
-    a[i] = rho_[i] * y_[i]->innerProduct(product);
-    value = -a[i];
-    daxpy_(&size_, &value, s_[i]->values(), &increment, product.valuesModifiable(), &increment);
-  } // end for
-  product.scale(initial_diagonal_value_);
-  for (int i = 0; i < (int)s_.size(); i++) {
-    b[i] = rho_[i] * s_[i]->innerProduct(product);
-    value = a[i] - b[i];
-    daxpy_(&size_, &value, y_[i]->values(), &increment, product.valuesModifiable(), &increment);
-  } // end for
+    // Set pointers to "S" (BFGS) or "Y" (DFP) and "Y" (BFGS) or "S" (DFP) values
+    double* first_values = (type_.compare("DFP") == 0) ? y_values_ : s_values_;
+    double* second_values = (type_.compare("DFP") == 0) ? s_values_ : y_values_;
+
+    // Set inputs for BLASLAPACK
+    char no_transpose = 'N';
+    int m = pair_count_;
+    int increment = 1;
+    double one = 1.0;
+
+    // Set products with unit vector, i.e., rows of pair arrays
+    dcopy_(&m, &first_values[column_index], &size_, workspace_, &increment);
+    dcopy_(&m, &second_values[column_index], &size_, &workspace_[m], &increment);
+
+    // Compute coefficients
+    coefficientsOfCompactForm(inverse, workspace_);
+
+    // Complete column
+    dgemv_(&no_transpose, &size_, &m, &one, first_values, &size_, workspace_, &increment, &one, column.valuesModifiable(), &increment);
+    dgemv_(&no_transpose, &size_, &m, &one, second_values, &size_, &workspace_[m], &increment, &one, column.valuesModifiable(), &increment);
 
-  // Delete intermediate value vectors
-  if (a != nullptr) {
-    delete[] a;
-    a = nullptr;
-  } // end if
-  if (b != nullptr) {
-    delete[] b;
-    b = nullptr;
   } // end if
 
-} // end matrixVectorProductDFP
+} // end columnOfCompactForm
 
-// Matrix-vector product
-void SymmetricMatrixLimitedMemory::matrixVectorProductOfInverse(const Vector& vector,
-                                                                Vector& product)
+// Element of compact form
+double SymmetricMatrixLimitedMemory::elementOfCompactForm(bool inverse,
+                                                          int row_index,
+                                                          int column_index)
 {
 
-  // Asserts
-  ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
-  ASSERT_EXCEPTION(size_ == product.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Product has incorrect length.");
+  // Initialize element as element of initial matrix
+  double element_value = (row_index == column_index) ? scale_(inverse) : 0.0;
 
-  // Call appropriate update method
-  if (type_.compare("BFGS") == 0) {
-    matrixVectorProductOfInverseBFGS(vector, product);
-  }
-  else if (type_.compare("DFP") == 0) {
-    matrixVectorProductOfInverseDFP(vector, product);
-  }
+  // Check for pairs in storage
+  if (pair_count_ > 0) {
 
-} // end matrixVectorProductOfInverse
+    // Factorize, if needed
+    if (!compact_form_factorized_) {
+      factorizeCompactForm();
+    }
+
+    // Set pointers to "S" (BFGS) or "Y" (DFP) and "Y" (BFGS) or "S" (DFP) values
+    double* first_values = (type_.compare("DFP") == 0) ? y_values_ : s_values_;
+    double* second_values = (type_.compare("DFP") == 0) ? s_values_ : y_values_;
+
+    // Set inputs for BLASLAPACK
+    int m = pair_count_;
+    int increment = 1;
+
+    // Set products with unit vector, i.e., rows of pair arrays
+    dcopy_(&m, &first_values[column_index], &size_, workspace_, &increment);
+    dcopy_(&m, &second_values[column_index], &size_, &workspace_[m], &increment);
+
+    // Compute coefficients
+    coefficientsOfCompactForm(inverse, workspace_);
+
+    // Complete element with rows of pair arrays
+    element_value += ddot_(&m, &first_values[row_index], &size_, workspace_, &increment);
+    element_value += ddot_(&m, &second_values[row_index], &size_, &workspace_[m], &increment);
+
+  } // end if
 
-// Matrix-vector product BFGS
-void SymmetricMatrixLimitedMemory::matrixVectorProductOfInverseBFGS(const Vector& vector,
-                                                                    Vector& product)
+  // Return element
+  return element_value;
+
+} // end elementOfCompactForm
+
+// Products of compact form
+double* SymmetricMatrixLimitedMemory::productsOfCompactForm(bool inverse,
+                                                            int number_of_columns,
+                                                            double* matrix,
+                                                            bool keep_products)
 {
 
-  // Create intermediate value vectors
-  double* a = new double[(int)s_.size()];
-  double* b = new double[(int)s_.size()];
+  // Factorize, if needed
+  if (!compact_form_factorized_) {
+    factorizeCompactForm();
+  }
 
-  // Initialize product
-  product.copy(vector);
+  // Set pointers to "S" (BFGS) or "Y" (DFP) and "Y" (BFGS) or "S" (DFP) values
+  double* first_values = (type_.compare("DFP") == 0) ? y_values_ : s_values_;
+  double* second_values = (type_.compare("DFP") == 0) ? s_values_ : y_values_;
 
-  // Set parameters for daxpy
-  double value = 0.0;
+  // Set inputs for BLASLAPACK
+  char transpose = 'T';
+  char no_transpose = 'N';
+  int m = pair_count_;
+  int length = 2 * m;
   int increment = 1;
-
-  // Two-loop
-  for (int i = (int)s_.size() - 1; i >= 0; i--) {
-    a[i] = rho_[i] * s_[i]->innerProduct(product);
-    value = -a[i];
-    daxpy_(&size_, &value, y_[i]->values(), &increment, product.valuesModifiable(), &increment);
-  } // end for
-  product.scale(1.0 / initial_diagonal_value_);
-  for (int i = 0; i < (int)s_.size(); i++) {
-    b[i] = rho_[i] * y_[i]->innerProduct(product);
-    value = a[i] - b[i];
-    daxpy_(&size_, &value, s_[i]->values(), &increment, product.valuesModifiable(), &increment);
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Set block workspace (products, followed by coefficients if products are kept)
+  block_workspace_.resize((keep_products ? 2 : 1) * length * number_of_columns);
+  double* products = block_workspace_.data();
+  double* coefficients = (keep_products ? &products[length * number_of_columns] : products);
+
+  // Compute products with pairs (S'G and Y'G for BFGS)
+  dgemm_(&transpose, &no_transpose, &m, &number_of_columns, &size_, &one, first_values, &size_, matrix, &size_, &zero, products, &length);
+  dgemm_(&transpose, &no_transpose, &m, &number_of_columns, &size_, &one, second_values, &size_, matrix, &size_, &zero, &products[m], &length);
+
+  // Compute coefficients column by column
+  for (int j = 0; j < number_of_columns; j++) {
+    dcopy_(&length, &products[j * length], &increment, workspace_, &increment);
+    coefficientsOfCompactForm(inverse, workspace_);
+    dcopy_(&length, workspace_, &increment, &coefficients[j * length], &increment);
   } // end for
 
-  // Delete intermediate value vectors
-  if (a != nullptr) {
-    delete[] a;
-    a = nullptr;
-  } // end if
-  if (b != nullptr) {
-    delete[] b;
-    b = nullptr;
-  } // end if
+  // Return products (followed by coefficients) or coefficients
+  return products;
 
-} // end matrixVectorProductOfInverseBFGS
+} // end productsOfCompactForm
 
-// Matrix-vector product DFP
-void SymmetricMatrixLimitedMemory::matrixVectorProductOfInverseDFP(const Vector& vector,
-                                                                   Vector& product)
+// Product with compact form
+void SymmetricMatrixLimitedMemory::productWithCompactForm(bool inverse,
+                                                          const Vector& vector,
+                                                          Vector& product)
 {
 
+  // Set scale of initial matrix
+  double scale = scale_(inverse);
+
   // Check if no pairs in storage
-  if ((int)s_.size() == 0) {
+  if (pair_count_ == 0) {
 
     // Compute product as multiple of vector
     product.copy(vector);
-    product.scale(1.0 / initial_diagonal_value_);
+    product.scale(scale);
 
   } // end if
   else {
 
-    // Declare factorization size
-    int factor_size = 2 * (int)s_.size();
-    int factor_length = factor_size * factor_size;
+    // Factorize, if needed
+    if (!compact_form_factorized_) {
+      factorizeCompactForm();
+    }
 
-    // Set inputs for BLASLAPACK
-    char u = 'U';
-    int* v = new int[factor_size];
-    int flag = 0;
-
-    // Delete factorization array, if exists
-    if (compact_form_factorization_ != nullptr) {
-      delete[] compact_form_factorization_;
-      compact_form_factorization_ = nullptr;
-    } // end if
-
-    // Declare array (matrix size = (2*number of pairs)^2)
-    compact_form_factorization_ = new double[factor_length];
-
-    // Fill (1,1) block
-    for (int i = 0; i < (int)s_.size(); i++) {
-      for (int j = i; j < (int)s_.size(); j++) {
-        compact_form_factorization_[i + j * factor_size] = compact_form_inner_product_[i * history_ + j];
-      }
-    } // end for
-
-    // Fill (1,2) block
-    int shift_over = 2 * (int)s_.size() * (int)s_.size();
-    for (int i = 0; i < (int)s_.size(); i++) {
-      for (int j = 0; j < (int)s_.size(); j++) {
-        if (i > j) {
-          compact_form_factorization_[shift_over + i + j * factor_size] = compact_form_lower_triangular_[i * history_ + j];
-        }
-        else {
-          compact_form_factorization_[shift_over + i + j * factor_size] = 0.0;
-        }
-      } // end for
-    }   // end for
-
-    // Fill (2,2) block
-    int shift_down = (int)s_.size();
-    for (int i = 0; i < (int)s_.size(); i++) {
-      for (int j = 0; j < (int)s_.size(); j++) {
-        if (i == j) {
-          compact_form_factorization_[shift_over + shift_down + i + j * factor_size] = -compact_form_diagonal_[i];
-        }
-        else {
-          compact_form_factorization_[shift_over + shift_down + i + j * factor_size] = 0.0;
-        }
-      } // end for
-    }   // end for
+    // Set pointers to "S" (BFGS) or "Y" (DFP) and "Y" (BFGS) or "S" (DFP) values
+    double* first_values = (type_.compare("DFP") == 0) ? y_values_ : s_values_;
+    double* second_values = (type_.compare("DFP") == 0) ? s_values_ : y_values_;
 
     // Set inputs for BLASLAPACK
-    double* w = new double[factor_length];
-    int l = factor_length;
+    char transpose = 'T';
+    char no_transpose = 'N';
+    int m = pair_count_;
+    int increment = 1;
+    double one = 1.0;
+    double zero = 0.0;
 
-    // Compute factorization
-    dsytrf_(&u, &factor_size, compact_form_factorization_, &factor_size, v, w, &l, &flag);
+    // Compute products with pairs (S'v and Y'v for BFGS)
+    dgemv_(&transpose, &size_, &m, &one, first_values, &size_, vector.values(), &increment, &zero, workspace_, &increment);
+    dgemv_(&transpose, &size_, &m, &one, second_values, &size_, vector.values(), &increment, &zero, &workspace_[m], &increment);
 
-    // Indicate factorization done
-    compact_form_factorized_ = true;
-
-    // Delete temporary array
-    if (w != nullptr) {
-      delete[] w;
-      w = nullptr;
-    } // end if
+    // Compute coefficients
+    coefficientsOfCompactForm(inverse, workspace_);
 
     // Compute product with initial matrix
     product.copy(vector);
-    product.scale(1.0 / initial_diagonal_value_);
-
-    // Compute right product
-    Vector right_product(factor_size);
-    for (int i = 0; i < factor_size; i++) {
-      if (i < factor_size / 2) {
-        right_product.set(i, y_[i]->innerProduct(product));
-      }
-      else {
-        right_product.set(i, s_[i - factor_size / 2]->innerProduct(vector));
-      }
-    } // end for
+    product.scale(scale);
 
-    // Set inputs for BLASLAPACK
-    int rhs = 1;
-
-    // Compute solve with factorization
-    dsytrs_(&u, &factor_size, &rhs, compact_form_factorization_, &factor_size, v, right_product.valuesModifiable(), &factor_size, &flag);
-
-    // Complete outer product
-    Vector outer_product(size_, 0.0);
-    for (int i = 0; i < factor_size; i++) {
-      if (i < factor_size / 2) {
-        outer_product.addScaledVector((1.0 / initial_diagonal_value_) * right_product.values()[i], *y_[i]);
-      }
-      else {
-        outer_product.addScaledVector(right_product.values()[i], *s_[i - factor_size / 2]);
-      }
-    } // end for
-
-    // Compute matrix-vector product
-    product.addScaledVector(-1.0, outer_product);
-
-    // Delete temporary array
-    if (v != nullptr) {
-      delete[] v;
-      v = nullptr;
-    } // end if
+    // Complete matrix-vector product
+    dgemv_(&no_transpose, &size_, &m, &one, first_values, &size_, workspace_, &increment, &one, product.valuesModifiable(), &increment);
+    dgemv_(&no_transpose, &size_, &m, &one, second_values, &size_, &workspace_[m], &increment, &one, product.valuesModifiable(), &increment);
 
-  } // end if
+  } // end else
 
-} // end matrixVectorProductOfInverseDFP
+} // end productWithCompactForm
 
 // Set as diagonal matrix
 void SymmetricMatrixLimitedMemory::setAsDiagonal(int size,
@@ -696,37 +674,22 @@ void SymmetricMatrixLimitedMemory::setAsDiagonal(int size,
   // Assert
   ASSERT_EXCEPTION(value > 0.0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Value is nonpositive.");
 
-  // Clear s, y, and rho sets
-  s_.clear();
-  y_.clear();
-  rho_.clear();
+  // Increment modification counter
+  incrementModificationCounter();
+
+  // Clear pairs
+  pair_count_ = 0;
+  pair_start_ = 0;
 
   // Clear computed columns sets
   computed_columns_.clear();
   computed_columns_of_inverse_.clear();
-  computed_column_indices_.clear();
-  computed_column_indices_of_inverse_.clear();
 
   // Reset factorization indicator
   compact_form_factorized_ = false;
 
-  // Delete array, if it exists
-  if (compact_form_diagonal_ != nullptr) {
-    delete[] compact_form_diagonal_;
-    compact_form_diagonal_ = nullptr;
-  } // end if
-  if (compact_form_factorization_ != nullptr) {
-    delete[] compact_form_factorization_;
-    compact_form_factorization_ = nullptr;
-  } // end if
-  if (compact_form_inner_product_ != nullptr) {
-    delete[] compact_form_inner_product_;
-    compact_form_inner_product_ = nullptr;
-  } // end if
-  if (compact_form_lower_triangular_ != nullptr) {
-    delete[] compact_form_lower_triangular_;
-    compact_form_lower_triangular_ = nullptr;
-  } // end if
+  // Delete arrays, if they exist
+  deleteArrays();
 
   // Set size
   size_ = size;
@@ -734,10 +697,17 @@ void SymmetricMatrixLimitedMemory::setAsDiagonal(int size,
   // Set initial diagonal value
   initial_diagonal_value_ = value;
 
-  // Allocate memory for compact form matrices
-  compact_form_diagonal_ = new double[history_];
-  compact_form_inner_product_ = new double[history_ * history_];
-  compact_form_lower_triangular_ = new double[history_ * history_];
+  // Allocate memory for pairs, inner products, and compact form matrices
+  s_values_ = new double[size_ * history_];
+  y_values_ = new double[size_ * history_];
+  inner_products_ss_ = new double[history_ * history_];
+  inner_products_sy_ = new double[history_ * history_];
+  inner_products_yy_ = new double[history_ * history_];
+  compact_form_factorization_ = new double[4 * history_ * history_];
+  compact_form_middle_ = new double[history_ * history_];
+  compact_form_triangular_ = new double[history_ * history_];
+  workspace_ = new double[(int)fmax(4 * history_ * history_, 4 * history_)];
+  compact_form_pivots_ = new int[2 * history_];
 
 } // end setAsDiagonal
 
@@ -750,94 +720,57 @@ void SymmetricMatrixLimitedMemory::update(const Vector& s,
   ASSERT_EXCEPTION(size_ == s.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector s has incorrect length.");
   ASSERT_EXCEPTION(size_ == y.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector y has incorrect length.");
 
-  // Create pointers to new vectors, set as copy of (s,y) pair
-  std::shared_ptr<Vector> s_new = s.makeNewCopy();
-  std::shared_ptr<Vector> y_new = y.makeNewCopy();
-
-  // Compute sy product
-  double sy_new = s_new->innerProduct(*y_new);
-
-  // Compute rho value
-  double rho_new = 1.0 / sy_new;
-
-  // Check whether to remove old information
-  bool remove = ((int)s_.size() >= history_);
+  // Increment modification counter
+  incrementModificationCounter();
 
-  // Add pair
-  s_.push_back(s_new);
-  y_.push_back(y_new);
-  rho_.push_back(rho_new);
+  // Check for storage
+  if (history_ > 0) {
 
-  // Remove old pair
-  if (remove) {
-    s_.erase(s_.begin());
-    y_.erase(y_.begin());
-    rho_.erase(rho_.begin());
-  } // end while
+    // Set storage index of new pair, overwriting oldest pair if history is full
+    int k = pair_start_;
+    if (pair_count_ < history_) {
+      k = pair_count_;
+      pair_count_++;
+    }
+    else {
+      pair_start_ = (pair_start_ + 1) % history_;
+    }
 
-  // Update diagonal matrix
-  if (remove) {
-    for (int i = 0; i < history_ - 1; i++) {
-      compact_form_diagonal_[i] = compact_form_diagonal_[i + 1];
-    } // end for
-  }   // end if
-  compact_form_diagonal_[(int)s_.size() - 1] = sy_new;
-
-  // Update inner product matrix
-  if (remove) {
-    for (int i = 0; i < history_ - 1; i++) {
-      for (int j = i; j < history_ - 1; j++) {
-        compact_form_inner_product_[i * history_ + j] = compact_form_inner_product_[(i + 1) * history_ + (j + 1)];
-      } // end for
-    }   // end for
-  }     // end if
-  if (type_.compare("BFGS") == 0) {
-    for (int i = 0; i < (int)s_.size() - 1; i++) {
-      compact_form_inner_product_[i * history_ + (int)s_.size() - 1] = initial_diagonal_value_ * s_[i]->innerProduct(*s_new);
+    // Set inputs for BLASLAPACK
+    char transpose = 'T';
+    int increment = 1;
+    double one = 1.0;
+    double zero = 0.0;
+
+    // Copy pair
+    dcopy_(&size_, s.values(), &increment, &s_values_[k * size_], &increment);
+    dcopy_(&size_, y.values(), &increment, &y_values_[k * size_], &increment);
+
+    // Compute inner products of stored pairs with new pair
+    dgemv_(&transpose, &size_, &pair_count_, &one, s_values_, &size_, s.values(), &increment, &zero, workspace_, &increment);
+    dgemv_(&transpose, &size_, &pair_count_, &one, y_values_, &size_, y.values(), &increment, &zero, &workspace_[history_], &increment);
+    dgemv_(&transpose, &size_, &pair_count_, &one, s_values_, &size_, y.values(), &increment, &zero, &workspace_[2 * history_], &increment);
+    dgemv_(&transpose, &size_, &pair_count_, &one, y_values_, &size_, s.values(), &increment, &zero, &workspace_[3 * history_], &increment);
+
+    // Update inner product matrices
+    for (int j = 0; j < pair_count_; j++) {
+      inner_products_ss_[j * history_ + k] = workspace_[j];
+      inner_products_ss_[k * history_ + j] = workspace_[j];
+      inner_products_yy_[j * history_ + k] = workspace_[history_ + j];
+      inner_products_yy_[k * history_ + j] = workspace_[history_ + j];
+      inner_products_sy_[j * history_ + k] = workspace_[2 * history_ + j];
+      inner_products_sy_[k * history_ + j] = workspace_[3 * history_ + j];
     } // end for
-    compact_form_inner_product_[((int)s_.size() - 1) * history_ + (int)s_.size() - 1] = initial_diagonal_value_ * pow(s_new->norm2(), 2.0);
+
   } // end if
-  else if (type_.compare("DFP") == 0) {
-    for (int i = 0; i < (int)s_.size() - 1; i++) {
-      compact_form_inner_product_[i * history_ + (int)s_.size() - 1] = (1.0 / initial_diagonal_value_) * y_[i]->innerProduct(*y_new);
-    } // end for
-    compact_form_inner_product_[((int)s_.size() - 1) * history_ + (int)s_.size() - 1] = (1.0 / initial_diagonal_value_) * pow(y_new->norm2(), 2.0);
-  } // end else if
-
-  // Update lower triangular matrix
-  if (remove) {
-    for (int i = 1; i < history_ - 1; i++) {
-      for (int j = 0; j <= i - 1; j++) {
-        compact_form_lower_triangular_[i * history_ + j] = compact_form_lower_triangular_[(i + 1) * history_ + (j + 1)];
-      } // end for
-    }   // end for
-  }     // end if
-  if (type_.compare("BFGS") == 0) {
-    for (int j = 0; j < (int)s_.size() - 1; j++) {
-      compact_form_lower_triangular_[((int)s_.size() - 1) * history_ + j] = s_new->innerProduct(*y_[j]);
-    } // end for
-  }   // end if
-  else if (type_.compare("DFP") == 0) {
-    for (int j = 0; j < (int)s_.size() - 1; j++) {
-      compact_form_lower_triangular_[((int)s_.size() - 1) * history_ + j] = y_new->innerProduct(*s_[j]);
-    } // end for
-  }   // end else if
 
   // Clear computed columns sets
   computed_columns_.clear();
   computed_columns_of_inverse_.clear();
-  computed_column_indices_.clear();
-  computed_column_indices_of_inverse_.clear();
 
   // Reset factorization indicator
   compact_form_factorized_ = false;
 
-  // Delete factorization array, if exists
-  if (compact_form_factorization_ != nullptr) {
-    delete[] compact_form_factorization_;
-    compact_form_factorization_ = nullptr;
-  } // end if
-
 } // end update
 
 // Print
@@ -848,15 +781,15 @@ void SymmetricMatrixLimitedMemory::print(const Reporter* reporter,
   // Print elements
   reporter->printf(R_NL, R_BASIC, "%s initial_diagonal_value=%+23.16e\n", name.c_str(), initial_diagonal_value_);
   reporter->printf(R_QP, R_BASIC, "%s initial_diagonal_value=%+23.16e\n", name.c_str(), initial_diagonal_value_);
-  for (int j = 0; j < (int)s_.size(); j++) {
+  for (int j = 0; j < pair_count_; j++) {
     for (int i = 0; i < size_; i++) {
-      reporter->printf(R_NL, R_BASIC, "%s %6d-th pair: s[%6d]=%+23.16e, y[%6d]=%+23.16e\n", name.c_str(), j, i, s_[j]->values()[i], i, y_[j]->values()[i]);
-      reporter->printf(R_QP, R_BASIC, "%s %6d-th pair: s[%6d]=%+23.16e, y[%6d]=%+23.16e\n", name.c_str(), j, i, s_[j]->values()[i], i, y_[j]->values()[i]);
+      reporter->printf(R_NL, R_BASIC, "%s %6d-th pair: s[%6d]=%+23.16e, y[%6d]=%+23.16e\n", name.c_str(), j, i, s_values_[storage_(j) * size_ + i], i, y_values_[storage_(j) * size_ + i]);
+      reporter->printf(R_QP, R_BASIC, "%s %6d-th pair: s[%6d]=%+23.16e, y[%6d]=%+23.16e\n", name.c_str(), j, i, s_values_[storage_(j) * size_ + i], i, y_values_[storage_(j) * size_ + i]);
     } // end for
   }   // end for
-  for (int j = 0; j < (int)s_.size(); j++) {
-    reporter->printf(R_NL, R_BASIC, "%s rho[%6d]=%+23.16e\n", name.c_str(), j, rho_[j]);
-    reporter->printf(R_QP, R_BASIC, "%s rho[%6d]=%+23.16e\n", name.c_str(), j, rho_[j]);
+  for (int j = 0; j < pair_count_; j++) {
+    reporter->printf(R_NL, R_BASIC, "%s rho[%6d]=%+23.16e\n", name.c_str(), j, 1.0 / inner_products_sy_[storage_(j) * history_ + storage_(j)]);
+    reporter->printf(R_QP, R_BASIC, "%s rho[%6d]=%+23.16e\n", name.c_str(), j, 1.0 / inner_products_sy_[storage_(j) * history_ + storage_(j)]);
   } // end for
 
 } // end print
@@ -7,6 +7,8 @@
 #ifndef __NONOPTSYMMETRICMATRIXLIMITEDMEMORY_HPP__
 #define __NONOPTSYMMETRICMATRIXLIMITEDMEMORY_HPP__
 
+#include <unordered_map>
+
 #include "NonOptSymmetricMatrix.hpp"
 
 namespace NonOpt
@@ -14,6 +16,12 @@ namespace NonOpt
 
 /**
  * SymmetricMatrixLimitedMemory class
+ * (Pairs are stored as columns of "S" and "Y" arrays, each of size number of rows times
+ *  history length, used as ring buffers, so the oldest pair is overwritten when history is
+ *  full.  Products are computed with the compact form of the matrix, or the inverse of the
+ *  compact form, using matrix-vector products with these arrays.  Elements and columns are
+ *  computed with the same forms applied to unit vectors, for which the products with the
+ *  arrays reduce to rows of the arrays, so an element costs O(history^2).)
  */
 class SymmetricMatrixLimitedMemory : public SymmetricMatrix
 {
@@ -28,19 +36,22 @@ public:
     : compact_form_factorized_(false),
       size_(-1),
       history_(-1),
+      pair_count_(0),
+      pair_start_(0),
       initial_diagonal_value_(1.0),
-      compact_form_diagonal_(nullptr),
+      s_values_(nullptr),
+      y_values_(nullptr),
+      inner_products_ss_(nullptr),
+      inner_products_sy_(nullptr),
+      inner_products_yy_(nullptr),
       compact_form_factorization_(nullptr),
-      compact_form_inner_product_(nullptr),
-      compact_form_lower_triangular_(nullptr)
+      compact_form_middle_(nullptr),
+      compact_form_triangular_(nullptr),
+      workspace_(nullptr),
+      compact_form_pivots_(nullptr)
   {
-    s_.clear();
-    y_.clear();
-    rho_.clear();
     computed_columns_.clear();
     computed_columns_of_inverse_.clear();
-    computed_column_indices_.clear();
-    computed_column_indices_of_inverse_.clear();
   };
   //@}
 
@@ -123,6 +134,15 @@ public:
    * \return inner product of vector with this vector
    */
   double innerProductOfInverse(const Vector& vector);
+  /**
+   * Get inner products of symmetric matrix inverse with columns of matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store matrix'*inverse*matrix (column-major, number_of_columns squared)
+   */
+  void innerProductsOfInverse(int number_of_columns,
+                              double* matrix,
+                              double* product);
   /**
    * Get product of symmetric matrix with vector
    * \param[in] vector is reference to a Vector
@@ -137,6 +157,15 @@ public:
    */
   void matrixVectorProductOfInverse(const Vector& vector,
                                     Vector& product);
+  /**
+   * Get product of symmetric matrix inverse with matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store product values (column-major, same size as matrix)
+   */
+  void matrixMatrixProductOfInverse(int number_of_columns,
+                                    double* matrix,
+                                    double* product);
   /**
    * Get name of strategy
    * \return string with name of strategy
@@ -198,30 +227,111 @@ private:
   bool compact_form_factorized_;                                     /**< Bool indicating if factorization has been performed */
   int size_;                                                         /**< Number of rows and number of columns */
   int history_;                                                      /**< Limited memory history length */
+  int pair_count_;                                                   /**< Number of pairs in storage */
+  int pair_start_;                                                   /**< Storage index of oldest pair */
   double initial_diagonal_value_;                                    /**< Diagonal value of "initial" matrix */
-  double* compact_form_diagonal_;                                    /**< Double array, values of "D" matrix for compact form */
+  double* s_values_;                                                 /**< Double array, "s" values (column-major, one column per storage index) */
+  double* y_values_;                                                 /**< Double array, "y" values (column-major, one column per storage index) */
+  double* inner_products_ss_;                                        /**< Double array, "s'*s" values (by storage indices) */
+  double* inner_products_sy_;                                        /**< Double array, "s'*y" values (by storage indices, "s" index first) */
+  double* inner_products_yy_;                                        /**< Double array, "y'*y" values (by storage indices) */
   double* compact_form_factorization_;                               /**< Double array, values of compact form factorization */
-  double* compact_form_inner_product_;                               /**< Double array, values of "SHS" or "YWY" matrix for compact form */
-  double* compact_form_lower_triangular_;                            /**< Double array, values of "L" matrix for compact form */
-  std::vector<std::shared_ptr<Vector>> s_;                           /**< Vector vector, "s" values */
-  std::vector<std::shared_ptr<Vector>> y_;                           /**< Vector vector, "y" values */
-  std::vector<double> rho_;                                          /**< Double vector, "rho" values */
-  std::vector<std::shared_ptr<Vector>> computed_columns_;            /**< Vector vector, computed columns */
-  std::vector<std::shared_ptr<Vector>> computed_columns_of_inverse_; /**< Vector vector, computed columns of inverse */
-  std::vector<int> computed_column_indices_;                         /**< Integer vector, computed column indices */
-  std::vector<int> computed_column_indices_of_inverse_;              /**< Integer vector, computed column indices of inverse */
+  double* compact_form_middle_;                                      /**< Double array, values of "D+Y'WY" or "D+S'HS" matrix for inverse of compact form */
+  double* compact_form_triangular_;                                  /**< Double array, values of "R" matrix for inverse of compact form */
+  double* workspace_;                                                /**< Double array, workspace for factorization and products */
+  int* compact_form_pivots_;                                         /**< Integer array, pivots of compact form factorization */
+  std::vector<double> block_workspace_;                              /**< Double vector, workspace for matrix-matrix products */
+  std::unordered_map<int, std::shared_ptr<Vector>> computed_columns_;            /**< Map, computed columns by column index */
+  std::unordered_map<int, std::shared_ptr<Vector>> computed_columns_of_inverse_; /**< Map, computed columns of inverse by column index */
   //@}
 
   /** @name Private methods */
   //@{
-  void matrixVectorProductBFGS(const Vector& vector,
-                               Vector& product);
-  void matrixVectorProductDFP(const Vector& vector,
+  /**
+   * Delete arrays
+   */
+  void deleteArrays();
+  /**
+   * Factorize compact form and set matrices for inverse of compact form
+   */
+  void factorizeCompactForm();
+  /**
+   * Get coefficients for compact form or its inverse
+   * \param[in] inverse indicates whether to use inverse of compact form
+   * \param[in,out] coefficients is array of "[S'v; Y'v]" (BFGS) by storage index, overwritten
+   *                 by "c" such that product with v is scale*v + [S Y]*c (BFGS) by storage index
+   */
+  void coefficientsOfCompactForm(bool inverse,
+                                 double* coefficients);
+  /**
+   * Get column of compact form, i.e., of matrix (BFGS) or matrix inverse (DFP), or of its inverse
+   * \param[in] inverse indicates whether to use inverse of compact form
+   * \param[in] column_index is index of column to compute
+   * \param[out] column is Vector to store column values
+   */
+  void columnOfCompactForm(bool inverse,
+                           int column_index,
+                           Vector& column);
+  /**
+   * Get element of compact form, i.e., of matrix (BFGS) or matrix inverse (DFP), or of its inverse
+   * \param[in] inverse indicates whether to use inverse of compact form
+   * \param[in] row_index is row index number
+   * \param[in] column_index is column index number
+   * \return (row_index,column_index) element
+   */
+  double elementOfCompactForm(bool inverse,
+                              int row_index,
+                              int column_index);
+  /**
+   * Get products of pairs with matrix and coefficients for compact form or its inverse
+   * \param[in] inverse indicates whether to use inverse of compact form
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[in] keep_products indicates whether to keep "[S'G; Y'G]" (BFGS), followed by coefficients
+   * \return pointer to array (in block workspace) of products followed by coefficients, if
+   *         kept, or of coefficients, with one column (of length twice number of pairs) per
+   *         column of matrix and rows ordered by storage index
+   */
+  double* productsOfCompactForm(bool inverse,
+                                int number_of_columns,
+                                double* matrix,
+                                bool keep_products);
+  /**
+   * Get product with compact form, i.e., with matrix (BFGS) or matrix inverse (DFP), or with its inverse
+   * \param[in] inverse indicates whether to use inverse of compact form
+   * \param[in] vector is reference to a Vector
+   * \param[out] product is Vector to store product values
+   */
+  void productWithCompactForm(bool inverse,
+                              const Vector& vector,
                               Vector& product);
-  void matrixVectorProductOfInverseBFGS(const Vector& vector,
-                                        Vector& product);
-  void matrixVectorProductOfInverseDFP(const Vector& vector,
-                                       Vector& product);
+  //@}
+
+  /** @name Indexing methods */
+  //@{
+  /**
+   * Storage index
+   * \param[in] i is pair index (0 for oldest pair)
+   * \return storage index (column of "S" and "Y" arrays) of pair i
+   */
+  inline int const storage_(int i) const { return (pair_start_ + i) % history_; };
+  /**
+   * Scale of initial matrix
+   * \param[in] inverse indicates whether to use inverse of compact form
+   * \return diagonal value of initial matrix for compact form or its inverse
+   */
+  inline double const scale_(bool inverse) const { return ((type_.compare("DFP") == 0) != inverse) ? 1.0 / initial_diagonal_value_ : initial_diagonal_value_; };
+  /**
+   * Cross product for compact form
+   * \param[in] i is pair index
+   * \param[in] j is pair index
+   * \return s_i'*y_j (BFGS) or y_i'*s_j (DFP)
+   */
+  inline double const crossProduct_(int i,
+                                    int j) const
+  {
+    return (type_.compare("DFP") == 0) ? inner_products_sy_[storage_(j) * history_ + storage_(i)] : inner_products_sy_[storage_(i) * history_ + storage_(j)];
+  };
   //@}
 
 }; // end SymmetricMatrixLimitedMemory
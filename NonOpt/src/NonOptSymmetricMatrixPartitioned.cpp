@@ -0,0 +1,783 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <algorithm>
+#include <cmath>
+
+#include "NonOptSymmetricMatrixPartitioned.hpp"
+#include "NonOptBLASLAPACK.hpp"
+#include "NonOptDeclarations.hpp"
+#include "NonOptDefinitions.hpp"
+
+namespace NonOpt
+{
+
+// Add options
+void SymmetricMatrixPartitioned::addOptions(Options* options)
+{
+
+  // Add double options
+  options->addDoubleOption("SMP_product_tolerance",
+                           1e-20,
+                           0.0,
+                           NONOPT_DOUBLE_INFINITY,
+                           "Tolerance for allowing an element update to occur.  If the inner\n"
+                           "              product between the restrictions of the iterate and gradient\n"
+                           "              displacements to an element is at least this tolerance times\n"
+                           "              the product of their 2-norms, then the element update occurs;\n"
+                           "              else, it is skipped.\n"
+                           "Default     : 1e-20.");
+
+  // Add integer options
+  options->addIntegerOption("SMP_bandwidth",
+                            1,
+                            1,
+                            NONOPT_INT_INFINITY,
+                            "Number of variables following the first in each index set of the\n"
+                            "              default element decomposition, i.e., the one used if the\n"
+                            "              problem does not provide one.\n"
+                            "Default     : 1.");
+
+} // end addOptions
+
+// Set options
+void SymmetricMatrixPartitioned::setOptions(Options* options)
+{
+
+  // Read double options
+  options->valueAsDouble("SMP_product_tolerance", product_tolerance_);
+
+  // Read integer options
+  options->valueAsInteger("SMP_bandwidth", bandwidth_);
+
+  // Read string options
+  options->valueAsString("approximate_hessian_update", type_);
+
+} // end setOptions
+
+// Initialize
+void SymmetricMatrixPartitioned::initialize(const Options* options,
+                                            Quantities* quantities,
+                                            const Reporter* reporter)
+{
+
+  // Get element decomposition from problem (default if not available)
+  std::vector<std::vector<int>> elements;
+  if (quantities->currentIterate() == nullptr ||
+      !quantities->currentIterate()->problem()->elementDecomposition(quantities->numberOfVariables(), elements)) {
+    elements.clear();
+  }
+
+  // Set element decomposition
+  setElements(quantities->numberOfVariables(), elements);
+
+  // Set as identity
+  setAsDiagonal(quantities->numberOfVariables(), 1.0);
+
+} // end initialize
+
+// Column
+void const SymmetricMatrixPartitioned::column(int column_index,
+                                              Vector& column)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
+  ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
+  ASSERT_EXCEPTION(size_ == column.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column has incorrect length.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Initialize column
+  column.setLength(size_);
+
+  // Set elements in row of column index (left of and on diagonal)
+  for (int i = first_[column_index]; i <= column_index; i++) {
+    column.set(i, values_[envelope_(column_index, i)]);
+  }
+
+  // Set elements in rows below column index whose envelopes include it
+  for (int i = column_index + 1; i < size_; i++) {
+    if (first_[i] <= column_index) {
+      column.set(i, values_[envelope_(i, column_index)]);
+    }
+  } // end for
+
+} // end column
+
+// Column of inverse
+void const SymmetricMatrixPartitioned::columnOfInverse(int column_index,
+                                                       Vector& column)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
+  ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
+  ASSERT_EXCEPTION(size_ == column.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column has incorrect length.");
+
+  // Find computed column
+  auto computed_column = computed_columns_of_inverse_.find(column_index);
+
+  // Compute column
+  if (computed_column != computed_columns_of_inverse_.end()) {
+    column.copy(*computed_column->second);
+  }
+  else {
+
+    // Assemble and factorize, if needed
+    if (!factorized_) {
+      factorize();
+    }
+
+    // Set unit vector
+    column.setLength(size_);
+    column.set(column_index, 1.0);
+
+    // Solve with factorization
+    solveWithFactor(column.valuesModifiable());
+    solveWithFactorTranspose(column.valuesModifiable());
+
+    // Save column
+    computed_columns_of_inverse_[column_index] = column.makeNewCopy();
+
+  } // end else
+
+} // end columnOfInverse
+
+// Element
+double const SymmetricMatrixPartitioned::element(int row_index,
+                                                 int column_index)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(row_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Row index is negative.");
+  ASSERT_EXCEPTION(row_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Row index is too large.");
+  ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
+  ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Set lower triangle indices
+  int i = std::max(row_index, column_index);
+  int j = std::min(row_index, column_index);
+
+  // Return element (zero if outside envelope)
+  return (j >= first_[i]) ? values_[envelope_(i, j)] : 0.0;
+
+} // end element
+
+// Element of inverse
+double const SymmetricMatrixPartitioned::elementOfInverse(int row_index,
+                                                          int column_index)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(row_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Row index is negative.");
+  ASSERT_EXCEPTION(row_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Row index is too large.");
+  ASSERT_EXCEPTION(column_index >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is negative.");
+  ASSERT_EXCEPTION(column_index < size_, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Column index is too large.");
+
+  // Check for element in a computed column
+  auto computed_column = computed_columns_of_inverse_.find(column_index);
+  if (computed_column != computed_columns_of_inverse_.end()) {
+    return computed_column->second->values()[row_index];
+  }
+  computed_column = computed_columns_of_inverse_.find(row_index);
+  if (computed_column != computed_columns_of_inverse_.end()) {
+    return computed_column->second->values()[column_index];
+  }
+
+  // Compute (and save) column
+  Vector column(size_, 0.0);
+  columnOfInverse(column_index, column);
+
+  // Return element
+  return column.values()[row_index];
+
+} // end elementOfInverse
+
+// Inner product
+double SymmetricMatrixPartitioned::innerProduct(const Vector& vector)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
+
+  // Compute matrix-vector product
+  Vector product(size_);
+  matrixVectorProduct(vector, product);
+
+  // Return inner product
+  return vector.innerProduct(product);
+
+} // end innerProduct
+
+// Inner product of inverse
+double SymmetricMatrixPartitioned::innerProductOfInverse(const Vector& vector)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Solve with factor
+  Vector solution(size_);
+  solution.copy(vector);
+  solveWithFactor(solution.valuesModifiable());
+
+  // Return inner product
+  return solution.innerProduct(solution);
+
+} // end innerProductOfInverse
+
+// Inner products of inverse
+void SymmetricMatrixPartitioned::innerProductsOfInverse(int number_of_columns,
+                                                        double* matrix,
+                                                        double* product)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(number_of_columns >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Number of columns is negative.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Solve with factor for each column
+  std::vector<double> solutions(matrix, matrix + (size_t)size_ * number_of_columns);
+  for (int j = 0; j < number_of_columns; j++) {
+    solveWithFactor(&solutions[(size_t)j * size_]);
+  }
+
+  // Set inputs for BLASLAPACK
+  char transpose = 'T';
+  char no_transpose = 'N';
+  double one = 1.0;
+  double zero = 0.0;
+
+  // Compute inner products of solutions
+  dgemm_(&transpose, &no_transpose, &number_of_columns, &number_of_columns, &size_, &one, solutions.data(), &size_, solutions.data(), &size_, &zero, product, &number_of_columns);
+
+} // end innerProductsOfInverse
+
+// Matrix-vector product
+void SymmetricMatrixPartitioned::matrixVectorProduct(const Vector& vector,
+                                                     Vector& product)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
+  ASSERT_EXCEPTION(size_ == product.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Product has incorrect length.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Initialize product
+  product.setLength(size_);
+  double* product_values = product.valuesModifiable();
+
+  // Set input for BLASLAPACK
+  int increment = 1;
+
+  // Loop through rows
+  for (int i = 0; i < size_; i++) {
+
+    // Set input for BLASLAPACK
+    int length = i - first_[i];
+    double value = vector.values()[i];
+
+    // Add products with elements left of diagonal (as row i and as column i)
+    if (length > 0) {
+      product_values[i] += ddot_(&length, &values_[row_offsets_[i]], &increment, &vector.values()[first_[i]], &increment);
+      daxpy_(&length, &value, &values_[row_offsets_[i]], &increment, &product_values[first_[i]], &increment);
+    } // end if
+
+    // Add product with diagonal element
+    product_values[i] += values_[envelope_(i, i)] * value;
+
+  } // end for
+
+} // end matrixVectorProduct
+
+// Matrix-vector product of inverse
+void SymmetricMatrixPartitioned::matrixVectorProductOfInverse(const Vector& vector,
+                                                              Vector& product)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(size_ == vector.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector has incorrect length.");
+  ASSERT_EXCEPTION(size_ == product.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Product has incorrect length.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Solve with factorization
+  product.copy(vector);
+  solveWithFactor(product.valuesModifiable());
+  solveWithFactorTranspose(product.valuesModifiable());
+
+} // end matrixVectorProductOfInverse
+
+// Matrix-matrix product of inverse
+void SymmetricMatrixPartitioned::matrixMatrixProductOfInverse(int number_of_columns,
+                                                              double* matrix,
+                                                              double* product)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(number_of_columns >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Number of columns is negative.");
+
+  // Assemble and factorize, if needed
+  if (!factorized_) {
+    factorize();
+  }
+
+  // Set inputs for BLASLAPACK
+  int length = size_ * number_of_columns;
+  int increment = 1;
+
+  // Copy matrix
+  dcopy_(&length, matrix, &increment, product, &increment);
+
+  // Solve with factorization for each column
+  for (int j = 0; j < number_of_columns; j++) {
+    solveWithFactor(&product[j * size_]);
+    solveWithFactorTranspose(&product[j * size_]);
+  } // end for
+
+} // end matrixMatrixProductOfInverse
+
+// Set as diagonal matrix
+void SymmetricMatrixPartitioned::setAsDiagonal(int size,
+                                               double value)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(value > 0.0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Value is nonpositive.");
+
+  // Increment modification counter
+  incrementModificationCounter();
+
+  // Set default element decomposition if size changed
+  if (size_ != size) {
+    setElements(size, std::vector<std::vector<int>>());
+  }
+
+  // Initialize element values
+  std::fill(element_values_.begin(), element_values_.end(), 0.0);
+
+  // Set diagonals of element matrices (weighted so that sum is diagonal with given value)
+  for (int e = 0; e < (int)elements_.size(); e++) {
+    int element_size = (int)elements_[e].size();
+    for (int i = 0; i < element_size; i++) {
+      element_values_[element_offsets_[e] + i * element_size + i] = value * weights_[elements_[e][i]];
+    }
+  } // end for
+
+  // Set factorization indicator
+  factorized_ = false;
+
+  // Clear computed columns
+  computed_columns_of_inverse_.clear();
+
+} // end setAsDiagonal
+
+// Set element decomposition
+void SymmetricMatrixPartitioned::setElements(int size,
+                                             const std::vector<std::vector<int>>& elements)
+{
+
+  // Assert
+  ASSERT_EXCEPTION(size >= 0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Size is negative.");
+
+  // Set index sets (sorted, without duplicates), or sets of consecutive variables if none given
+  std::vector<std::vector<int>> sets;
+  if (elements.size() > 0) {
+    for (int e = 0; e < (int)elements.size(); e++) {
+      std::vector<int> set = elements[e];
+      std::sort(set.begin(), set.end());
+      set.erase(std::unique(set.begin(), set.end()), set.end());
+      ASSERT_EXCEPTION(set.size() == 0 || (set.front() >= 0 && set.back() < size), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Element index is out of range.");
+      if (set.size() > 0) {
+        sets.push_back(set);
+      }
+    } // end for
+  }   // end if
+  else {
+    for (int i = 0; i == 0 || i + bandwidth_ < size; i++) {
+      std::vector<int> set;
+      for (int j = i; j <= i + bandwidth_ && j < size; j++) {
+        set.push_back(j);
+      }
+      if (set.size() > 0) {
+        sets.push_back(set);
+      }
+    } // end for
+  }   // end else
+
+  // Count sets containing each variable, adding singletons for variables in no set
+  std::vector<int> count(size, 0);
+  for (int e = 0; e < (int)sets.size(); e++) {
+    for (int i = 0; i < (int)sets[e].size(); i++) {
+      count[sets[e][i]]++;
+    }
+  } // end for
+  for (int i = 0; i < size; i++) {
+    if (count[i] == 0) {
+      sets.push_back(std::vector<int>(1, i));
+      count[i] = 1;
+    }
+  } // end for
+
+  // Check for unchanged decomposition
+  if (size_ == size && sets == elements_) {
+    return;
+  }
+
+  // Set size and index sets
+  size_ = size;
+  elements_.swap(sets);
+
+  // Set weights
+  weights_.resize(size_);
+  for (int i = 0; i < size_; i++) {
+    weights_[i] = 1.0 / (double)count[i];
+  }
+
+  // Set element offsets and values
+  element_offsets_.resize(elements_.size());
+  int length = 0;
+  for (int e = 0; e < (int)elements_.size(); e++) {
+    element_offsets_[e] = length;
+    length += (int)(elements_[e].size() * elements_[e].size());
+  } // end for
+  element_values_.assign(length, 0.0);
+
+  // Set envelope, i.e., first column coupled to each row
+  first_.resize(size_);
+  for (int i = 0; i < size_; i++) {
+    first_[i] = i;
+  }
+  for (int e = 0; e < (int)elements_.size(); e++) {
+    for (int i = 0; i < (int)elements_[e].size(); i++) {
+      first_[elements_[e][i]] = std::min(first_[elements_[e][i]], elements_[e][0]);
+    }
+  } // end for
+
+  // Set row offsets, values, and factor
+  row_offsets_.resize(size_ + 1);
+  row_offsets_[0] = 0;
+  for (int i = 0; i < size_; i++) {
+    row_offsets_[i + 1] = row_offsets_[i] + (i - first_[i] + 1);
+  }
+  values_.assign(row_offsets_[size_], 0.0);
+  factor_.assign(row_offsets_[size_], 0.0);
+
+  // Set factorization indicator
+  factorized_ = false;
+
+  // Clear computed columns
+  computed_columns_of_inverse_.clear();
+
+} // end setElements
+
+// Update
+void SymmetricMatrixPartitioned::update(const Vector& s,
+                                        const Vector& y)
+{
+
+  // Asserts
+  ASSERT_EXCEPTION(size_ == s.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector s has incorrect length.");
+  ASSERT_EXCEPTION(size_ == y.length(), NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Vector y has incorrect length.");
+
+  // Increment modification counter
+  incrementModificationCounter();
+
+  // Call appropriate update method
+  if (type_.compare("BFGS") == 0) {
+    updateBFGS(s, y);
+  }
+  else if (type_.compare("DFP") == 0) {
+    updateDFP(s, y);
+  }
+
+  // Set factorization indicator
+  factorized_ = false;
+
+  // Clear computed columns
+  computed_columns_of_inverse_.clear();
+
+} // end update
+
+// Symmetric update
+void SymmetricMatrixPartitioned::updateBFGS(const Vector& s,
+                                            const Vector& y)
+{
+
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'L';
+  double scale1 = 1.0;
+  int increment = 1;
+  double scale2 = 0.0;
+  int flag = 0;
+
+  // Declare restricted vectors and element matrix copies
+  std::vector<double> se, ye, Hs, previous, factor;
+
+  // Loop through elements
+  for (int e = 0; e < (int)elements_.size(); e++) {
+
+    // Set restricted vectors (with weighted "y")
+    int element_size = (int)elements_[e].size();
+    se.resize(element_size);
+    ye.resize(element_size);
+    Hs.resize(element_size);
+    for (int i = 0; i < element_size; i++) {
+      se[i] = s.values()[elements_[e][i]];
+      ye[i] = weights_[elements_[e][i]] * y.values()[elements_[e][i]];
+    } // end for
+
+    // Declare scalars
+    double sy = ddot_(&element_size, se.data(), &increment, ye.data(), &increment);
+    double sn = dnrm2_(&element_size, se.data(), &increment);
+    double yn = dnrm2_(&element_size, ye.data(), &increment);
+
+    // Check for skipped element update
+    if (sy <= 0.0 || sy < product_tolerance_ * sn * yn) {
+      continue;
+    }
+
+    // Save element matrix
+    double* values = &element_values_[element_offsets_[e]];
+    previous.assign(values, values + element_size * element_size);
+
+    // Compute matrix-vector product
+    dsymv_(&upper_lower, &element_size, &scale1, values, &element_size, se.data(), &increment, &scale2, Hs.data(), &increment);
+
+    // Declare scalar
+    double sHs = ddot_(&element_size, se.data(), &increment, Hs.data(), &increment);
+
+    // Check for skipped element update
+    if (sHs <= 0.0) {
+      continue;
+    }
+
+    // Set scale
+    double scale = -1.0 / sHs;
+
+    // Perform symmetric rank-1 update (to add -H*s*s'*H/(s'*H*s))
+    dsyr_(&upper_lower, &element_size, &scale, Hs.data(), &increment, values, &element_size);
+
+    // Set scale
+    scale = 1.0 / sy;
+
+    // Perform symmetric rank-1 update (to add y*y'/(s'*y))
+    dsyr_(&upper_lower, &element_size, &scale, ye.data(), &increment, values, &element_size);
+
+    // Check positive definiteness (which may be lost due to cancellation), restoring element matrix if lost
+    factor.assign(values, values + element_size * element_size);
+    dpotrf_(&upper_lower, &element_size, factor.data(), &element_size, &flag);
+    if (flag != 0) {
+      std::copy(previous.begin(), previous.end(), values);
+    }
+
+  } // end for
+
+} // end updateBFGS
+
+// Symmetric update
+void SymmetricMatrixPartitioned::updateDFP(const Vector& s,
+                                           const Vector& y)
+{
+
+  // Set inputs for BLASLAPACK
+  char upper_lower = 'L';
+  double scale1 = 1.0;
+  int increment = 1;
+  double scale2 = 0.0;
+  int flag = 0;
+
+  // Declare restricted vectors and element matrix copies
+  std::vector<double> se, ye, Hs, previous, factor;
+
+  // Loop through elements
+  for (int e = 0; e < (int)elements_.size(); e++) {
+
+    // Set restricted vectors (with weighted "y")
+    int element_size = (int)elements_[e].size();
+    se.resize(element_size);
+    ye.resize(element_size);
+    Hs.resize(element_size);
+    for (int i = 0; i < element_size; i++) {
+      se[i] = s.values()[elements_[e][i]];
+      ye[i] = weights_[elements_[e][i]] * y.values()[elements_[e][i]];
+    } // end for
+
+    // Declare scalars
+    double sy = ddot_(&element_size, se.data(), &increment, ye.data(), &increment);
+    double sn = dnrm2_(&element_size, se.data(), &increment);
+    double yn = dnrm2_(&element_size, ye.data(), &increment);
+
+    // Check for skipped element update
+    if (sy <= 0.0 || sy < product_tolerance_ * sn * yn) {
+      continue;
+    }
+
+    // Save element matrix
+    double* values = &element_values_[element_offsets_[e]];
+    previous.assign(values, values + element_size * element_size);
+
+    // Compute matrix-vector product
+    dsymv_(&upper_lower, &element_size, &scale1, values, &element_size, se.data(), &increment, &scale2, Hs.data(), &increment);
+
+    // Declare scalar
+    double sHs = ddot_(&element_size, se.data(), &increment, Hs.data(), &increment);
+
+    // Set scale
+    double scale = (1.0 + sHs / sy) / sy;
+
+    // Perform symmetric rank-1 update (to add (1+sHs/sy)/sy*y*y')
+    dsyr_(&upper_lower, &element_size, &scale, ye.data(), &increment, values, &element_size);
+
+    // Set scale
+    scale = -(1.0 / sy);
+
+    // Perform symmetric rank-2 update (to add -(1/sy)*y*Hs'-(1/sy)*Hs*y')
+    dsyr2_(&upper_lower, &element_size, &scale, ye.data(), &increment, Hs.data(), &increment, values, &element_size);
+
+    // Check positive definiteness (which may be lost due to cancellation), restoring element matrix if lost
+    factor.assign(values, values + element_size * element_size);
+    dpotrf_(&upper_lower, &element_size, factor.data(), &element_size, &flag);
+    if (flag != 0) {
+      std::copy(previous.begin(), previous.end(), values);
+    }
+
+  } // end for
+
+} // end updateDFP
+
+// Factorize
+void SymmetricMatrixPartitioned::factorize()
+{
+
+  // Initialize assembled values
+  std::fill(values_.begin(), values_.end(), 0.0);
+
+  // Assemble lower triangles of element matrices (indices in sets are increasing)
+  for (int e = 0; e < (int)elements_.size(); e++) {
+    int element_size = (int)elements_[e].size();
+    for (int j = 0; j < element_size; j++) {
+      for (int i = j; i < element_size; i++) {
+        values_[envelope_(elements_[e][i], elements_[e][j])] += element_values_[element_offsets_[e] + j * element_size + i];
+      }
+    } // end for
+  }   // end for
+
+  // Copy assembled values
+  factor_ = values_;
+
+  // Set input for BLASLAPACK
+  int increment = 1;
+
+  // Compute Cholesky factorization, row by row
+  for (int i = 0; i < size_; i++) {
+
+    // Compute elements left of diagonal
+    for (int j = first_[i]; j < i; j++) {
+      int start = std::max(first_[i], first_[j]);
+      int length = j - start;
+      double sum = (length > 0) ? ddot_(&length, &factor_[envelope_(i, start)], &increment, &factor_[envelope_(j, start)], &increment) : 0.0;
+      factor_[envelope_(i, j)] = (factor_[envelope_(i, j)] - sum) / factor_[envelope_(j, j)];
+    } // end for
+
+    // Compute diagonal element
+    int length = i - first_[i];
+    double sum = (length > 0) ? ddot_(&length, &factor_[row_offsets_[i]], &increment, &factor_[row_offsets_[i]], &increment) : 0.0;
+    double diagonal = factor_[envelope_(i, i)] - sum;
+
+    // Assert
+    ASSERT_EXCEPTION(diagonal > 0.0, NONOPT_SYMMETRIC_MATRIX_ASSERT_EXCEPTION, "Symmetric matrix assert failed.  Matrix is not positive definite.");
+
+    // Set diagonal element
+    factor_[envelope_(i, i)] = sqrt(diagonal);
+
+  } // end for
+
+  // Set factorization indicator
+  factorized_ = true;
+
+} // end factorize
+
+// Solve with factor
+void SymmetricMatrixPartitioned::solveWithFactor(double* vector)
+{
+
+  // Set input for BLASLAPACK
+  int increment = 1;
+
+  // Forward substitution
+  for (int i = 0; i < size_; i++) {
+    int length = i - first_[i];
+    double sum = (length > 0) ? ddot_(&length, &factor_[row_offsets_[i]], &increment, &vector[first_[i]], &increment) : 0.0;
+    vector[i] = (vector[i] - sum) / factor_[envelope_(i, i)];
+  } // end for
+
+} // end solveWithFactor
+
+// Solve with factor transpose
+void SymmetricMatrixPartitioned::solveWithFactorTranspose(double* vector)
+{
+
+  // Set input for BLASLAPACK
+  int increment = 1;
+
+  // Backward substitution (by columns of transpose)
+  for (int i = size_ - 1; i >= 0; i--) {
+    vector[i] = vector[i] / factor_[envelope_(i, i)];
+    int length = i - first_[i];
+    double scale = -vector[i];
+    if (length > 0) {
+      daxpy_(&length, &scale, &factor_[row_offsets_[i]], &increment, &vector[first_[i]], &increment);
+    }
+  } // end for
+
+} // end solveWithFactorTranspose
+
+// Print
+void SymmetricMatrixPartitioned::print(const Reporter* reporter,
+                                       std::string name) const
+{
+
+  // Print element matrices
+  for (int e = 0; e < (int)elements_.size(); e++) {
+    int element_size = (int)elements_[e].size();
+    for (int i = 0; i < element_size; i++) {
+      for (int j = 0; j < element_size; j++) {
+        double value = (i >= j) ? element_values_[element_offsets_[e] + j * element_size + i] : element_values_[element_offsets_[e] + i * element_size + j];
+        reporter->printf(R_NL, R_BASIC, "%s %6d-th element: [%6d][%6d]=%+23.16e\n", name.c_str(), e, elements_[e][i], elements_[e][j], value);
+        reporter->printf(R_QP, R_BASIC, "%s %6d-th element: [%6d][%6d]=%+23.16e\n", name.c_str(), e, elements_[e][i], elements_[e][j], value);
+      } // end for
+    }   // end for
+  }     // end for
+
+} // end print
+
+} // namespace NonOpt
@@ -0,0 +1,282 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTSYMMETRICMATRIXPARTITIONED_HPP__
+#define __NONOPTSYMMETRICMATRIXPARTITIONED_HPP__
+
+#include <unordered_map>
+
+#include "NonOptSymmetricMatrix.hpp"
+
+namespace NonOpt
+{
+
+/**
+ * SymmetricMatrixPartitioned class
+ * (The matrix is the sum of small dense element matrices, one per index set of the element
+ *  decomposition provided by the problem, or of index sets of consecutive variables if none
+ *  is provided.  Each element matrix is updated with the restriction of "s" and of "y",
+ *  scaled by the reciprocal of the number of sets containing each variable, so that the
+ *  sum satisfies the secant equation when all element updates are performed.  The sum is
+ *  assembled in envelope (skyline) form, i.e., row i holds the elements from the first
+ *  column coupled to i through the diagonal, and products with the inverse are computed
+ *  with a Cholesky factorization in the same form, which is recomputed after any
+ *  modification.  For banded coupling, storage and products are O(number of rows).)
+ */
+class SymmetricMatrixPartitioned : public SymmetricMatrix
+{
+
+public:
+  /** @name Constructors */
+  //@{
+  /**
+   * Construct SymmetricMatrixPartitioned
+   */
+  SymmetricMatrixPartitioned()
+    : factorized_(false),
+      size_(-1),
+      bandwidth_(1),
+      product_tolerance_(1e-20)
+  {
+    computed_columns_of_inverse_.clear();
+  };
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Delete data
+   */
+  ~SymmetricMatrixPartitioned(){};
+  //@}
+
+  /** @name Options handling methods */
+  //@{
+  /**
+   * Add options
+   * \param[in,out] options is pointer to Options object from NonOpt
+   */
+  void addOptions(Options* options);
+  /**
+   * Set options
+   * \param[in] options is pointer to Options object from NonOpt
+   */
+  void setOptions(Options* options);
+  //@}
+
+  /** @name Initialization method */
+  //@{
+  /**
+   * Initialize strategy
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in,out] quantities is pointer to Quantities object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   */
+  void initialize(const Options* options,
+                  Quantities* quantities,
+                  const Reporter* reporter);
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Get column of symmetric matrix
+   * \param[in] index is index of column to return
+   * \param[out] column is Vector to store column values
+   */
+  void const column(int column_index,
+                    Vector& column);
+  /**
+   * Get column of symmetric matrix inverse
+   * \param[in] index is index of column to return
+   * \param[out] column is Vector to store column values
+   */
+  void const columnOfInverse(int column_index,
+                             Vector& column);
+  /**
+   * Get element of symmetric matrix
+   * \param[in] row_index is row index number
+   * \param[in] column_index is column index number
+   * \return (row_index,column_index) element of matrix
+   */
+  double const element(int row_index,
+                       int column_index);
+  /**
+   * Get element of symmetric matrix inverse
+   * \param[in] row_index is row index number
+   * \param[in] column_index is column index number
+   * \return (row_index,column_index) element of matrix
+   */
+  double const elementOfInverse(int row_index,
+                                int column_index);
+  /**
+   * Get inner product of symmetric matrix with vector
+   * \param[in] vector is reference to a Vector
+   * \return inner product of vector with this vector
+   */
+  double innerProduct(const Vector& vector);
+  /**
+   * Get inner product of symmetric matrix inverse with vector
+   * \param[in] vector is reference to a Vector
+   * \return inner product of vector with this vector
+   */
+  double innerProductOfInverse(const Vector& vector);
+  /**
+   * Get inner products of symmetric matrix inverse with columns of matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store matrix'*inverse*matrix (column-major, number_of_columns squared)
+   */
+  void innerProductsOfInverse(int number_of_columns,
+                              double* matrix,
+                              double* product);
+  /**
+   * Get product of symmetric matrix with vector
+   * \param[in] vector is reference to a Vector
+   * \param[out] product is Vector to store product values
+   */
+  void matrixVectorProduct(const Vector& vector,
+                           Vector& product);
+  /**
+   * Get product of symmetric matrix inverse with vector
+   * \param[in] vector is reference to a Vector
+   * \param[out] product is Vector to store product values
+   */
+  void matrixVectorProductOfInverse(const Vector& vector,
+                                    Vector& product);
+  /**
+   * Get product of symmetric matrix inverse with matrix
+   * \param[in] number_of_columns is number of columns of matrix
+   * \param[in] matrix is array of matrix values (column-major, with number of rows equal to size)
+   * \param[out] product is array to store product values (column-major, same size as matrix)
+   */
+  void matrixMatrixProductOfInverse(int number_of_columns,
+                                    double* matrix,
+                                    double* product);
+  /**
+   * Get name of strategy
+   * \return string with name of strategy
+   */
+  std::string name() { return "Partitioned"; };
+  /**
+   * Get number of elements, i.e., of index sets
+   * \return number of elements
+   */
+  inline int const numberOfElements() const { return (int)elements_.size(); };
+  /**
+   * Get number of rows
+   * \return number of rows of the matrix
+   */
+  inline int const size() const { return size_; };
+  //@}
+
+  /** @name Modify methods */
+  //@{
+  /**
+   * Set as diagonal matrix
+   * \param[in] size is size of matrix to create
+   * \param[in] value is value to set in diagonal elements (and set all else zero)
+   */
+  void setAsDiagonal(int size,
+                     double value);
+  /**
+   * Set element decomposition (keeping values if decomposition is unchanged)
+   * \param[in] size is size of matrix
+   * \param[in] elements is vector of index sets (variables in no set are added as singletons)
+   */
+  void setElements(int size,
+                   const std::vector<std::vector<int>>& elements);
+  /**
+   * Update approximation
+   * \param[in] s is reference to Vector representing iteration displacement
+   * \param[in] y is reference to Vector representing gradient displacement
+   */
+  void update(const Vector& s,
+              const Vector& y);
+  //@}
+
+  /** @name Print methods */
+  //@{
+  /**
+   * Print array
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   * \param[in] name is name of Symmetric Matrix to print
+   */
+  void print(const Reporter* reporter,
+             std::string name) const;
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  SymmetricMatrixPartitioned(const SymmetricMatrixPartitioned&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const SymmetricMatrixPartitioned&);
+  //@}
+
+  /** @name Private members */
+  //@{
+  bool factorized_;                                                  /**< Bool indicating if assembly and factorization have been performed */
+  int size_;                                                         /**< Number of rows and number of columns */
+  int bandwidth_;                                                    /**< Number of variables after first in default index sets */
+  double product_tolerance_;                                         /**< Tolerance for performing element updates */
+  std::vector<std::vector<int>> elements_;                           /**< Vector of index sets (sorted) */
+  std::vector<int> element_offsets_;                                 /**< Integer vector, offsets of element matrices in element values */
+  std::vector<double> element_values_;                               /**< Double vector, element matrices (column-major) */
+  std::vector<double> weights_;                                      /**< Double vector, reciprocals of numbers of sets containing variables */
+  std::vector<int> first_;                                           /**< Integer vector, first column in envelope of each row */
+  std::vector<int> row_offsets_;                                     /**< Integer vector, offsets of rows in envelope */
+  std::vector<double> values_;                                       /**< Double vector, assembled matrix (envelope of lower triangle) */
+  std::vector<double> factor_;                                       /**< Double vector, Cholesky factor (envelope of lower triangle) */
+  std::unordered_map<int, std::shared_ptr<Vector>> computed_columns_of_inverse_; /**< Map, computed columns of inverse by column index */
+  //@}
+
+  /** @name Private methods */
+  //@{
+  /**
+   * Assemble matrix and compute Cholesky factorization
+   */
+  void factorize();
+  /**
+   * Solve with factor, i.e., overwrite vector with factor inverse times vector
+   * \param[in,out] vector is array of length size
+   */
+  void solveWithFactor(double* vector);
+  /**
+   * Solve with factor transpose, i.e., overwrite vector with factor transpose inverse times vector
+   * \param[in,out] vector is array of length size
+   */
+  void solveWithFactorTranspose(double* vector);
+  void updateBFGS(const Vector& s,
+                  const Vector& y);
+  void updateDFP(const Vector& s,
+                 const Vector& y);
+  //@}
+
+  /** @name Indexing methods */
+  //@{
+  /**
+   * Envelope array index
+   * \param[in] row_index is row index number
+   * \param[in] column_index is column index number (at least first in envelope of row, at most row_index)
+   * \return envelope array index corresponding to (row_index,column_index)
+   */
+  inline int const envelope_(int row_index,
+                             int column_index) const { return row_offsets_[row_index] + column_index - first_[row_index]; };
+  //@}
+
+}; // end SymmetricMatrixPartitioned
+
+} // namespace NonOpt
+
+#endif /* __NONOPTSYMMETRICMATRIXPARTITIONED_HPP__ */
@@ -159,6 +159,21 @@ public:
                                                    Quantities* quantities,
                                                    const Reporter* reporter,
                                                    Strategies* strategies) = 0;
+  /**
+   * Start checks that may run asynchronously (at beginning of iteration)
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in] quantities is pointer to Quantities object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   * \param[in] strategies is pointer to Strategies object from NonOpt
+   */
+  virtual void startConditions(const Options* options,
+                               Quantities* quantities,
+                               const Reporter* reporter,
+                               Strategies* strategies) = 0;
+  /**
+   * Wait for checks started asynchronously, discarding results (e.g., after an exception)
+   */
+  virtual void joinConditions() = 0;
   //@}
 
 protected:
@@ -107,6 +107,21 @@ public:
                                            Quantities* quantities,
                                            const Reporter* reporter,
                                            Strategies* strategies);
+  /**
+   * Start checks that may run asynchronously (none for this strategy)
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in] quantities is pointer to Quantities object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   * \param[in] strategies is pointer to Strategies object from NonOpt
+   */
+  void startConditions(const Options* options,
+                       Quantities* quantities,
+                       const Reporter* reporter,
+                       Strategies* strategies){};
+  /**
+   * Wait for checks started asynchronously (none for this strategy)
+   */
+  void joinConditions(){};
   //@}
 
 private:
@@ -15,6 +15,13 @@ void TerminationSecondQP::addOptions(Options* options)
 {
 
   // Add bool options
+  options->addBoolOption("TS_solve_QP_asynchronously",
+                         false,
+                         "Indicator for whether to solve QP on a worker thread, started at\n"
+                         "              the beginning of an iteration (with the point set at that\n"
+                         "              time) and joined when termination conditions are checked.\n"
+                         "              Output of the QP solver for this QP is suppressed.\n"
+                         "Default     : false.");
 
   // Add double options
   options->addDoubleOption("TS_objective_similarity_tolerance",
@@ -70,6 +77,7 @@ void TerminationSecondQP::setOptions(Options* options)
 {
 
   // Read bool options
+  options->valueAsBool("TS_solve_QP_asynchronously", solve_QP_asynchronously_);
 
   // Read double options
   options->valueAsDouble("TS_objective_similarity_tolerance", objective_similarity_tolerance_);
@@ -88,6 +96,9 @@ void TerminationSecondQP::initialize(const Options* options,
                                      const Reporter* reporter)
 {
 
+  // Wait for QP solve on worker thread
+  joinConditions();
+
   // Initialize counters
   objective_similarity_counter_ = 0;
   solve_QP_counter_ = 0;
@@ -127,11 +138,16 @@ void TerminationSecondQP::checkConditions(const Options* options,
   // Initialize solve boolean
   bool qp_solved = false;
 
-  // Solve QP
+  // Solve QP (or finish solve started on worker thread)
   if (solve_QP_counter_ % solve_QP_every_ == 0) {
     qp_solved = true;
-    solveQP(options, quantities, reporter, strategies);
-  }
+    if (qp_thread_.joinable()) {
+      finishQP(quantities, strategies);
+    }
+    else {
+      solveQP(options, quantities, reporter, strategies);
+    }
+  } // end if
 
   /////////////////////////////////
   // TERMINATION BY STATIONARITY //
@@ -240,110 +256,175 @@ void TerminationSecondQP::checkConditionsDirectionComputation(const Options* opt
 
 } // end checkConditionsDirectionComputation
 
-// Solve QP
-void TerminationSecondQP::solveQP(const Options* options,
-                                  Quantities* quantities,
-                                  const Reporter* reporter,
-                                  Strategies* strategies)
+// Finish QP solve started on worker thread
+void TerminationSecondQP::finishQP(Quantities* quantities,
+                                   Strategies* strategies)
 {
 
-  // Initialize values
-  strategies->qpSolverTermination()->setPrimalSolutionToZero();
+  // Join worker thread
+  qp_thread_.join();
+
+  // Rethrow exception from worker thread (e.g., time limit reached)
+  if (qp_exception_) {
+    std::exception_ptr exception = qp_exception_;
+    qp_exception_ = nullptr;
+    std::rethrow_exception(exception);
+  } // end if
+
+  // Reset QP iteration counter (after direction computation, as for serial solve)
   quantities->resetQPIterationCounter();
 
-  // try QP solve, terminate on any exception
-  try {
+  // Set QP solution
+  setQPSolution(quantities, strategies);
+
+} // end finishQP
+
+// Join conditions
+void TerminationSecondQP::joinConditions()
+{
+
+  // Join worker thread, discarding results
+  if (qp_thread_.joinable()) {
+    qp_thread_.join();
+  }
+  qp_exception_ = nullptr;
+
+} // end joinConditions
+
+// Set QP data
+void TerminationSecondQP::setQPData(const Options* options,
+                                    Quantities* quantities,
+                                    const Reporter* reporter,
+                                    Strategies* strategies)
+{
 
-    // Declare bool for evaluations
-    bool evaluation_success;
+  // Declare bool for evaluations
+  bool evaluation_success;
 
-    // Check whether to evaluate function with gradient
-    if (quantities->evaluateFunctionWithGradient()) {
+  // Check whether to evaluate function with gradient
+  if (quantities->evaluateFunctionWithGradient()) {
 
-      // Evaluate current objective
-      evaluation_success = quantities->currentIterate()->evaluateObjectiveAndGradient(*quantities);
+    // Evaluate current objective
+    evaluation_success = quantities->currentIterate()->evaluateObjectiveAndGradient(*quantities);
 
-      // Check for successful evaluation
-      if (!evaluation_success) {
-        THROW_EXCEPTION(TE_EVALUATION_FAILURE_EXCEPTION, "Termination check unsuccessful. Evaluation failed.");
-      }
+    // Check for successful evaluation
+    if (!evaluation_success) {
+      THROW_EXCEPTION(TE_EVALUATION_FAILURE_EXCEPTION, "Termination check unsuccessful. Evaluation failed.");
     }
-    else {
+  }
+  else {
+
+    // Evaluate current objective
+    evaluation_success = quantities->currentIterate()->evaluateObjective(*quantities);
 
-      // Evaluate current objective
-      evaluation_success = quantities->currentIterate()->evaluateObjective(*quantities);
+    // Check for successful evaluation
+    if (!evaluation_success) {
+      THROW_EXCEPTION(TE_EVALUATION_FAILURE_EXCEPTION, "Termination check unsuccessful. Evaluation failed.");
+    }
 
-      // Check for successful evaluation
-      if (!evaluation_success) {
-        THROW_EXCEPTION(TE_EVALUATION_FAILURE_EXCEPTION, "Termination check unsuccessful. Evaluation failed.");
-      }
+    // Evaluate current gradient
+    evaluation_success = quantities->currentIterate()->evaluateGradient(*quantities);
 
-      // Evaluate current gradient
-      evaluation_success = quantities->currentIterate()->evaluateGradient(*quantities);
+    // Check for successful evaluation
+    if (!evaluation_success) {
+      THROW_EXCEPTION(TE_EVALUATION_FAILURE_EXCEPTION, "Termination check unsuccessful. Evaluation failed.");
+    }
 
-      // Check for successful evaluation
-      if (!evaluation_success) {
-        THROW_EXCEPTION(TE_EVALUATION_FAILURE_EXCEPTION, "Termination check unsuccessful. Evaluation failed.");
-      }
+  } // end else
 
-    } // end else
+  // Set QP scalar values
+  strategies->qpSolverTermination()->setScalar(NONOPT_DOUBLE_INFINITY);
+  strategies->qpSolverTermination()->setInexactSolutionTolerance(quantities->stationarityRadius());
 
-    // Set QP scalar values
-    strategies->qpSolverTermination()->setScalar(NONOPT_DOUBLE_INFINITY);
-    strategies->qpSolverTermination()->setInexactSolutionTolerance(quantities->stationarityRadius());
+  // Declare QP quantities
+  std::vector<std::shared_ptr<Vector>> QP_gradient_list;
+  std::vector<double> QP_vector;
 
-    // Declare QP quantities
-    std::vector<std::shared_ptr<Vector>> QP_gradient_list;
-    std::vector<double> QP_vector;
+  // Add pointer to current gradient to list
+  QP_gradient_list.push_back(quantities->currentIterate()->gradient());
 
-    // Add pointer to current gradient to list
-    QP_gradient_list.push_back(quantities->currentIterate()->gradient());
+  // Add linear term value
+  QP_vector.push_back(quantities->currentIterate()->objective());
 
-    // Add linear term value
-    QP_vector.push_back(quantities->currentIterate()->objective());
+  // Declare points in stationarity radius
+  std::vector<std::shared_ptr<Point>> points_in_radius;
 
-    // Loop through point set
-    for (int point_count = 0; point_count < (int)quantities->pointSet()->size(); point_count++) {
+  // Find points within stationarity radius of current iterate
+  std::vector<int> indices_in_radius;
+  std::vector<double> distances_in_radius;
+  quantities->pointSet()->findPointsInRadius(*quantities->currentIterate()->vector(), quantities->stationarityRadius(), indices_in_radius, distances_in_radius);
 
-      // Create difference vector
-      std::shared_ptr<Vector> difference = quantities->currentIterate()->vector()->makeNewLinearCombination(1.0, -1.0, *(*quantities->pointSet())[point_count]->vector());
+  // Loop through points in stationarity radius
+  for (int point_count = 0; point_count < (int)indices_in_radius.size(); point_count++) {
+    points_in_radius.push_back((*quantities->pointSet())[indices_in_radius[point_count]]);
+  }
 
-      // Check distance between point and current iterate
-      if (difference->normInf() <= quantities->stationarityRadius()) {
+  // Declare evaluation success indicators
+  std::vector<bool> evaluation_success_batch;
 
-        // Evaluate gradient
-        evaluation_success = (*quantities->pointSet())[point_count]->evaluateGradient(*quantities);
+  // Evaluate gradients (as a batch)
+  Point::evaluateGradientBatch(points_in_radius, *quantities, evaluation_success_batch);
 
-        // Check for successful evaluation
-        if (evaluation_success) {
+  // Loop through points in stationarity radius
+  for (int point_count = 0; point_count < (int)points_in_radius.size(); point_count++) {
 
-          // Add pointer to gradient in point set to list
-          QP_gradient_list.push_back((*quantities->pointSet())[point_count]->gradient());
+    // Check for successful evaluation
+    if (evaluation_success_batch[point_count]) {
 
-          // Add linear term value
-          QP_vector.push_back(quantities->currentIterate()->objective());
+      // Add pointer to gradient in point set to list
+      QP_gradient_list.push_back(points_in_radius[point_count]->gradient());
 
-        } // end if
+      // Add linear term value
+      QP_vector.push_back(quantities->currentIterate()->objective());
 
-      } // end if
+    } // end if
 
-    } // end for
+  } // end for
 
-    // Set QP vector list and linear term
-    strategies->qpSolverTermination()->setVectorList(QP_gradient_list);
-    strategies->qpSolverTermination()->setVector(QP_vector);
+  // Set QP vector list and linear term
+  strategies->qpSolverTermination()->setVectorList(QP_gradient_list);
+  strategies->qpSolverTermination()->setVector(QP_vector);
 
-    // Solve QP
-    strategies->qpSolverTermination()->solveQP(options, reporter, quantities);
+} // end setQPData
+
+// Set QP solution
+void TerminationSecondQP::setQPSolution(Quantities* quantities,
+                                        Strategies* strategies)
+{
 
-    // Increment QP iteration counter
-    quantities->incrementQPIterationCounter(strategies->qpSolverTermination()->numberOfIterations());
+  // Increment QP iteration counter
+  quantities->incrementQPIterationCounter(strategies->qpSolverTermination()->numberOfIterations());
 
-    // Get primal solution
-    strategies->qpSolverTermination()->primalSolution(quantities->directionTermination()->valuesModifiable());
+  // Get primal solution
+  strategies->qpSolverTermination()->primalSolution(quantities->directionTermination()->valuesModifiable());
 
-    // Increment total QP iteration counter
-    quantities->incrementTotalQPIterationCounter();
+  // Increment total QP iteration counter
+  quantities->incrementTotalQPIterationCounter();
+
+} // end setQPSolution
+
+// Solve QP
+void TerminationSecondQP::solveQP(const Options* options,
+                                  Quantities* quantities,
+                                  const Reporter* reporter,
+                                  Strategies* strategies)
+{
+
+  // Initialize values
+  strategies->qpSolverTermination()->setPrimalSolutionToZero();
+  quantities->resetQPIterationCounter();
+
+  // try QP solve, terminate on any exception
+  try {
+
+    // Set QP data
+    setQPData(options, quantities, reporter, strategies);
+
+    // Solve QP
+    strategies->qpSolverTermination()->solveQP(options, reporter, quantities);
+
+    // Set QP solution
+    setQPSolution(quantities, strategies);
 
   } // end try
 
@@ -356,4 +437,46 @@ void TerminationSecondQP::solveQP(const Options* options,
 
 } // end solveQP
 
+// Start conditions
+void TerminationSecondQP::startConditions(const Options* options,
+                                          Quantities* quantities,
+                                          const Reporter* reporter,
+                                          Strategies* strategies)
+{
+
+  // Check whether to solve asynchronously and whether QP is solved in this iteration
+  if (!solve_QP_asynchronously_ || (solve_QP_counter_ + 1) % solve_QP_every_ != 0) {
+    return;
+  }
+
+  // Wait for any previous QP solve on worker thread
+  joinConditions();
+
+  // Initialize values
+  strategies->qpSolverTermination()->setPrimalSolutionToZero();
+
+  // Set QP data (evaluations and point set access are performed on this thread)
+  try {
+    setQPData(options, quantities, reporter, strategies);
+  }
+
+  // catch evaluation failure, in which case QP is solved (and failure reported) when conditions are checked
+  catch (TE_EVALUATION_FAILURE_EXCEPTION& exec) {
+    return;
+  }
+
+  // Launch worker thread
+  qp_thread_ = std::thread([this, options, quantities, strategies]() {
+
+    // try QP solve, store any exception for main thread
+    try {
+      strategies->qpSolverTermination()->solveQP(options, &qp_reporter_, quantities);
+    } catch (...) {
+      qp_exception_ = std::current_exception();
+    }
+
+  });
+
+} // end startConditions
+
 } // namespace NonOpt
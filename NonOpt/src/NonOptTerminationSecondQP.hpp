@@ -7,6 +7,9 @@
 #ifndef __NONOPTSYMMETRICTERMINATIONSECONDQP_HPP__
 #define __NONOPTSYMMETRICTERMINATIONSECONDQP_HPP__
 
+#include <exception>
+#include <thread>
+
 #include "NonOptTermination.hpp"
 
 namespace NonOpt
@@ -14,6 +17,10 @@ namespace NonOpt
 
 /**
  * TerminationSecondQP class
+ * (If the corresponding option is set, the termination QP is solved on a worker thread,
+ *  started at the beginning of an iteration with the point set at that time, concurrently
+ *  with the direction computation, and joined when conditions are checked.  The worker
+ *  uses the termination QP solver and matrix only, and does not print.)
  */
 class TerminationSecondQP : public Termination
 {
@@ -32,7 +39,7 @@ public:
   /**
    * Destruct
    */
-  ~TerminationSecondQP(){};
+  ~TerminationSecondQP() { joinConditions(); };
   //@}
 
   /** @name Options handling methods */
@@ -107,6 +114,21 @@ public:
                                            Quantities* quantities,
                                            const Reporter* reporter,
                                            Strategies* strategies);
+  /**
+   * Start QP solve on worker thread (if asynchronous and QP to be solved in this iteration)
+   * \param[in] options is pointer to Options object from NonOpt
+   * \param[in] quantities is pointer to Quantities object from NonOpt
+   * \param[in] reporter is pointer to Reporter object from NonOpt
+   * \param[in] strategies is pointer to Strategies object from NonOpt
+   */
+  void startConditions(const Options* options,
+                       Quantities* quantities,
+                       const Reporter* reporter,
+                       Strategies* strategies);
+  /**
+   * Wait for QP solve on worker thread, discarding results
+   */
+  void joinConditions();
 
   //@}
 
@@ -127,6 +149,7 @@ private:
 
   /** @name Private members */
   //@{
+  bool solve_QP_asynchronously_;
   int objective_similarity_counter_;
   int objective_similarity_limit_;
   int solve_QP_counter_;
@@ -136,10 +159,25 @@ private:
   double objective_tolerance_;
   double stationarity_reference_;
   double stationarity_tolerance_factor_;
+  /**
+   * Asynchronous QP solve quantities
+   * (Worker thread, exception thrown by QP solver on it, and Reporter without reports.)
+   */
+  std::thread qp_thread_;
+  std::exception_ptr qp_exception_;
+  Reporter qp_reporter_;
   //@}
 
   /** @name Private methods */
   //@{
+  void finishQP(Quantities* quantities,
+                Strategies* strategies);
+  void setQPData(const Options* options,
+                 Quantities* quantities,
+                 const Reporter* reporter,
+                 Strategies* strategies);
+  void setQPSolution(Quantities* quantities,
+                     Strategies* strategies);
   void solveQP(const Options* options,
                Quantities* quantities,
                const Reporter* reporter,
@@ -16,11 +16,13 @@ namespace NonOpt
 // Constructor with given length; values initialized to zero
 Vector::Vector(int length)
   : length_(length),
+    view_(false),
     max_computed_(false),
     min_computed_(false),
     norm1_computed_(false),
     norm2_computed_(false),
-    normInf_computed_(false)
+    normInf_computed_(false),
+    sparse_(false)
 {
 
   // Allocate array
@@ -32,13 +34,15 @@ Vector::Vector(int length)
 Vector::Vector(int length,
                double value)
   : length_(length),
+    view_(false),
     max_computed_(true),
     min_computed_(true),
     norm1_computed_(true),
     norm2_computed_(true),
     normInf_computed_(true),
     max_value_(value),
-    min_value_(value)
+    min_value_(value),
+    sparse_(false)
 {
 
   // Allocate array
@@ -58,13 +62,55 @@ Vector::Vector(int length,
 
 } // end constructor
 
+// Constructor with given length; values array drawn from pool
+Vector::Vector(int length,
+               std::shared_ptr<MemoryPool> pool)
+  : length_(length),
+    pool_(pool),
+    view_(false),
+    max_computed_(false),
+    min_computed_(false),
+    norm1_computed_(false),
+    norm2_computed_(false),
+    normInf_computed_(false),
+    sparse_(false)
+{
+
+  // Allocate array
+  if (pool_) {
+    values_ = pool_->allocateValues(length);
+  }
+  else {
+    values_ = new double[length];
+  }
+
+} // end constructor
+
+// Constructor as view of external array
+Vector::Vector(double* array,
+               int length)
+  : values_(array),
+    length_(length),
+    view_(true),
+    max_computed_(false),
+    min_computed_(false),
+    norm1_computed_(false),
+    norm2_computed_(false),
+    normInf_computed_(false),
+    sparse_(false) {}
+
 // Destructor; values array deleted
 Vector::~Vector()
 {
 
-  // Delete array
-  if (values_ != nullptr) {
-    delete[] values_;
+  // Delete array (or return it to pool), unless owned elsewhere
+  if (values_ != nullptr && !view_) {
+    if (pool_) {
+      pool_->deallocateValues(values_, length_);
+    }
+    else {
+      delete[] values_;
+    }
     values_ = nullptr;
   } // end if
 
@@ -87,7 +133,7 @@ std::shared_ptr<Vector> Vector::makeNewCopy() const
 {
 
   // Create new vector
-  std::shared_ptr<Vector> vector(new Vector(length_));
+  std::shared_ptr<Vector> vector = makeNewOfSameLength();
 
   // Copy elements
   vector->copy(*this);
@@ -97,6 +143,23 @@ std::shared_ptr<Vector> Vector::makeNewCopy() const
 
 } // end makeNewCopy
 
+// Make new Vector of same length
+std::shared_ptr<Vector> Vector::makeNewOfSameLength() const
+{
+
+  // Check for pool
+  if (pool_) {
+    return std::allocate_shared<Vector>(PoolAllocator<Vector>(pool_), length_, pool_);
+  }
+
+  // Create new vector
+  std::shared_ptr<Vector> vector(new Vector(length_));
+
+  // Return
+  return vector;
+
+} // end makeNewOfSameLength
+
 // Make new Vector by adding "scalar1" times this Vector to "scalar2" times other_vector
 std::shared_ptr<Vector> Vector::makeNewLinearCombination(double scalar1,
                                                          double scalar2,
@@ -104,7 +167,7 @@ std::shared_ptr<Vector> Vector::makeNewLinearCombination(double scalar1,
 {
 
   // Create new vector
-  std::shared_ptr<Vector> vector(new Vector(length_));
+  std::shared_ptr<Vector> vector = makeNewOfSameLength();
 
   // Copy + add elements
   vector->linearCombination(scalar1, *this, scalar2, other_vector);
@@ -118,17 +181,38 @@ std::shared_ptr<Vector> Vector::makeNewLinearCombination(double scalar1,
 void Vector::setLength(int length)
 {
 
-  // Store length
-  length_ = length;
+  // Check for change in length or view (array is retained otherwise)
+  if (values_ == nullptr || length_ != length || view_) {
 
-  // Delete previous array, if exists
-  if (values_ != nullptr) {
-    delete[] values_;
+    // Delete previous array (or return it to pool), if exists and owned
+    if (values_ != nullptr && !view_) {
+      if (pool_) {
+        pool_->deallocateValues(values_, length_);
+      }
+      else {
+        delete[] values_;
+      }
+    } // end if
     values_ = nullptr;
+    view_ = false;
+
+    // Store length
+    length_ = length;
+
+    // Allocate array
+    if (pool_) {
+      values_ = pool_->allocateValues(length);
+    }
+    else {
+      values_ = new double[length];
+    }
+
   } // end if
 
-  // Allocate array
-  values_ = new double[length];
+  // Initialize values
+  for (int i = 0; i < length_; i++) {
+    values_[i] = 0.0;
+  }
 
   // Reset scalar value bools
   max_computed_ = false;
@@ -136,6 +220,7 @@ void Vector::setLength(int length)
   norm1_computed_ = false;
   norm2_computed_ = false;
   normInf_computed_ = false;
+  sparse_ = false;
 
 } // end setLength
 
@@ -157,6 +242,7 @@ void Vector::set(int index,
   norm1_computed_ = false;
   norm2_computed_ = false;
   normInf_computed_ = false;
+  sparse_ = false;
 
 } // end set
 
@@ -181,6 +267,12 @@ void Vector::copy(const Vector& other_vector)
   norm2_computed_ = false;
   normInf_computed_ = false;
 
+  // Copy sparsity
+  sparse_ = other_vector.isSparse();
+  if (sparse_) {
+    nonzero_indices_ = other_vector.nonzeroIndices();
+  }
+
 } // end copy
 
 // Copy elements of double array
@@ -200,6 +292,7 @@ void Vector::copyArray(double* array)
   norm1_computed_ = false;
   norm2_computed_ = false;
   normInf_computed_ = false;
+  sparse_ = false;
 
 } // end copyArray
 
@@ -272,7 +365,15 @@ void Vector::addScaledVector(double scalar,
   int increment = 1;
 
   // Add a*vector
-  daxpy_(&length, &scalar, other_vector.values(), &increment, values_, &increment);
+  if (other_vector.isSparse()) {
+    const double* other_values = other_vector.values();
+    for (int i : other_vector.nonzeroIndices()) {
+      values_[i] += scalar * other_values[i];
+    }
+  }
+  else {
+    daxpy_(&length, &scalar, other_vector.values(), &increment, values_, &increment);
+  }
 
   // Reset scalar value bools
   max_computed_ = false;
@@ -280,6 +381,7 @@ void Vector::addScaledVector(double scalar,
   norm1_computed_ = false;
   norm2_computed_ = false;
   normInf_computed_ = false;
+  sparse_ = false;
 
 } // end addScaledVector
 
@@ -357,9 +459,61 @@ void Vector::linearCombination(double scalar1,
     norm2_computed_ = false;
     normInf_computed_ = false;
   }
+  sparse_ = false;
 
 } // end linearCombination
 
+// Set view
+void Vector::setView(double* array)
+{
+
+  // Delete own array (or return it to pool)
+  if (values_ != nullptr && !view_) {
+    if (pool_) {
+      pool_->deallocateValues(values_, length_);
+    }
+    else {
+      delete[] values_;
+    }
+  } // end if
+
+  // Set array
+  values_ = array;
+  view_ = true;
+
+} // end setView
+
+// Detach
+void Vector::detach()
+{
+
+  // Check for view
+  if (!view_) {
+    return;
+  }
+
+  // Allocate own array
+  double* values;
+  if (pool_) {
+    values = pool_->allocateValues(length_);
+  }
+  else {
+    values = new double[length_];
+  }
+
+  // Set inputs for BLASLAPACK
+  int length = length_;
+  int increment = 1;
+
+  // Copy values
+  dcopy_(&length, values_, &increment, values, &increment);
+
+  // Set array
+  values_ = values;
+  view_ = false;
+
+} // end detach
+
 // Inner product with other_vector
 double Vector::innerProduct(const Vector& other_vector) const
 {
@@ -371,11 +525,64 @@ double Vector::innerProduct(const Vector& other_vector) const
   int length = length_;
   int increment = 1;
 
+  // Check for sparsity
+  if (sparse_ || other_vector.isSparse()) {
+
+    // Loop over nonzero indices of sparser vector
+    const Vector& sparse_vector = (sparse_ && (!other_vector.isSparse() || nonzero_indices_.size() <= other_vector.nonzeroIndices().size())) ? *this : other_vector;
+    const double* other_values = (&sparse_vector == this) ? other_vector.values() : values_;
+    double inner_product = 0.0;
+    for (int i : sparse_vector.nonzeroIndices()) {
+      inner_product += sparse_vector.values()[i] * other_values[i];
+    }
+
+    // Return
+    return inner_product;
+
+  } // end if
+
   // Return
   return ddot_(&length, values_, &increment, other_vector.values(), &increment);
 
 } // end innerProduct
 
+// Determine nonzero indices by scanning values
+void Vector::determineNonzeroIndices(double threshold)
+{
+
+  // Initialize indicator
+  sparse_ = false;
+
+  // Collect indices of nonzero values (stopping once too many are found to be sparse)
+  nonzero_indices_.clear();
+  for (int i = 0; i < length_; i++) {
+    if (values_[i] != 0.0) {
+      if ((double)(nonzero_indices_.size() + 1) > threshold * (double)length_) {
+        nonzero_indices_.clear();
+        return;
+      }
+      nonzero_indices_.push_back(i);
+    } // end if
+  }   // end for
+
+  // Set indicator
+  sparse_ = true;
+
+} // end determineNonzeroIndices
+
+// Set nonzero indices
+void Vector::setNonzeroIndices(int number_of_nonzeros,
+                               const int* indices)
+{
+
+  // Store indices
+  nonzero_indices_.assign(indices, indices + number_of_nonzeros);
+
+  // Set indicator
+  sparse_ = true;
+
+} // end setNonzeroIndices
+
 // Maximum element
 double Vector::max()
 {
@@ -9,7 +9,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "NonOptMemoryPool.hpp"
 #include "NonOptReporter.hpp"
 
 namespace NonOpt
@@ -35,11 +37,13 @@ public:
   Vector()
     : values_(nullptr),
       length_(-1),
+      view_(false),
       max_computed_(false),
       min_computed_(false),
       norm1_computed_(false),
       norm2_computed_(false),
-      normInf_computed_(false){};
+      normInf_computed_(false),
+      sparse_(false){};
   /**
    * Constructor with given length; values initialized to zero
    * \param[in] length is length of Vector to construct
@@ -52,6 +56,21 @@ public:
    */
   Vector(int length,
          double value);
+  /**
+   * Constructor with given length; values array drawn from MemoryPool
+   * \param[in] length is length of Vector to construct
+   * \param[in] pool is pointer to MemoryPool (if null, values array allocated as usual)
+   */
+  Vector(int length,
+         std::shared_ptr<MemoryPool> pool);
+  /**
+   * Constructor as view of external array (values are not copied)
+   * (The external array must remain valid until the Vector is detached or deleted.)
+   * \param[in] array is pointer to external array
+   * \param[in] length is length of Vector to construct
+   */
+  Vector(double* array,
+         int length);
   //@}
 
   /** @name Destructor */
@@ -80,6 +99,11 @@ public:
    * \return is pointer to new Vector
    */
   std::shared_ptr<Vector> makeNewCopy() const;
+  /**
+   * Make new Vector of same length, drawn from same MemoryPool (if any); values not initialized
+   * \return is pointer to new Vector
+   */
+  std::shared_ptr<Vector> makeNewOfSameLength() const;
   /**
    * Make new Vector by adding "scalar1" times this Vector to "scalar2" times other_vector
    * \param[in] scalar1 is scalar value for linear combination
@@ -99,6 +123,16 @@ public:
    * \return is length of Vector
    */
   inline int length() const { return length_; };
+  /**
+   * Get view indicator
+   * \return indicator of whether values array is a view of an array owned elsewhere
+   */
+  inline bool isView() const { return view_; };
+  /**
+   * Get MemoryPool
+   * \return is pointer to MemoryPool from which values array is drawn (null if none)
+   */
+  inline std::shared_ptr<MemoryPool> pool() const { return pool_; };
   /**
    * Get values (const)
    * \return is pointer to array of Vector values
@@ -115,8 +149,19 @@ public:
     norm1_computed_ = false;
     norm2_computed_ = false;
     normInf_computed_ = false;
+    sparse_ = false;
     return values_;
   };
+  /**
+   * Get sparsity indicator
+   * \return indicator of whether nonzero indices are known (all other values are zero)
+   */
+  inline bool isSparse() const { return sparse_; };
+  /**
+   * Get nonzero indices
+   * \return is reference to vector of indices outside of which all values are zero (only meaningful if isSparse())
+   */
+  inline const std::vector<int>& nonzeroIndices() const { return nonzero_indices_; };
   //@}
 
   /** @name Modify methods */
@@ -166,6 +211,36 @@ public:
                          const Vector& vector1,
                          double scalar2,
                          const Vector& vector2);
+  /**
+   * Set values array as view of external array holding the same values (own array is released)
+   * (The external array must remain valid until the Vector is detached or deleted.)
+   * \param[in] array is external array of length equal to length of Vector
+   */
+  void setView(double* array);
+  /**
+   * Detach from external array, i.e., copy values into own array (if view)
+   */
+  void detach();
+  //@}
+
+  /** @name Sparsity methods
+   * (Values are always stored densely.  If nonzero indices are known, then inner products
+   *  and scaled additions involving this Vector only loop over those indices.  Any method
+   *  that modifies values, other than scale, discards the nonzero indices.)
+   */
+  //@{
+  /**
+   * Determine nonzero indices by scanning values
+   * \param[in] threshold is fraction of length; indices are kept only if number of nonzeros is at most threshold*length
+   */
+  void determineNonzeroIndices(double threshold);
+  /**
+   * Set nonzero indices
+   * \param[in] number_of_nonzeros is number of indices
+   * \param[in] indices is array of indices outside of which all values are zero
+   */
+  void setNonzeroIndices(int number_of_nonzeros,
+                         const int* indices);
   //@}
 
   /** @name Scalar functions */
@@ -214,8 +289,10 @@ private:
 
   /** @name Private members */
   //@{
-  double* values_; /**< Double array */
-  int length_;     /**< Length of array */
+  double* values_;                   /**< Double array */
+  int length_;                       /**< Length of array */
+  std::shared_ptr<MemoryPool> pool_; /**< Pool from which array is drawn (null if none) */
+  bool view_;                        /**< Indicator of whether array is owned elsewhere */
   //@}
 
   /** @name Private computed members */
@@ -232,6 +309,12 @@ private:
   double normInf_value_;
   //@}
 
+  /** @name Private sparsity members */
+  //@{
+  bool sparse_;                      /**< Indicator of whether nonzero indices are known */
+  std::vector<int> nonzero_indices_; /**< Indices outside of which all values are zero */
+  //@}
+
 }; // end Vector
 
 } // namespace NonOpt
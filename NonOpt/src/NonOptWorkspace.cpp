@@ -0,0 +1,69 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#include <algorithm>
+#include <cstring>
+
+#include "NonOptWorkspace.hpp"
+
+namespace NonOpt
+{
+
+// Constructor
+Workspace::Workspace()
+  : bytes_allocated_(0) {}
+
+// Destructor
+Workspace::~Workspace()
+{
+
+  // Delete arrays
+  for (int i = 0; i < (int)arrays_.size(); i++) {
+    if (arrays_[i] != nullptr) {
+      delete[] arrays_[i];
+      arrays_[i] = nullptr;
+    } // end if
+  }   // end for
+
+} // end destructor
+
+// Reserve array
+double* Workspace::reserve(int index,
+                           size_t length)
+{
+
+  // Add arrays, if needed
+  if (index >= (int)arrays_.size()) {
+    arrays_.resize(index + 1, nullptr);
+    capacities_.resize(index + 1, 0);
+  } // end if
+
+  // Check capacity
+  if (length > capacities_[index]) {
+
+    // Allocate new array (increasing capacity geometrically)
+    size_t capacity = std::max(length, 2 * capacities_[index]);
+    double* array = new double[capacity];
+    bytes_allocated_ += capacity * sizeof(double);
+
+    // Copy previous values and delete previous array
+    if (arrays_[index] != nullptr) {
+      memcpy(array, arrays_[index], capacities_[index] * sizeof(double));
+      delete[] arrays_[index];
+    } // end if
+
+    // Set new array
+    arrays_[index] = array;
+    capacities_[index] = capacity;
+
+  } // end if
+
+  // Return array
+  return arrays_[index];
+
+} // end reserve
+
+} // namespace NonOpt
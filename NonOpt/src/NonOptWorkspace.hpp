@@ -0,0 +1,95 @@
+// Copyright (C) 2022 Frank E. Curtis
+//
+// This code is published under the MIT License.
+//
+// Author(s) : Frank E. Curtis
+
+#ifndef __NONOPTWORKSPACE_HPP__
+#define __NONOPTWORKSPACE_HPP__
+
+#include <cstddef>
+#include <vector>
+
+namespace NonOpt
+{
+
+/**
+ * Workspace class
+ * (Set of double arrays, identified by index, each of which grows geometrically
+ *  when a larger length is requested and is otherwise retained, so that repeated
+ *  uses of the same sizes require no allocation.)
+ */
+class Workspace
+{
+
+public:
+  /** @name Constructors */
+  //@{
+  /**
+   * Declare Workspace (no arrays)
+   */
+  Workspace();
+  //@}
+
+  /** @name Destructor */
+  //@{
+  /**
+   * Delete data
+   */
+  ~Workspace();
+  //@}
+
+  /** @name Get methods */
+  //@{
+  /**
+   * Bytes allocated
+   * \return number of bytes allocated (including reallocations) since construction
+   */
+  inline size_t const bytesAllocated() const { return bytes_allocated_; };
+  /**
+   * Capacity
+   * \param[in] index is index of array
+   * \return number of doubles that can be stored in array without reallocation
+   */
+  inline size_t const capacity(int index) const { return (index < (int)capacities_.size()) ? capacities_[index] : 0; };
+  //@}
+
+  /** @name Modify methods */
+  //@{
+  /**
+   * Reserve array of at least given length (contents up to previous capacity are preserved)
+   * \param[in] index is index of array
+   * \param[in] length is required length
+   * \return pointer to array
+   */
+  double* reserve(int index,
+                  size_t length);
+  //@}
+
+private:
+  /** @name Default compiler generated methods
+   * (Hidden to avoid implicit creation/calling.)
+   */
+  //@{
+  /**
+   * Copy constructor
+   */
+  Workspace(const Workspace&);
+  /**
+   * Overloaded equals operator
+   */
+  void operator=(const Workspace&);
+  //@}
+
+  /** @name Private members */
+  //@{
+  size_t bytes_allocated_;
+  std::vector<double*> arrays_;
+  std::vector<size_t> capacities_;
+  //@}
+
+}; // end Workspace
+
+} // namespace NonOpt
+
+#endif /* __NONOPTWORKSPACE_HPP__ */
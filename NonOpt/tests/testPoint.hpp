@@ -12,6 +12,7 @@
 #include "MaxQ.hpp"
 #include "NonOptOptions.hpp"
 #include "NonOptPoint.hpp"
+#include "NonOptPointSet.hpp"
 #include "NonOptQuantities.hpp"
 #include "NonOptRandomNumberGenerator.hpp"
 #include "NonOptReporter.hpp"
@@ -239,6 +240,178 @@ int testPointImplementation(int option)
   reporter.printf(R_NL, R_BASIC, "... should be near [0,...,0,2,0,...,0]:\n");
   gs->print(&reporter, "GradientAtRandomVector");
 
+  // Enable evaluation cache
+  options.modifyIntegerValue("evaluation_cache_size", 2);
+  quantities.setOptions(&options);
+
+  // Evaluate at linear combination, then at a separate Point with the same values
+  std::shared_ptr<Point> c1 = p.makeNewLinearCombination(1.0, 2.0, *v);
+  std::shared_ptr<Point> c2 = p.makeNewLinearCombination(1.0, 2.0, *v);
+  c1->evaluateObjective(quantities);
+  c1->evaluateGradient(quantities);
+  int function_counter = quantities.functionCounter();
+  int gradient_counter = quantities.gradientCounter();
+  c2->evaluateObjective(quantities);
+  c2->evaluateGradient(quantities);
+
+  // Check that cached values were used
+  if (quantities.functionCounter() != function_counter ||
+      quantities.gradientCounter() != gradient_counter ||
+      quantities.evaluationCache()->hitCounter() != 2 ||
+      c2->objective() < 9.0 - 1e-12 || c2->objective() > 9.0 + 1e-12 ||
+      c2->gradient()->values()[0] < 6.0 - 1e-12 || c2->gradient()->values()[0] > 6.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Evaluate at two other points, after which the linear combination should have been evicted
+  p.makeNewLinearCombination(1.0, 3.0, *v)->evaluateObjective(quantities);
+  p.makeNewLinearCombination(1.0, 4.0, *v)->evaluateObjective(quantities);
+  std::shared_ptr<Point> c3 = p.makeNewLinearCombination(1.0, 2.0, *v);
+  c3->evaluateObjective(quantities);
+
+  // Check that evaluation was performed
+  if (quantities.functionCounter() != function_counter + 3 ||
+      quantities.evaluationCache()->hitCounter() != 2 ||
+      quantities.evaluationCache()->size() != 2) {
+    result = 1;
+  }
+
+  // Evaluate a batch with a cached point and a new point
+  std::vector<std::shared_ptr<Point>> batch;
+  batch.push_back(p.makeNewLinearCombination(1.0, 2.0, *v));
+  batch.push_back(p.makeNewLinearCombination(1.0, 5.0, *v));
+  std::vector<bool> batch_success;
+  Point::evaluateObjectiveBatch(batch, quantities, batch_success);
+
+  // Check that only the new point was evaluated
+  if (quantities.functionCounter() != function_counter + 4 ||
+      quantities.evaluationCache()->hitCounter() != 3 ||
+      !batch_success[0] || !batch_success[1] ||
+      batch[0]->objective() < 9.0 - 1e-12 || batch[0]->objective() > 9.0 + 1e-12 ||
+      batch[1]->objective() < 36.0 - 1e-12 || batch[1]->objective() > 36.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Print cache statistics
+  reporter.printf(R_NL, R_BASIC, "Testing evaluation cache... hit rate should be 3/9: %+23.16e\n", quantities.evaluationCache()->hitRate());
+
+  // Declare Point at initial point
+  std::shared_ptr<Vector> x0(new Vector(n));
+  problem->initialPoint(n, x0->valuesModifiable());
+  Point a(problem, x0, 1.0);
+
+  // Evaluate epsilon-active pieces (squares of last two elements, 49^2 and 50^2, are within 100 of maximum)
+  std::vector<double> active_objectives;
+  std::vector<std::shared_ptr<Vector>> active_gradients;
+  bool active_success = a.evaluateEpsilonActiveGradients(quantities, 100.0, 10, active_objectives, active_gradients);
+
+  // Check values
+  if (!active_success || active_objectives.size() != 2 || active_gradients.size() != 2 ||
+      active_objectives[0] < 2401.0 - 1e-12 || active_objectives[0] > 2401.0 + 1e-12 ||
+      active_objectives[1] < 2500.0 - 1e-12 || active_objectives[1] > 2500.0 + 1e-12 ||
+      active_gradients[0]->values()[n - 2] < -98.0 - 1e-12 || active_gradients[0]->values()[n - 2] > -98.0 + 1e-12 ||
+      active_gradients[1]->values()[n - 1] < -100.0 - 1e-12 || active_gradients[1]->values()[n - 1] > -100.0 + 1e-12 ||
+      active_gradients[1]->norm1() < 100.0 - 1e-12 || active_gradients[1]->norm1() > 100.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Print number of pieces
+  reporter.printf(R_NL, R_BASIC, "Testing epsilon-active pieces... number should be 2: %d\n", (int)active_gradients.size());
+
+  // Evaluate epsilon-active pieces with at most one piece (only largest, 50^2, is kept)
+  active_success = a.evaluateEpsilonActiveGradients(quantities, 100.0, 1, active_objectives, active_gradients);
+
+  // Check values
+  if (!active_success || active_objectives.size() != 1 || active_gradients.size() != 1 ||
+      active_objectives[0] < 2500.0 - 1e-12 || active_objectives[0] > 2500.0 + 1e-12 ||
+      active_gradients[0]->values()[n - 1] < -100.0 - 1e-12 || active_gradients[0]->values()[n - 1] > -100.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Enable sparse gradient evaluation
+  options.modifyDoubleValue("gradient_sparsity_threshold", 0.1);
+  quantities.setOptions(&options);
+
+  // Evaluate gradient at initial point (only last element nonzero)
+  Point b(problem, x0, 1.0);
+  b.evaluateGradient(quantities);
+
+  // Check values and nonzero indices
+  if (!b.gradient()->isSparse() || b.gradient()->nonzeroIndices().size() != 1 || b.gradient()->nonzeroIndices()[0] != n - 1 ||
+      b.gradient()->values()[n - 1] < -100.0 - 1e-12 || b.gradient()->values()[n - 1] > -100.0 + 1e-12 ||
+      b.gradient()->norm1() < 100.0 - 1e-12 || b.gradient()->norm1() > 100.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Print number of nonzeros
+  reporter.printf(R_NL, R_BASIC, "Testing sparse gradient... number of nonzeros should be 1: %d\n", (int)b.gradient()->nonzeroIndices().size());
+
+  // Evaluate objective and gradient at initial point in a batch, then gradient at a copy (found in evaluation cache)
+  std::vector<std::shared_ptr<Point>> sparse_batch;
+  sparse_batch.push_back(std::make_shared<Point>(problem, x0, 1.0));
+  Point::evaluateObjectiveAndGradientBatch(sparse_batch, quantities, batch_success);
+  std::vector<std::shared_ptr<Point>> cached_batch;
+  cached_batch.push_back(std::make_shared<Point>(problem, x0, 1.0));
+  int hit_counter = quantities.evaluationCache()->hitCounter();
+  Point::evaluateGradientBatch(cached_batch, quantities, batch_success);
+
+  // Check nonzero indices (as given by sparse gradient method, and kept in evaluation cache)
+  for (int i = 0; i < 2; i++) {
+    std::shared_ptr<Vector> gradient = (i == 0) ? sparse_batch[0]->gradient() : cached_batch[0]->gradient();
+    if (!batch_success[0] || !gradient->isSparse() || gradient->nonzeroIndices().size() != 1 || gradient->nonzeroIndices()[0] != n - 1 ||
+        gradient->values()[n - 1] < -100.0 - 1e-12 || gradient->values()[n - 1] > -100.0 + 1e-12) {
+      result = 1;
+    }
+  } // end for
+  if (quantities.evaluationCache()->hitCounter() != hit_counter + 1) {
+    result = 1;
+  }
+
+  // Print number of nonzeros
+  reporter.printf(R_NL, R_BASIC, "Testing sparse batch gradient... number of nonzeros should be 1: %d\n", (int)cached_batch[0]->gradient()->nonzeroIndices().size());
+
+  // Declare point set and add ones vector, linear combination (threes), and initial point
+  PointSet point_set;
+  point_set.push_back(std::make_shared<Point>(problem, v, 1.0));
+  point_set.push_back(r);
+  point_set.push_back(std::make_shared<Point>(problem, x0, 1.0));
+
+  // Remove oldest point and compute distances to linear combination
+  point_set.removeOldest(1);
+  std::vector<double> distances2;
+  std::vector<double> distancesInf;
+  point_set.computeDistances(*r->vector(), distances2, distancesInf);
+
+  // Check size, order, views, and distances
+  if (point_set.size() != 2 || point_set[0] != r || !r->vector()->isView() || r->vector()->values() != point_set.values(0) || distances2.size() != 2 ||
+      distances2[0] > 1e-12 || distancesInf[1] < 53.0 - 1e-12 || distancesInf[1] > 53.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Find points within radius of linear combination (only linear combination itself)
+  std::vector<int> indices_in_radius;
+  std::vector<double> distances_in_radius;
+  point_set.findPointsInRadius(*r->vector(), 1.0, indices_in_radius, distances_in_radius);
+  if (indices_in_radius.size() != 1 || indices_in_radius[0] != 0 || distances_in_radius[0] > 1e-12) {
+    result = 1;
+  }
+
+  // Remove linear combination and check that initial point remains
+  std::vector<bool> remove(2, false);
+  remove[0] = true;
+  point_set.removeMarked(remove);
+  if (point_set.size() != 1 || point_set.values(0)[n - 1] < -50.0 - 1e-12 || point_set.values(0)[n - 1] > -50.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Check that linear combination (still in use) was detached with its values
+  if (r->vector()->isView() || r->vector()->values()[0] < 3.0 - 1e-12 || r->vector()->values()[0] > 3.0 + 1e-12) {
+    result = 1;
+  }
+
+  // Print point set size
+  reporter.printf(R_NL, R_BASIC, "Testing point set... size should be 1: %d\n", point_set.size());
+
   // Check option
   if (option == 1) {
     // Print final message
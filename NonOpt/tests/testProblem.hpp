@@ -109,9 +109,55 @@ int testProblemImplementation(int option)
     reporter.printf(R_NL, R_BASIC, "%+23.16e\n", g[i]);
   } // end for
 
+  // Declare batch quantities (initial point and its negation)
+  double* X = new double[2 * n];
+  double F[2];
+  double* G = new double[2 * n];
+  bool success[2];
+  for (int i = 0; i < n; i++) {
+    X[i] = x[i];
+    X[n + i] = -x[i];
+  }
+
+  // Evaluate objective and gradient values as a batch
+  if (!problem.evaluateObjectiveAndGradientBatch(n, 2, X, F, G, success)) {
+    result = 1;
+  }
+
+  // Check objective and gradient values
+  for (int j = 0; j < 2; j++) {
+    if (!success[j] || F[j] < 2500.0 - 1e-12 || F[j] > 2500.0 + 1e-12) {
+      result = 1;
+    }
+    for (int i = 0; i < n; i++) {
+      double value = (i < n - 1) ? 0.0 : ((j == 0) ? -100.0 : 100.0);
+      if (G[j * n + i] < value - 1e-12 || G[j * n + i] > value + 1e-12) {
+        result = 1;
+      }
+    } // end for
+  }   // end for
+
+  // Print batch objective values
+  reporter.printf(R_NL, R_BASIC, "Batch objective values... should be 2500, 2500: %+23.16e %+23.16e\n", F[0], F[1]);
+
+  // Evaluate objective values as a batch
+  F[0] = F[1] = 0.0;
+  if (!problem.evaluateObjectiveBatch(n, 2, X, F, success)) {
+    result = 1;
+  }
+
+  // Check objective values
+  for (int j = 0; j < 2; j++) {
+    if (!success[j] || F[j] < 2500.0 - 1e-12 || F[j] > 2500.0 + 1e-12) {
+      result = 1;
+    }
+  } // end for
+
   // Delete objects
   delete[] x;
   delete[] g;
+  delete[] X;
+  delete[] G;
 
   // Check option
   if (option == 1) {
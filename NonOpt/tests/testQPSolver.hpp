@@ -9,15 +9,194 @@
 
 #include <iostream>
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 
 #include "NonOptQPSolverDualActiveSet.hpp"
+#include "NonOptDefinitions.hpp"
+#include "NonOptQPSolverFISTA.hpp"
 #include "NonOptSymmetricMatrix.hpp"
 #include "NonOptSymmetricMatrixDense.hpp"
 
 using namespace NonOpt;
 
+// Steps of comparison tests
+enum QPTestStep {
+  QP_TEST_COLD = 0,      // Solve with first vectors
+  QP_TEST_REPLACE_FIRST, // Solve with vectors shifted by one, but first kept (as for termination QP)
+  QP_TEST_REVERSE,       // Solve with vectors reversed
+  QP_TEST_PERTURB,       // Solve with linear terms perturbed
+  QP_TEST_ADD            // Solve hot after adding remaining vectors
+};
+
+// Comparison of solver with reference solver on random instance
+// (Returns 0 if, after each step, both solvers succeed and primal solutions and the solver's
+//  dual KKT error are within tolerance, and 1 otherwise; iterations are counted after the first step.
+//  If vectors are sparse, the solver is given copies with nonzero indices set.)
+int testQPSolverComparison(Reporter& reporter,
+                           Options& options,
+                           Quantities& quantities,
+                           QPSolver& reference,
+                           QPSolver& solver,
+                           int test,
+                           int number_of_variables,
+                           int number_of_points,
+                           int number_of_points_add,
+                           bool termination_data,
+                           bool random_matrix,
+                           bool sparse_vectors,
+                           double scalar,
+                           const std::vector<QPTestStep>& steps,
+                           double tolerance,
+                           int& iterations_reference,
+                           int& iterations_solver)
+{
+
+  // Initialize output
+  int result = 0;
+
+  // Declare random number generator (seeded by test number)
+  std::default_random_engine generator(test);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::normal_distribution<double> normal(0.0, 1.0);
+
+  // Set vector lists and vector (shifted vectors and equal linear terms for termination data)
+  std::vector<std::shared_ptr<Vector>> vector_list;
+  std::vector<std::shared_ptr<Vector>> solver_vector_list;
+  std::vector<double> vector;
+  for (int points = 0; points < number_of_points + number_of_points_add; points++) {
+    std::shared_ptr<Vector> g(new Vector(number_of_variables, 0.0));
+    for (int i = 0; i < number_of_variables; i++) {
+      if (!sparse_vectors || i % 10 == points % 10) {
+        g->set(i, (termination_data ? 1.0 : 0.0) + normal(generator));
+      }
+    } // end for
+    vector_list.push_back(g);
+    if (sparse_vectors) {
+      std::shared_ptr<Vector> g_sparse = g->makeNewCopy();
+      g_sparse->determineNonzeroIndices(1.0);
+      solver_vector_list.push_back(g_sparse);
+    }
+    else {
+      solver_vector_list.push_back(g);
+    }
+    vector.push_back(termination_data ? 1.0 : -uniform(generator));
+  } // end for
+
+  // Set inverse Hessian as identity (plus scaled random positive semidefinite matrix)
+  std::shared_ptr<SymmetricMatrixDense> matrix = std::make_shared<SymmetricMatrixDense>();
+  matrix->setAsDiagonal(number_of_variables, 1.0);
+  if (random_matrix) {
+    std::vector<double> hessianInverse_init(number_of_variables * number_of_variables);
+    for (int i = 0; i < number_of_variables * number_of_variables; i++) {
+      hessianInverse_init[i] = normal(generator);
+    }
+    for (int i = 0; i < number_of_variables; i++) {
+      for (int j = 0; j < number_of_variables; j++) {
+        for (int k = 0; k < number_of_variables; k++) {
+          matrix->valuesOfInverseModifiable()[i * number_of_variables + j] += hessianInverse_init[i * number_of_variables + k] * hessianInverse_init[j * number_of_variables + k] / (double)number_of_variables;
+        }
+      } // end for
+    }   // end for
+  }     // end if
+
+  // Set data for solves, and index of first vector not yet used
+  std::vector<std::shared_ptr<Vector>> solve_vector_list(vector_list.begin(), vector_list.begin() + number_of_points);
+  std::vector<std::shared_ptr<Vector>> solve_solver_vector_list(solver_vector_list.begin(), solver_vector_list.begin() + number_of_points);
+  std::vector<double> solve_vector(vector.begin(), vector.begin() + number_of_points);
+  int next = number_of_points;
+
+  // Initialize iteration counters
+  iterations_reference = 0;
+  iterations_solver = 0;
+
+  // Loop over steps
+  for (int step = 0; step < (int)steps.size(); step++) {
+
+    // Check step
+    if (steps[step] == QP_TEST_ADD) {
+
+      // Add vectors
+      std::vector<std::shared_ptr<Vector>> new_vector_list(vector_list.begin() + next, vector_list.end());
+      std::vector<std::shared_ptr<Vector>> new_solver_vector_list(solver_vector_list.begin() + next, solver_vector_list.end());
+      std::vector<double> new_vector(vector.begin() + next, vector.end());
+      reference.addData(new_vector_list, new_vector);
+      solver.addData(new_solver_vector_list, new_vector);
+
+      // Solve QPs hot
+      reference.solveQPHot(&options, &reporter, &quantities);
+      solver.solveQPHot(&options, &reporter, &quantities);
+
+    } // end if
+    else {
+
+      // Modify data
+      if (steps[step] == QP_TEST_REPLACE_FIRST) {
+        solve_vector_list.assign(vector_list.begin() + 1, vector_list.begin() + number_of_points + 1);
+        solve_solver_vector_list.assign(solver_vector_list.begin() + 1, solver_vector_list.begin() + number_of_points + 1);
+        solve_vector.assign(vector.begin() + 1, vector.begin() + number_of_points + 1);
+        solve_vector_list[0] = vector_list[0];
+        solve_solver_vector_list[0] = solver_vector_list[0];
+        solve_vector[0] = vector[0];
+        next = number_of_points + 1;
+      } // end if
+      else if (steps[step] == QP_TEST_REVERSE) {
+        std::reverse(solve_vector_list.begin(), solve_vector_list.end());
+        std::reverse(solve_solver_vector_list.begin(), solve_solver_vector_list.end());
+        std::reverse(solve_vector.begin(), solve_vector.end());
+      }
+      else if (steps[step] == QP_TEST_PERTURB) {
+        for (int i = 0; i < (int)solve_vector.size(); i++) {
+          solve_vector[i] -= 1e-02 * uniform(generator);
+        }
+      } // end else if
+
+      // Set QP data
+      reference.setMatrix(matrix);
+      reference.setVectorList(solve_vector_list);
+      reference.setVector(solve_vector);
+      reference.setScalar(scalar);
+      solver.setMatrix(matrix);
+      solver.setVectorList(solve_solver_vector_list);
+      solver.setVector(solve_vector);
+      solver.setScalar(scalar);
+
+      // Solve QPs
+      reference.solveQP(&options, &reporter, &quantities);
+      solver.solveQP(&options, &reporter, &quantities);
+
+    } // end else
+
+    // Update iteration counters
+    if (step > 0) {
+      iterations_reference += reference.numberOfIterations();
+      iterations_solver += solver.numberOfIterations();
+    }
+
+    // Compute difference between primal solutions
+    Vector primal_solution(number_of_variables);
+    Vector primal_solution_difference(number_of_variables);
+    reference.primalSolution(primal_solution.valuesModifiable());
+    solver.primalSolution(primal_solution_difference.valuesModifiable());
+    primal_solution_difference.addScaledVector(-1.0, primal_solution);
+
+    // Check for pass or fail
+    if (reference.status() == QP_SUCCESS && solver.status() == QP_SUCCESS && solver.KKTErrorDual() <= tolerance && primal_solution_difference.normInf() <= tolerance) {
+      reporter.printf(R_QP, R_BASIC, "pass");
+    }
+    else {
+      reporter.printf(R_QP, R_BASIC, "fail");
+      result = 1;
+    }
+
+  } // end for
+
+  // Return
+  return result;
+
+} // end testQPSolverComparison
+
 // Implementation of test
 int testQPSolverImplementation(int option)
 {
@@ -123,7 +302,7 @@ int testQPSolverImplementation(int option)
     gen_weights.scale(1.0 / gen_weights.norm1());
 
     // Initialize and set linear term
-    Vector gen_linear(numberVariables);
+    Vector gen_linear(numberVariables, 0.0);
     for (int i = 0; i < numberVariables; i++) {
       for (int j = 0; j < numberAffine; j++) {
         gen_linear.set(i, gen_linear.values()[i] - gen_maxLinearMatrix[j * numberVariables + i] * gen_weights.values()[j]);
@@ -273,8 +452,8 @@ int testQPSolverImplementation(int option)
       }
     } // end for
 
-    // Loop over cold and hot solves
-    for (int solve_count = 0; solve_count < test_adds + 1; solve_count++) {
+    // Loop over cold and hot solves, then a solve after the matrix is modified in place
+    for (int solve_count = 0; solve_count < test_adds + 2; solve_count++) {
 
       // Check solve counter
       if (solve_count == 0) {
@@ -290,7 +469,7 @@ int testQPSolverImplementation(int option)
 
       } // end if
 
-      else {
+      else if (solve_count < test_adds + 1) {
 
         // Add vectors
         q.addData(new_vector_list, new_vector);
@@ -301,6 +480,19 @@ int testQPSolverImplementation(int option)
         // Print new line
         reporter.printf(R_QP, R_BASIC, "... adding %2d vectors... ", numberPointsAdd);
 
+      } // end else if
+
+      else {
+
+        // Modify matrix in place (cached products with previous matrix must not be used)
+        matrix->setAsDiagonal(numberVariables, 1.0 / hess_scaling);
+
+        // Solve QP
+        q.solveQP(&options, &reporter, &quantities);
+
+        // Print new line
+        reporter.printf(R_QP, R_BASIC, "... modifying matrix... ");
+
       } // end else
 
       // Check for pass or fail
@@ -325,6 +517,13 @@ int testQPSolverImplementation(int option)
 
     } // end for
 
+    // Re-solve with same data (workspace should be reused without allocation)
+    size_t bytes_allocated = q.workspaceBytesAllocated();
+    q.solveQP(&options, &reporter, &quantities);
+    if (q.status() != QP_SUCCESS || q.workspaceBytesAllocated() != bytes_allocated) {
+      result = 1;
+    }
+
     // Delete matrix
     delete[] gen_maxLinearMatrix;
     delete[] gen_quadratic_init;
@@ -333,6 +532,189 @@ int testQPSolverImplementation(int option)
 
   } // end for
 
+  // Declare first-order QP solver object
+  QPSolverFISTA f;
+
+  // Add options
+  f.addOptions(&options);
+
+  // Use exact solves (with tight tolerance for comparison with active-set solver)
+  options.modifyBoolValue("QPFISTA_allow_inexact_termination", false);
+  options.modifyDoubleValue("QPFISTA_kkt_tolerance", 1e-08);
+  options.modifyIntegerValue("QPFISTA_iteration_limit", 100000);
+
+  // Set options
+  f.setOptions(&options);
+
+  // Initialize data
+  q.initializeData(numberVariables);
+  f.initializeData(numberVariables);
+
+  // Declare iteration counters
+  int iterations_reference = 0;
+  int iterations_solver = 0;
+
+  // Loop over number of tests (well-conditioned data, for which first-order solver is effective)
+  for (int test = test_start; test < test_end + 1; test++) {
+
+    // Print test number
+    reporter.printf(R_QP, R_BASIC, "Running FISTA test %2d... ", test);
+
+    // Compare with active-set solver (radius alternates between finite and infinite)
+    double radius = (test % 2 == 0) ? 1.0 / ((double)(test) + 1.0) : NONOPT_DOUBLE_INFINITY;
+    if (testQPSolverComparison(reporter, options, quantities, q, f, test, numberVariables, 10 * (test + 1), 0, false, true, false, radius, {QP_TEST_COLD}, 1e-04, iterations_reference, iterations_solver) != 0) {
+      result = 1;
+    }
+
+    // Re-solve with same data (warm start from solution should terminate at first check)
+    int iterations = f.numberOfIterations();
+    f.solveQP(&options, &reporter, &quantities);
+    if (f.status() != QP_SUCCESS || f.numberOfIterations() > 10) {
+      result = 1;
+    }
+
+    // Print iteration counts
+    reporter.printf(R_QP, R_BASIC, "  iters: %6d  warm iters: %6d\n", iterations, f.numberOfIterations());
+
+  } // end for
+
+  // Declare reference QP solver object (active-set method with one option changed)
+  QPSolverDualActiveSet p;
+
+  // Set options (minimum-norm-point method off for reference, on for q)
+  options.modifyBoolValue("QPDAS_min_norm_point", false);
+  p.setOptions(&options);
+  options.modifyBoolValue("QPDAS_min_norm_point", true);
+  q.setOptions(&options);
+
+  // Initialize data
+  p.initializeData(numberVariables);
+  q.initializeData(numberVariables);
+
+  // Loop over number of tests (infinite scalar, solved by minimum-norm-point method)
+  for (int test = test_start; test < test_end + 1; test++) {
+
+    // Print test number
+    reporter.printf(R_QP, R_BASIC, "Running MNP test %4d... ", test);
+
+    // Compare with active-set solver (data as for termination QP)
+    if (testQPSolverComparison(reporter, options, quantities, p, q, test, numberVariables, 10 * (test + 1), 11, true, true, false, NONOPT_DOUBLE_INFINITY, {QP_TEST_COLD, QP_TEST_REPLACE_FIRST, QP_TEST_ADD}, 1e-06, iterations_reference, iterations_solver) != 0) {
+      result = 1;
+    }
+
+    // Print iteration counts
+    reporter.printf(R_QP, R_BASIC, "  active-set iters: %6d  MNP iters: %6d\n", iterations_reference, iterations_solver);
+
+  } // end for
+
+  // Set options (loose Cholesky tolerance for q, so minimum-norm-point method meets dependent vectors)
+  options.modifyDoubleValue("QPDAS_cholesky_tolerance", 0.5);
+  q.setOptions(&options);
+  options.modifyDoubleValue("QPDAS_cholesky_tolerance", 1e-12);
+
+  // Initialize data
+  p.initializeData(numberVariables);
+  q.initializeData(numberVariables);
+
+  // Loop over number of tests (minimum-norm-point method falls back to active-set method)
+  for (int test = test_start; test < test_end + 1; test++) {
+
+    // Print test number
+    reporter.printf(R_QP, R_BASIC, "Running fallback test %d... ", test);
+
+    // Compare with active-set solver (data as for termination QP)
+    if (testQPSolverComparison(reporter, options, quantities, p, q, test, numberVariables, 10 * (test + 1), 11, true, true, false, NONOPT_DOUBLE_INFINITY, {QP_TEST_COLD, QP_TEST_REPLACE_FIRST, QP_TEST_ADD}, 1e-06, iterations_reference, iterations_solver) != 0) {
+      result = 1;
+    }
+
+    // Print iteration counts
+    reporter.printf(R_QP, R_BASIC, "  active-set iters: %6d  fallback iters: %6d\n", iterations_reference, iterations_solver);
+
+  } // end for
+
+  // Set options (warm start off for reference, on for q)
+  options.modifyBoolValue("QPDAS_warm_start", false);
+  p.setOptions(&options);
+  options.modifyBoolValue("QPDAS_warm_start", true);
+  q.setOptions(&options);
+
+  // Initialize data
+  p.initializeData(numberVariables);
+  q.initializeData(numberVariables);
+
+  // Loop over number of tests (re-solves from scratch, seeded from last solve for q)
+  for (int test = test_start; test < test_end + 1; test++) {
+
+    // Print test number
+    reporter.printf(R_QP, R_BASIC, "Running warm test %3d... ", test);
+
+    // Compare with cold-started solver
+    if (testQPSolverComparison(reporter, options, quantities, p, q, test, numberVariables, 10 * (test + 1), 0, false, false, false, 1.0, {QP_TEST_COLD, QP_TEST_REVERSE, QP_TEST_PERTURB}, 1e-06, iterations_reference, iterations_solver) != 0) {
+      result = 1;
+    }
+
+    // Check for fewer iterations when warm started
+    if (iterations_solver > iterations_reference) {
+      reporter.printf(R_QP, R_BASIC, "fail");
+      result = 1;
+    }
+
+    // Print iteration counts
+    reporter.printf(R_QP, R_BASIC, "  cold iters: %6d  warm iters: %6d\n", iterations_reference, iterations_solver);
+
+  } // end for
+
+  // Set options (single pivots for reference, block pivots for q)
+  options.modifyIntegerValue("QPDAS_block_size", 1);
+  p.setOptions(&options);
+  options.modifyIntegerValue("QPDAS_block_size", 10);
+  q.setOptions(&options);
+
+  // Initialize data
+  p.initializeData(numberVariables);
+  q.initializeData(numberVariables);
+
+  // Loop over number of tests (vectors added in a batch, solved hot with block pivots for q)
+  for (int test = test_start; test < test_end + 1; test++) {
+
+    // Print test number
+    reporter.printf(R_QP, R_BASIC, "Running block test %2d... ", test);
+
+    // Compare with single-pivot solver
+    if (testQPSolverComparison(reporter, options, quantities, p, q, test, numberVariables, 10 * (test + 1), 50, false, false, false, 1e+02, {QP_TEST_COLD, QP_TEST_ADD}, 1e-06, iterations_reference, iterations_solver) != 0) {
+      result = 1;
+    }
+
+    // Print iteration counts
+    reporter.printf(R_QP, R_BASIC, "  single iters: %6d  block iters: %6d\n", iterations_reference, iterations_solver);
+
+  } // end for
+
+  // Set options (defaults for both, reference given dense vectors)
+  options.modifyIntegerValue("QPDAS_block_size", 1);
+  p.setOptions(&options);
+  q.setOptions(&options);
+
+  // Initialize data
+  p.initializeData(numberVariables);
+  q.initializeData(numberVariables);
+
+  // Loop over number of tests (sparse vectors, for which q does not form contiguous bundle)
+  for (int test = test_start; test < test_end + 1; test++) {
+
+    // Print test number
+    reporter.printf(R_QP, R_BASIC, "Running sparse test %d... ", test);
+
+    // Compare with solver given dense vectors
+    if (testQPSolverComparison(reporter, options, quantities, p, q, test, numberVariables, 10 * (test + 1), 50, false, false, true, 1e+02, {QP_TEST_COLD, QP_TEST_REVERSE, QP_TEST_ADD}, 1e-06, iterations_reference, iterations_solver) != 0) {
+      result = 1;
+    }
+
+    // Print iteration counts
+    reporter.printf(R_QP, R_BASIC, "  dense iters: %6d  sparse iters: %6d\n", iterations_reference, iterations_solver);
+
+  } // end for
+
   // Check option
   if (option == 1) {
     // Print final message
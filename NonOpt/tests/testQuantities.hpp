@@ -131,6 +131,61 @@ int testQuantitiesImplementation(int option)
   reporter.printf(R_NL, R_BASIC, "Stationarity radius (updated): %+23.16e\n", quantities.stationarityRadius());
   reporter.printf(R_NL, R_BASIC, "Trust region radius (updated): %+23.16e\n", quantities.trustRegionRadius());
 
+  //////////////////////////
+  // Compress bundle data //
+  //////////////////////////
+
+  // Declare gradients (second equal to first, third within tolerance of first)
+  std::shared_ptr<Vector> g1(new Vector(n, 1.0));
+  std::shared_ptr<Vector> g2(new Vector(n, 1.0));
+  std::shared_ptr<Vector> g3(new Vector(n, 1.0 + 1e-08));
+  std::shared_ptr<Vector> g4(new Vector(n, 2.0));
+
+  // Declare QP data
+  std::vector<std::shared_ptr<Vector>> gradient_list = {g1, g2, g4};
+  std::vector<double> linear_values = {1.0, 3.0, 2.0};
+
+  // Compress (duplicate merged into first entry, keeping larger value)
+  quantities.bundleCompressor()->clear();
+  int merged = quantities.bundleCompressor()->compress(gradient_list, linear_values);
+
+  // Check compressed data
+  if (merged != 1 || gradient_list.size() != 2 || gradient_list[0] != g1 || gradient_list[1] != g4) {
+    result = 1;
+  }
+  if (linear_values.size() != 2 || linear_values[0] != 3.0 || linear_values[1] != 2.0) {
+    result = 1;
+  }
+
+  // Declare new QP data
+  std::vector<std::shared_ptr<Vector>> gradient_list_new = {g2, g3};
+  std::vector<double> linear_values_new = {2.0, 4.0};
+
+  // Compress (recorded entry with larger value removes first, third is not identical)
+  merged = quantities.bundleCompressor()->compress(gradient_list_new, linear_values_new);
+
+  // Check compressed data
+  if (merged != 1 || gradient_list_new.size() != 1 || gradient_list_new[0] != g3 || linear_values_new[0] != 4.0) {
+    result = 1;
+  }
+  if (quantities.bundleCompressor()->size() != 3 || quantities.bundleCompressor()->mergeCounter() != 2) {
+    result = 1;
+  }
+
+  // Set tolerance and compress again (third merged into first)
+  quantities.bundleCompressor()->setParameters(true, 1e-06);
+  gradient_list = {g1, g3, g4};
+  linear_values = {1.0, 4.0, 2.0};
+  merged = quantities.bundleCompressor()->compress(gradient_list, linear_values);
+
+  // Check compressed data
+  if (merged != 1 || gradient_list.size() != 2 || gradient_list[0] != g1 || linear_values[0] != 4.0) {
+    result = 1;
+  }
+
+  // Print compressor counter
+  reporter.printf(R_NL, R_BASIC, "Bundle entries merged: %d\n", quantities.bundleCompressor()->mergeCounter());
+
   //////////////////////
   // Reset quantities //
   //////////////////////
@@ -9,6 +9,7 @@
 
 #include <iostream>
 
+#include "ChainedLQ.hpp"
 #include "MaxQ.hpp"
 #include "NonOptOptions.hpp"
 #include "NonOptProblem.hpp"
@@ -17,6 +18,7 @@
 #include "NonOptSymmetricMatrix.hpp"
 #include "NonOptSymmetricMatrixDense.hpp"
 #include "NonOptSymmetricMatrixLimitedMemory.hpp"
+#include "NonOptSymmetricMatrixPartitioned.hpp"
 
 using namespace NonOpt;
 
@@ -62,6 +64,8 @@ int testSymmetricMatrixImplementation(int option)
   symmetric_matrix->addOptions(&options);
   symmetric_matrix = std::make_shared<SymmetricMatrixLimitedMemory>();
   symmetric_matrix->addOptions(&options);
+  symmetric_matrix = std::make_shared<SymmetricMatrixPartitioned>();
+  symmetric_matrix->addOptions(&options);
 
   // Add approximate hessian update option
   options.addStringOption("approximate_hessian_update",
@@ -70,7 +74,7 @@ int testSymmetricMatrixImplementation(int option)
                           "Default     : BFGS.");
 
   // Loop over symmetric matrix strategies
-  for (int symmetric_matrix_number = 0; symmetric_matrix_number < 2; symmetric_matrix_number++) {
+  for (int symmetric_matrix_number = 0; symmetric_matrix_number < 4; symmetric_matrix_number++) {
 
     // Loop over update strategies
     for (int approximate_hessian_update = 0; approximate_hessian_update < 2; approximate_hessian_update++) {
@@ -78,11 +82,22 @@ int testSymmetricMatrixImplementation(int option)
       // Set symmetric matrix
       if (symmetric_matrix_number == 0) {
         symmetric_matrix = std::make_shared<SymmetricMatrixDense>();
+        options.modifyBoolValue("SMD_inverse_only", false);
         reporter.printf(R_NL, R_BASIC, "TESTING SYMMETRIC MATRIX DENSE\n");
       } // end if
-      else {
+      else if (symmetric_matrix_number == 1) {
+        symmetric_matrix = std::make_shared<SymmetricMatrixDense>();
+        options.modifyBoolValue("SMD_inverse_only", true);
+        reporter.printf(R_NL, R_BASIC, "TESTING SYMMETRIC MATRIX DENSE (INVERSE ONLY)\n");
+      } // end else if
+      else if (symmetric_matrix_number == 2) {
         symmetric_matrix = std::make_shared<SymmetricMatrixLimitedMemory>();
         reporter.printf(R_NL, R_BASIC, "TESTING SYMMETRIC MATRIX LIMITED-MEMORY\n");
+      } // end else if
+      else {
+        symmetric_matrix = std::make_shared<SymmetricMatrixPartitioned>();
+        options.modifyIntegerValue("SMP_bandwidth", 4);
+        reporter.printf(R_NL, R_BASIC, "TESTING SYMMETRIC MATRIX PARTITIONED (SINGLE ELEMENT)\n");
       } // end else
 
       // Set update stratgy
@@ -800,6 +815,36 @@ int testSymmetricMatrixImplementation(int option)
         reporter.printf(R_NL, R_BASIC, "Inner product with matrix inverse... should be 2.575757575757: %+23.16e\n", inner_product);
       }
 
+      // Declare matrix with columns s and y, and block products
+      double G[10], WG[10], GtWG[4];
+      for (int i = 0; i < 5; i++) {
+        G[i] = s.values()[i];
+        G[5 + i] = y.values()[i];
+      }
+
+      // Compute matrix-matrix product and inner products
+      H->matrixMatrixProductOfInverse(2, G, WG);
+      H->innerProductsOfInverse(2, G, GtWG);
+
+      // Check block products against matrix-vector products
+      for (int j = 0; j < 2; j++) {
+        H->matrixVectorProductOfInverse((j == 0) ? s : y, p);
+        for (int i = 0; i < 5; i++) {
+          if (WG[j * 5 + i] < p.values()[i] - 1e-08 || WG[j * 5 + i] > p.values()[i] + 1e-08) {
+            result = 1;
+          }
+        } // end for
+        for (int i = 0; i < 2; i++) {
+          double element = ((i == 0) ? s : y).innerProduct(p);
+          if (GtWG[j * 2 + i] < element - 1e-08 || GtWG[j * 2 + i] > element + 1e-08) {
+            result = 1;
+          }
+        } // end for
+      }   // end for
+
+      // Print inner products
+      reporter.printf(R_NL, R_BASIC, "Inner products with matrix inverse... should be symmetric: %+23.16e %+23.16e %+23.16e %+23.16e\n", GtWG[0], GtWG[1], GtWG[2], GtWG[3]);
+
       // Set vectors for second update
       s.set(0, -2.0);
       s.set(1, -1.0);
@@ -1253,6 +1298,133 @@ int testSymmetricMatrixImplementation(int option)
 
   } // end for
 
+  // Set short history (so third update overwrites first pair)
+  options.modifyIntegerValue("SMLM_history", 2);
+
+  // Loop over update strategies
+  for (int approximate_hessian_update = 0; approximate_hessian_update < 2; approximate_hessian_update++) {
+
+    // Set update strategy
+    options.modifyStringValue("approximate_hessian_update", (approximate_hessian_update == 0) ? "BFGS" : "DFP");
+    reporter.printf(R_NL, R_BASIC, "TESTING SYMMETRIC MATRIX LIMITED-MEMORY HISTORY WRAP (%s)\n", (approximate_hessian_update == 0) ? "BFGS" : "DFP");
+
+    // Declare matrices, first updated with three pairs and second with last two
+    std::shared_ptr<SymmetricMatrix> H = std::make_shared<SymmetricMatrixLimitedMemory>();
+    std::shared_ptr<SymmetricMatrix> G = std::make_shared<SymmetricMatrixLimitedMemory>();
+    H->setOptions(&options);
+    G->setOptions(&options);
+    H->initialize(&options, &quantities, &reporter);
+    G->initialize(&options, &quantities, &reporter);
+    H->setAsDiagonal(5, 2.0);
+    G->setAsDiagonal(5, 2.0);
+
+    // Perform updates
+    for (int k = 0; k < 3; k++) {
+      Vector s(5), y(5);
+      for (int i = 0; i < 5; i++) {
+        s.set(i, (double)((i + k) % 3) - 0.5);
+        y.set(i, (1.0 + 0.5 * i) * s.values()[i] + 0.1 * k);
+      }
+      H->update(s, y);
+      if (k > 0) {
+        G->update(s, y);
+      }
+    } // end for
+
+    // Check elements
+    for (int i = 0; i < 5; i++) {
+      for (int j = 0; j < 5; j++) {
+        if (H->element(i, j) < G->element(i, j) - 1e-08 || H->element(i, j) > G->element(i, j) + 1e-08 ||
+            H->elementOfInverse(i, j) < G->elementOfInverse(i, j) - 1e-08 || H->elementOfInverse(i, j) > G->elementOfInverse(i, j) + 1e-08) {
+          result = 1;
+        }
+      } // end for
+    }   // end for
+
+    // Check columns (computed in closed form) against elements (of matrix without cached columns)
+    Vector c(5), d(5);
+    H->column(2, c);
+    H->columnOfInverse(2, d);
+    for (int i = 0; i < 5; i++) {
+      if (c.values()[i] < G->element(i, 2) - 1e-08 || c.values()[i] > G->element(i, 2) + 1e-08 ||
+          d.values()[i] < G->elementOfInverse(i, 2) - 1e-08 || d.values()[i] > G->elementOfInverse(i, 2) + 1e-08) {
+        result = 1;
+      }
+    } // end for
+
+    // Print matrix
+    H->print(&reporter, "Updating three times with history two... should match last two updates:");
+
+  } // end for
+
+  // Declare chained problem (with element decomposition) and quantities
+  std::shared_ptr<Problem> chained_problem = std::make_shared<ChainedLQ>(6);
+  Quantities chained_quantities;
+  chained_quantities.initialize(chained_problem);
+
+  // Loop over update strategies
+  for (int approximate_hessian_update = 0; approximate_hessian_update < 2; approximate_hessian_update++) {
+
+    // Set update strategy
+    options.modifyStringValue("approximate_hessian_update", (approximate_hessian_update == 0) ? "BFGS" : "DFP");
+    reporter.printf(R_NL, R_BASIC, "TESTING SYMMETRIC MATRIX PARTITIONED (%s)\n", (approximate_hessian_update == 0) ? "BFGS" : "DFP");
+
+    // Declare matrix
+    std::shared_ptr<SymmetricMatrixPartitioned> H = std::make_shared<SymmetricMatrixPartitioned>();
+    H->setOptions(&options);
+    H->initialize(&options, &chained_quantities, &reporter);
+
+    // Check number of elements
+    if (H->numberOfElements() != 5) {
+      result = 1;
+    }
+
+    // Perform update (with y a positive scaling of s, so all element updates are performed)
+    Vector s(6), y(6);
+    for (int i = 0; i < 6; i++) {
+      s.set(i, (double)(i % 3) - 0.5);
+      y.set(i, (1.0 + 0.5 * i) * s.values()[i]);
+    }
+    H->update(s, y);
+
+    // Check secant equation and elements outside of coupling
+    Vector p(6), q(6);
+    H->matrixVectorProduct(s, p);
+    for (int i = 0; i < 6; i++) {
+      if (p.values()[i] < y.values()[i] - 1e-08 || p.values()[i] > y.values()[i] + 1e-08) {
+        result = 1;
+      }
+    } // end for
+    if (H->element(0, 2) != 0.0 || H->element(5, 3) != 0.0) {
+      result = 1;
+    }
+
+    // Check products with inverse
+    H->matrixVectorProductOfInverse(y, q);
+    for (int i = 0; i < 6; i++) {
+      if (q.values()[i] < s.values()[i] - 1e-08 || q.values()[i] > s.values()[i] + 1e-08) {
+        result = 1;
+      }
+    } // end for
+    if (H->innerProductOfInverse(y) < s.innerProduct(y) - 1e-08 || H->innerProductOfInverse(y) > s.innerProduct(y) + 1e-08) {
+      result = 1;
+    }
+
+    // Check column of inverse
+    Vector c(6);
+    H->columnOfInverse(3, c);
+    H->matrixVectorProduct(c, p);
+    for (int i = 0; i < 6; i++) {
+      if (p.values()[i] < ((i == 3) ? 1.0 : 0.0) - 1e-08 || p.values()[i] > ((i == 3) ? 1.0 : 0.0) + 1e-08) {
+        result = 1;
+      }
+    } // end for
+
+    // Print matrix
+    H->print(&reporter, "Updating chained matrix... should satisfy secant equation:");
+
+  } // end for
+
   // Check option
   if (option == 1) {
     // Print final message
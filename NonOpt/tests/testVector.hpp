@@ -263,6 +263,62 @@ int testVectorImplementation(int option)
                   w2,
                   wInf);
 
+  // Declare sparse vector [0,3,0,0,-1]
+  Vector s(5, 0.0);
+  s.valuesModifiable()[1] = 3.0;
+  s.valuesModifiable()[4] = -1.0;
+
+  // Check sparsity (not sparse for threshold below 2/5)
+  s.determineNonzeroIndices(0.2);
+  if (s.isSparse() || s.nonzeroIndices().size() != 0) {
+    result = 1;
+  }
+  s.determineNonzeroIndices(0.5);
+  if (!s.isSparse() || s.nonzeroIndices().size() != 2) {
+    result = 1;
+  }
+
+  // Compute inner products (sparse with dense, dense with sparse) and add scaled sparse vector
+  double sw = s.innerProduct(*w);
+  double ws = w->innerProduct(s);
+  y->addScaledVector(2.0, s);
+
+  // Check values
+  if (sw < 8.0 - 1e-12 || sw > 8.0 + 1e-12 || ws < 8.0 - 1e-12 || ws > 8.0 + 1e-12) {
+    result = 1;
+  }
+  if (y->values()[1] < 6.4 - 1e-12 || y->values()[1] > 6.4 + 1e-12 || y->values()[4] < -1.3 - 1e-12 || y->values()[4] > -1.3 + 1e-12) {
+    result = 1;
+  }
+
+  // Print sparse results
+  reporter.printf(R_NL, R_BASIC, "Testing sparse inner product... should be 8: %+23.16e\n", sw);
+  y->print(&reporter, "Testing add scaled sparse vector... should be [0.3,6.4,0.5,0.6,-1.3]:");
+
+  // Check that modification discards sparsity
+  s.valuesModifiable()[0] = 1.0;
+  if (s.isSparse()) {
+    result = 1;
+  }
+
+  // Declare memory pool and pooled vector
+  std::shared_ptr<MemoryPool> pool = std::make_shared<MemoryPool>(2);
+  std::shared_ptr<Vector> p(new Vector(5, pool));
+  p->copy(v);
+
+  // Make and release new vectors from pool
+  p->makeNewLinearCombination(1.0, 1.0, v);
+  std::shared_ptr<Vector> q = p->makeNewCopy();
+
+  // Check values and counters (first new vector allocated, second reused)
+  if (q->pool() != pool || q->values()[4] < 1.0 - 1e-12 || q->values()[4] > 1.0 + 1e-12 ||
+      pool->reuseCounter() < 1) {
+    result = 1;
+  }
+
+  // Print pool counters
+  reporter.printf(R_NL, R_BASIC, "Testing memory pool... allocations, reuses: %d, %d\n", pool->allocationCounter(), pool->reuseCounter());
+
   // Check option
   if (option == 1) {
     // Print final message